@@ -507,6 +507,10 @@ SOURCE=.\src\base\cmd\cmdAlias.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\cmd\cmdBench.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\cmd\cmdApi.c
 # End Source File
 # Begin Source File
@@ -531,6 +535,10 @@ SOURCE=.\src\base\cmd\cmdPlugin.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\cmd\cmdServer.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\cmd\cmdStarter.c
 # End Source File
 # Begin Source File
@@ -579,6 +587,10 @@ SOURCE=.\src\base\io\ioReadBlifAig.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\io\ioReadBlifFast.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\io\ioReadBlifMv.c
 # End Source File
 # Begin Source File
@@ -603,6 +615,10 @@ SOURCE=.\src\base\io\ioReadVerilog.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\io\ioReadVerilogFast.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\io\ioUtil.c
 # End Source File
 # Begin Source File
@@ -2091,6 +2107,10 @@ SOURCE=.\src\opt\ret\retFlow.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\ret\retFlowPr.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\ret\retIncrem.c
 # End Source File
 # Begin Source File
@@ -2231,6 +2251,10 @@ SOURCE=.\src\opt\mfs\mfsMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\mfs\mfsPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\mfs\mfsResub.c
 # End Source File
 # Begin Source File
@@ -2343,6 +2367,10 @@ SOURCE=.\src\opt\dar\darMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dar\darPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dar\darPrec.c
 # End Source File
 # Begin Source File
@@ -3335,6 +3363,14 @@ SOURCE=.\src\misc\util\utilNam.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilProf.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilProf.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSignal.c
 # End Source File
 # Begin Source File
@@ -4287,6 +4323,10 @@ SOURCE=.\src\aig\gia\giaRex.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaRwr.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaScl.c
 # End Source File
 # Begin Source File
@@ -4315,6 +4355,10 @@ SOURCE=.\src\aig\gia\giaSim2.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSnap.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSort.c
 # End Source File
 # Begin Source File
@@ -4647,6 +4691,10 @@ SOURCE=.\src\proof\cec\cecSolve.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\cec\cecSolvePar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\cec\cecSplit.c
 # End Source File
 # Begin Source File
@@ -268,6 +268,24 @@ struct Gia_ManSim_t_
     unsigned *     pDataSimCos;  // simulation data for COs
 };
 
+typedef struct Gia_Snap_t_ Gia_Snap_t;
+struct Gia_Snap_t_
+{
+    char *         pName;        // the AIG name
+    char *         pSpec;        // the AIG spec
+    int            nPis;         // the number of primary inputs
+    int            nPos;         // the number of primary outputs
+    int            nRegs;        // the number of registers
+    int            nObjs;        // the number of objects
+    int            nAnd2Delay;   // AND2 delay scaled to match delay numbers used
+    int            nAiger;       // the size of AIGER in the uncompressed data
+    int            nMapping;     // the number of mapping entries in the uncompressed data
+    int            nDataRaw;     // the size of the uncompressed data
+    int            nData;        // the size of the compressed data
+    char *         pData;        // the compressed data
+    Gia_Man_t *    pGia;         // the full copy (if the AIG cannot be compressed)
+};
+
 typedef struct Jf_Par_t_ Jf_Par_t; 
 struct Jf_Par_t_
 {
@@ -1279,6 +1297,7 @@ extern void                Gia_ManPrintMiterStatus( Gia_Man_t * p );
 extern void                Gia_ManPrintStatsMiter( Gia_Man_t * p, int fVerbose );
 extern void                Gia_ManSetRegNum( Gia_Man_t * p, int nRegs );
 extern void                Gia_ManReportImprovement( Gia_Man_t * p, Gia_Man_t * pNew );
+extern void                Gia_ManReportImprovementNum( int nRegs, int nAnds, Gia_Man_t * pNew );
 extern void                Gia_ManPrintNpnClasses( Gia_Man_t * p );
 /*=== giaMem.c ===========================================================*/
 extern Gia_MmFixed_t *     Gia_MmFixedStart( int nEntrySize, int nEntriesMax );
@@ -1315,16 +1334,31 @@ extern void                Gia_SatVerifyPattern( Gia_Man_t * p, Gia_Obj_t * pRoo
 extern Gia_Man_t *         Gia_ManRetimeForward( Gia_Man_t * p, int nMaxIters, int fVerbose );
 /*=== giaSat.c ============================================================*/
 extern int                 Sat_ManTest( Gia_Man_t * pGia, Gia_Obj_t * pObj, int nConfsMax );
+/*=== giaRwr.c ============================================================*/
+extern Gia_Man_t *         Gia_ManDarRewrite( Gia_Man_t * p, int fUseZeros, int fUpdateLevel, int fVerbose );
+extern Gia_Man_t *         Gia_ManDarRefactor( Gia_Man_t * p, int fUseZeros, int fUpdateLevel, int fVerbose );
+extern Gia_Man_t *         Gia_ManDarCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose );
 /*=== giaScl.c ============================================================*/
 extern int                 Gia_ManSeqMarkUsed( Gia_Man_t * p );
 extern int                 Gia_ManCombMarkUsed( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManCleanup( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManCleanupOutputs( Gia_Man_t * p, int nOutputs );
 extern Gia_Man_t *         Gia_ManSeqCleanup( Gia_Man_t * p );
+extern int                 Gia_ManCompactMarked( Gia_Man_t * p );
+extern int                 Gia_ManCleanupInPlace( Gia_Man_t * p );
+extern int                 Gia_ManSeqCleanupInPlace( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManSeqStructSweep( Gia_Man_t * p, int fConst, int fEquiv, int fVerbose );
 /*=== giaShrink.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManMapShrink4( Gia_Man_t * p, int fKeepLevel, int fVerbose );
 extern Gia_Man_t *         Gia_ManMapShrink6( Gia_Man_t * p, int nFanoutMax, int fKeepLevel, int fVerbose );
+/*=== giaSnap.c ============================================================*/
+extern int                 Gia_SnapCanCompress( Gia_Man_t * p );
+extern Gia_Snap_t *        Gia_SnapStart( Gia_Man_t * p, int fCompress );
+extern Gia_Man_t *         Gia_SnapRestore( Gia_Snap_t * pSnap );
+extern void                Gia_SnapStop( Gia_Snap_t * pSnap );
+extern void                Gia_SnapStopP( Gia_Snap_t ** ppSnap );
+extern double              Gia_SnapMemory( Gia_Snap_t * pSnap );
+extern void                Gia_SnapPrint( Gia_Snap_t * pSnap );
 /*=== giaSopb.c ============================================================*/
 extern Gia_Man_t *         Gia_ManExtractWindow( Gia_Man_t * p, int LevelMax, int nTimeWindow, int fVerbose );
 extern Gia_Man_t *         Gia_ManPerformSopBalanceWin( Gia_Man_t * p, int LevelMax, int nTimeWindow, int nCutNum, int nRelaxRatio, int fVerbose );
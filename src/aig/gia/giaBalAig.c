@@ -377,7 +377,7 @@ void Gia_ManBalance_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int
 }
 Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict )
 {
-    Gia_Man_t * pNew, * pTemp;
+    Gia_Man_t * pNew;
     Gia_Obj_t * pObj;
     int i;
     Gia_ManFillValue( p );
@@ -409,8 +409,7 @@ Gia_Man_t * Gia_ManBalanceInt( Gia_Man_t * p, int fStrict )
     Gia_ManHashStop( pNew );
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
     // perform cleanup
-    pNew = Gia_ManCleanup( pTemp = pNew );
-    Gia_ManStop( pTemp );
+    Gia_ManCleanupInPlace( pNew );
     return pNew;
 }
 
@@ -771,7 +770,7 @@ void Dam_ManMultiAig_rec( Dam_Man_t * pMan, Gia_Man_t * pNew, Gia_Man_t * p, Gia
 Gia_Man_t * Dam_ManMultiAig( Dam_Man_t * pMan )
 {
     Gia_Man_t * p = pMan->pGia;
-    Gia_Man_t * pNew, * pTemp;
+    Gia_Man_t * pNew;
     Gia_Obj_t * pObj;
     int i;
     // start the new manager
@@ -805,8 +804,7 @@ Gia_Man_t * Dam_ManMultiAig( Dam_Man_t * pMan )
     Gia_ManHashStop( pNew );
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
     // perform cleanup
-    pNew = Gia_ManCleanup( pTemp = pNew );
-    Gia_ManStop( pTemp );
+    Gia_ManCleanupInPlace( pNew );
     return pNew;
 }
 
@@ -722,7 +722,7 @@ int Gia_ManHashMaj( Gia_Man_t * p, int iData0, int iData1, int iData2 )
 ***********************************************************************/
 Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )  
 {
-    Gia_Man_t * pNew, * pTemp;
+    Gia_Man_t * pNew;
     Gia_Obj_t * pObj;
     int i;
     pNew = Gia_ManStart( Gia_ManObjNum(p) );
@@ -747,8 +747,7 @@ Gia_Man_t * Gia_ManRehash( Gia_Man_t * p, int fAddStrash )
     pNew->fAddStrash = 0;
     Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
 //    printf( "Top gate is %s\n", Gia_ObjFaninC0(Gia_ManCo(pNew, 0))? "OR" : "AND" );
-    pNew = Gia_ManCleanup( pTemp = pNew );
-    Gia_ManStop( pTemp );
+    Gia_ManCleanupInPlace( pNew );
     return pNew;
 }
 
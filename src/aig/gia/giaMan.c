@@ -656,16 +656,20 @@ void Gia_ManSetRegNum( Gia_Man_t * p, int nRegs )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManReportImprovement( Gia_Man_t * p, Gia_Man_t * pNew )
+void Gia_ManReportImprovementNum( int nRegs, int nAnds, Gia_Man_t * pNew )
 {
     Abc_Print( 1, "REG: Beg = %5d. End = %5d. (R =%5.1f %%)  ",
-        Gia_ManRegNum(p), Gia_ManRegNum(pNew),
-        Gia_ManRegNum(p)? 100.0*(Gia_ManRegNum(p)-Gia_ManRegNum(pNew))/Gia_ManRegNum(p) : 0.0 );
+        nRegs, Gia_ManRegNum(pNew),
+        nRegs? 100.0*(nRegs-Gia_ManRegNum(pNew))/nRegs : 0.0 );
     Abc_Print( 1, "AND: Beg = %6d. End = %6d. (R =%5.1f %%)",
-        Gia_ManAndNum(p), Gia_ManAndNum(pNew),
-        Gia_ManAndNum(p)? 100.0*(Gia_ManAndNum(p)-Gia_ManAndNum(pNew))/Gia_ManAndNum(p) : 0.0 );
+        nAnds, Gia_ManAndNum(pNew),
+        nAnds? 100.0*(nAnds-Gia_ManAndNum(pNew))/nAnds : 0.0 );
     Abc_Print( 1, "\n" );
 }
+void Gia_ManReportImprovement( Gia_Man_t * p, Gia_Man_t * pNew )
+{
+    Gia_ManReportImprovementNum( Gia_ManRegNum(p), Gia_ManAndNum(p), pNew );
+}
 
 /**Function*************************************************************
 
@@ -0,0 +1,975 @@
+/**CFile****************************************************************
+
+  FileName    [giaRwr.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [DAG-aware rewriting and refactoring working directly on GIA.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaRwr.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "aig/aig/aig.h"
+#include "opt/dar/dar.h"
+#include "bool/kit/kit.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_RWR_CUTS   8      // the max number of non-trivial cuts per node
+#define GIA_RWR_LEAF  10      // the max number of leaves of the refactoring cut
+
+typedef struct Gia_RwrCut_t_ Gia_RwrCut_t;
+struct Gia_RwrCut_t_
+{
+    int              nLeaves;       // the number of leaves
+    int              pLeaves[4];    // the leaves (object IDs in the new AIG)
+    unsigned         uTruth;        // the 4-input truth table
+};
+
+typedef struct Gia_RwrMan_t_ Gia_RwrMan_t;
+struct Gia_RwrMan_t_
+{
+    Gia_Man_t *      p;             // the old AIG
+    Gia_Man_t *      pNew;          // the new AIG
+    int              fUseZeros;     // accept zero-cost replacements
+    Vec_Int_t *      vRequired;     // required levels of the old AIG
+    int              nObjsAlloc;    // the number of objects with allocated data
+    // cut sets of the new AIG (rewriting only)
+    Gia_RwrCut_t *   pCuts;         // cut sets (GIA_RWR_CUTS+1 cuts each)
+    int *            pCutNums;      // the number of cuts in each set
+    int              nSets;         // the number of allocated sets
+    int *            pSetIds;       // the cut set of each object or -1
+    Vec_Int_t *      vSetFree;      // the recycled cut sets
+    int *            pFanLeft;      // the unvisited AND fanouts of the old nodes
+    Gia_RwrCut_t     pCutsRoot[GIA_RWR_CUTS+1]; // the cut set of the current node
+    // temporary data
+    Vec_Int_t *      vLeaves;       // cut leaves
+    Vec_Int_t *      vCutLits;      // cut leaves as literals
+    Vec_Int_t *      vLeavesBest;   // the best leaves
+    Vec_Int_t *      vMffc;         // MFFC nodes
+    Vec_Int_t *      vMemory;       // memory for ISOP computation
+    unsigned         pTruth[1<<(GIA_RWR_LEAF-5)];
+    unsigned         pTruth0[1<<(GIA_RWR_LEAF-5)];
+    unsigned         pTruth1[1<<(GIA_RWR_LEAF-5)];
+    // statistics
+    int              nNodesTried;
+    int              nNodesUsed;
+};
+
+extern int Dar2_LibEvalMffc( Gia_Man_t * p, Vec_Int_t * vCutLits, unsigned uTruth, int nNodesSaved, int Required, Vec_Int_t * vLeavesBest2, int * pGain );
+extern int Dar2_LibBuildBest( Gia_Man_t * p, Vec_Int_t * vLeavesBest2, int OutBest );
+
+static inline Gia_RwrCut_t * Gia_RwrObjCuts( Gia_RwrMan_t * p, int iObj )   { return p->pCuts + (GIA_RWR_CUTS+1) * p->pSetIds[iObj]; }
+static inline int            Gia_RwrObjCutNum( Gia_RwrMan_t * p, int iObj ) { return p->pCutNums[p->pSetIds[iObj]];                       }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the rewriting manager.]
+
+  Description [The references of the new AIG include the fanouts
+  of the old nodes that are not visited yet.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_RwrMan_t * Gia_RwrManStart( Gia_Man_t * p, int fCuts, int fUseZeros, int fUpdateLevel )
+{
+    Gia_RwrMan_t * pMan;
+    Gia_Obj_t * pObj;
+    int i;
+    pMan = ABC_CALLOC( Gia_RwrMan_t, 1 );
+    pMan->p           = p;
+    pMan->fUseZeros   = fUseZeros;
+    pMan->vRequired   = fUpdateLevel ? Gia_ManRequiredLevel( p ) : NULL;
+    pMan->vLeaves     = Vec_IntAlloc( 16 );
+    pMan->vCutLits    = Vec_IntAlloc( 16 );
+    pMan->vLeavesBest = Vec_IntAlloc( 16 );
+    pMan->vMffc       = Vec_IntAlloc( 100 );
+    pMan->vMemory     = Vec_IntAlloc( 1 << 16 );
+    // start the new manager
+    pMan->pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pMan->pNew->pName = Abc_UtilStrsav( p->pName );
+    pMan->pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Gia_ManHashAlloc( pMan->pNew );
+    Gia_ManCleanLevels( pMan->pNew, Gia_ManObjNum(p) );
+    pMan->nObjsAlloc = pMan->pNew->nObjsAlloc;
+    pMan->pNew->pRefs = ABC_CALLOC( int, pMan->nObjsAlloc );
+    if ( fCuts )
+    {
+        // the cut sets are computed on demand and recycled when the old fanouts are visited
+        pMan->pSetIds  = ABC_FALLOC( int, pMan->nObjsAlloc );
+        pMan->vSetFree = Vec_IntAlloc( 1000 );
+        pMan->pFanLeft = ABC_CALLOC( int, Gia_ManObjNum(p) );
+        Gia_ManForEachAnd( p, pObj, i )
+        {
+            pMan->pFanLeft[Gia_ObjFaninId0(pObj, i)]++;
+            pMan->pFanLeft[Gia_ObjFaninId1(pObj, i)]++;
+        }
+    }
+    return pMan;
+}
+void Gia_RwrManStop( Gia_RwrMan_t * pMan )
+{
+    Vec_IntFreeP( &pMan->vRequired );
+    Vec_IntFree( pMan->vLeaves );
+    Vec_IntFree( pMan->vCutLits );
+    Vec_IntFree( pMan->vLeavesBest );
+    Vec_IntFree( pMan->vMffc );
+    Vec_IntFree( pMan->vMemory );
+    Vec_IntFreeP( &pMan->vSetFree );
+    ABC_FREE( pMan->pFanLeft );
+    ABC_FREE( pMan->pSetIds );
+    ABC_FREE( pMan->pCutNums );
+    ABC_FREE( pMan->pCuts );
+    ABC_FREE( pMan );
+}
+static inline void Gia_RwrManGrow( Gia_RwrMan_t * p )
+{
+    int nObjsOld = p->nObjsAlloc;
+    if ( p->pNew->nObjsAlloc <= nObjsOld )
+        return;
+    p->nObjsAlloc = p->pNew->nObjsAlloc;
+    p->pNew->pRefs = ABC_REALLOC( int, p->pNew->pRefs, p->nObjsAlloc );
+    memset( p->pNew->pRefs + nObjsOld, 0, sizeof(int) * (p->nObjsAlloc - nObjsOld) );
+    if ( p->pSetIds == NULL )
+        return;
+    p->pSetIds = ABC_REALLOC( int, p->pSetIds, p->nObjsAlloc );
+    memset( p->pSetIds + nObjsOld, 0xFF, sizeof(int) * (p->nObjsAlloc - nObjsOld) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Merges two cuts.]
+
+  Description [Returns 0 if the result has more than 4 leaves.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_RwrCutMerge( Gia_RwrCut_t * pC0, Gia_RwrCut_t * pC1, Gia_RwrCut_t * pC )
+{
+    int i = 0, k = 0, c = 0;
+    while ( i < pC0->nLeaves || k < pC1->nLeaves )
+    {
+        if ( c == 4 )
+            return 0;
+        if ( k == pC1->nLeaves || (i < pC0->nLeaves && pC0->pLeaves[i] < pC1->pLeaves[k]) )
+            pC->pLeaves[c++] = pC0->pLeaves[i++];
+        else if ( i == pC0->nLeaves || pC0->pLeaves[i] > pC1->pLeaves[k] )
+            pC->pLeaves[c++] = pC1->pLeaves[k++];
+        else
+            pC->pLeaves[c++] = pC0->pLeaves[i++], k++;
+    }
+    pC->nLeaves = c;
+    return 1;
+}
+static inline int Gia_RwrCutIsContained( Gia_RwrCut_t * pSmall, Gia_RwrCut_t * pBig )
+{
+    int i, k;
+    if ( pSmall->nLeaves > pBig->nLeaves )
+        return 0;
+    for ( i = k = 0; i < pSmall->nLeaves; i++ )
+    {
+        while ( k < pBig->nLeaves && pBig->pLeaves[k] < pSmall->pLeaves[i] )
+            k++;
+        if ( k == pBig->nLeaves || pBig->pLeaves[k] != pSmall->pLeaves[i] )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Expresses the truth table of the cut using the leaves of the other cut.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Gia_RwrCutStretch( Gia_RwrCut_t * pCut, Gia_RwrCut_t * pCutR )
+{
+    unsigned uRes = 0;
+    int pPos[4], i, k, m, Idx;
+    for ( i = k = 0; i < pCut->nLeaves; i++ )
+    {
+        while ( pCutR->pLeaves[k] != pCut->pLeaves[i] )
+            k++;
+        pPos[i] = k;
+    }
+    for ( m = 0; m < 16; m++ )
+    {
+        for ( Idx = i = 0; i < pCut->nLeaves; i++ )
+            Idx |= ((m >> pPos[i]) & 1) << i;
+        if ( (pCut->uTruth >> Idx) & 1 )
+            uRes |= (1 << m);
+    }
+    return uRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the leaves that are not in the support of the cut.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_RwrCutMinimize( Gia_RwrCut_t * pCut )
+{
+    static unsigned Masks[4] = { 0x5555, 0x3333, 0x0F0F, 0x00FF };
+    Gia_RwrCut_t Cut;
+    int i, k, n, Idx;
+    for ( i = Cut.nLeaves = 0; i < pCut->nLeaves; i++ )
+        if ( ((pCut->uTruth >> (1 << i)) & Masks[i]) != (pCut->uTruth & Masks[i]) )
+            Cut.pLeaves[Cut.nLeaves++] = pCut->pLeaves[i];
+    if ( Cut.nLeaves == pCut->nLeaves )
+        return;
+    Cut.uTruth = 0;
+    for ( i = 0; i < 16; i++ )
+    {
+        for ( Idx = k = n = 0; k < pCut->nLeaves; k++ )
+            if ( n < Cut.nLeaves && Cut.pLeaves[n] == pCut->pLeaves[k] )
+                Idx |= ((i >> n++) & 1) << k;
+        if ( (pCut->uTruth >> Idx) & 1 )
+            Cut.uTruth |= (1 << i);
+    }
+    *pCut = Cut;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes 4-input cuts of the AND of two literals.]
+
+  Description [The first cut in the set is the trivial cut of the node,
+  which is empty for the node that is not created yet. The cuts of the
+  fanins should be computed. Returns the number of cuts.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_RwrComputeCuts( Gia_RwrMan_t * p, int iObj, int iLit0, int iLit1, Gia_RwrCut_t * pCuts )
+{
+    Gia_RwrCut_t * pCuts0, * pCuts1, * pC0, * pC1, Cut;
+    int i, k, c, nCuts = 1, iFan0 = Abc_Lit2Var(iLit0), iFan1 = Abc_Lit2Var(iLit1);
+    unsigned uTruth0, uTruth1;
+    pCuts[0].nLeaves    = (int)(iObj >= 0);
+    pCuts[0].pLeaves[0] = iObj;
+    pCuts[0].uTruth     = 0xAAAA;
+    pCuts0 = Gia_RwrObjCuts( p, iFan0 );
+    pCuts1 = Gia_RwrObjCuts( p, iFan1 );
+    for ( pC0 = pCuts0; pC0 < pCuts0 + Gia_RwrObjCutNum(p, iFan0); pC0++ )
+    for ( pC1 = pCuts1; pC1 < pCuts1 + Gia_RwrObjCutNum(p, iFan1); pC1++ )
+    {
+        if ( !Gia_RwrCutMerge( pC0, pC1, &Cut ) )
+            continue;
+        uTruth0 = Gia_RwrCutStretch( pC0, &Cut ) ^ (Abc_LitIsCompl(iLit0) ? 0xFFFF : 0);
+        uTruth1 = Gia_RwrCutStretch( pC1, &Cut ) ^ (Abc_LitIsCompl(iLit1) ? 0xFFFF : 0);
+        Cut.uTruth = uTruth0 & uTruth1;
+        Gia_RwrCutMinimize( &Cut );
+        // skip the cut if it is dominated
+        for ( c = 1; c < nCuts; c++ )
+            if ( Gia_RwrCutIsContained( pCuts + c, &Cut ) )
+                break;
+        if ( c < nCuts )
+            continue;
+        // remove the cuts dominated by this one
+        for ( c = k = 1; c < nCuts; c++ )
+            if ( !Gia_RwrCutIsContained( &Cut, pCuts + c ) )
+                pCuts[k++] = pCuts[c];
+        nCuts = k;
+        // the set is full - replace the last cut if the new one is smaller
+        if ( nCuts == GIA_RWR_CUTS + 1 )
+        {
+            if ( pCuts[nCuts-1].nLeaves <= Cut.nLeaves )
+                continue;
+            nCuts--;
+        }
+        // insert the cut while keeping the cuts sorted by size
+        for ( i = nCuts; i > 1 && pCuts[i-1].nLeaves > Cut.nLeaves; i-- )
+            pCuts[i] = pCuts[i-1];
+        pCuts[i] = Cut;
+        nCuts++;
+    }
+    return nCuts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes and recycles the cut sets of the new AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_RwrObjPrepareCuts_rec( Gia_RwrMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
+    Gia_RwrCut_t * pCuts;
+    int iSet;
+    if ( p->pSetIds[iObj] >= 0 )
+        return;
+    if ( Gia_ObjIsAnd(pObj) )
+    {
+        Gia_RwrObjPrepareCuts_rec( p, Gia_ObjFaninId0(pObj, iObj) );
+        Gia_RwrObjPrepareCuts_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+    }
+    // allocate the set
+    if ( Vec_IntSize(p->vSetFree) > 0 )
+        iSet = Vec_IntPop( p->vSetFree );
+    else
+    {
+        if ( p->nSets % 1024 == 0 )
+        {
+            p->pCuts    = ABC_REALLOC( Gia_RwrCut_t, p->pCuts, (GIA_RWR_CUTS+1) * (p->nSets + 1024) );
+            p->pCutNums = ABC_REALLOC( int, p->pCutNums, p->nSets + 1024 );
+        }
+        iSet = p->nSets++;
+    }
+    p->pSetIds[iObj] = iSet;
+    pCuts = Gia_RwrObjCuts( p, iObj );
+    if ( Gia_ObjIsAnd(pObj) )
+        p->pCutNums[iSet] = Gia_RwrComputeCuts( p, iObj, Gia_ObjFaninLit0(pObj, iObj), Gia_ObjFaninLit1(pObj, iObj), pCuts );
+    else
+    {
+        p->pCutNums[iSet]   = 1;
+        pCuts[0].nLeaves    = 1;
+        pCuts[0].pLeaves[0] = iObj;
+        pCuts[0].uTruth     = 0xAAAA;
+    }
+}
+static inline void Gia_RwrObjRecycleCuts( Gia_RwrMan_t * p, int iObj )
+{
+    if ( p->pSetIds[iObj] == -1 )
+        return;
+    Vec_IntPush( p->vSetFree, p->pSetIds[iObj] );
+    p->pSetIds[iObj] = -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates objects in the new AIG.]
+
+  Description [Updates levels and phases of the new AND nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_RwrAppendCi( Gia_RwrMan_t * p )
+{
+    int iLit = Gia_ManAppendCi( p->pNew );
+    Gia_RwrManGrow( p );
+    return iLit;
+}
+static inline void Gia_RwrUpdateNew( Gia_RwrMan_t * p, int nObjsOld )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    Gia_RwrManGrow( p );
+    for ( i = nObjsOld; i < Gia_ManObjNum(p->pNew); i++ )
+    {
+        pObj = Gia_ManObj( p->pNew, i );
+        assert( Gia_ObjIsAnd(pObj) );
+        Gia_ObjSetAndLevel( p->pNew, pObj );
+        Gia_ObjSetPhase( p->pNew, pObj );
+    }
+}
+static inline int Gia_RwrHashAnd( Gia_RwrMan_t * p, int iLit0, int iLit1 )
+{
+    int nObjs = Gia_ManObjNum( p->pNew );
+    int iLit = Gia_ManHashAnd( p->pNew, iLit0, iLit1 );
+    if ( nObjs < Gia_ManObjNum(p->pNew) )
+        Gia_RwrUpdateNew( p, nObjs );
+    return iLit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [References and dereferences the nodes of the new AIG.]
+
+  Description [A node without references is not part of the new AIG.
+  When it gets referenced again, its fanins are referenced too.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_RwrObjRef_rec( Gia_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    if ( Gia_ObjRefIncId(p, iObj) > 0 || !Gia_ObjIsAnd(pObj) )
+        return;
+    Gia_RwrObjRef_rec( p, Gia_ObjFaninId0(pObj, iObj) );
+    Gia_RwrObjRef_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+}
+void Gia_RwrObjDeref_rec( Gia_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    assert( Gia_ObjRefNumId(p, iObj) > 0 );
+    if ( Gia_ObjRefDecId(p, iObj) > 0 || !Gia_ObjIsAnd(pObj) )
+        return;
+    Gia_RwrObjDeref_rec( p, Gia_ObjFaninId0(pObj, iObj) );
+    Gia_RwrObjDeref_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+}
+int Gia_RwrObjDerefMffc_rec( Gia_Man_t * p, int iObj, Vec_Int_t * vMffc )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    assert( Gia_ObjRefNumId(p, iObj) > 0 );
+    if ( Gia_ObjRefDecId(p, iObj) > 0 || !Gia_ObjIsAnd(pObj) )
+        return 0;
+    Vec_IntPush( vMffc, iObj );
+    return 1 + Gia_RwrObjDerefMffc_rec( p, Gia_ObjFaninId0(pObj, iObj), vMffc )
+             + Gia_RwrObjDerefMffc_rec( p, Gia_ObjFaninId1(pObj, iObj), vMffc );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the MFFC of the node bounded by the cut.]
+
+  Description [The node is the AND of two literals of the new AIG,
+  which is not created yet. Marks the MFFC nodes with the current
+  traversal ID. Returns the number of MFFC nodes including the node.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_RwrNodeMffcMark( Gia_RwrMan_t * p, int iLit0, int iLit1, int * pLeaves, int nLeaves )
+{
+    Gia_Man_t * pNew = p->pNew;
+    int i, iObj, nSaved = 1;
+    for ( i = 0; i < nLeaves; i++ )
+        Gia_ObjRefIncId( pNew, pLeaves[i] );
+    Vec_IntClear( p->vMffc );
+    nSaved += Gia_RwrObjDerefMffc_rec( pNew, Abc_Lit2Var(iLit0), p->vMffc );
+    nSaved += Gia_RwrObjDerefMffc_rec( pNew, Abc_Lit2Var(iLit1), p->vMffc );
+    Gia_RwrObjRef_rec( pNew, Abc_Lit2Var(iLit0) );
+    Gia_RwrObjRef_rec( pNew, Abc_Lit2Var(iLit1) );
+    for ( i = 0; i < nLeaves; i++ )
+        Gia_ObjRefDecId( pNew, pLeaves[i] );
+    Gia_ManIncrementTravId( pNew );
+    Vec_IntForEachEntry( p->vMffc, iObj, i )
+        Gia_ObjSetTravIdCurrentId( pNew, iObj );
+    return nSaved;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs rewriting of one node using 4-input cuts.]
+
+  Description [The node is the AND of two literals of the new AIG.
+  Returns the literal of the new node or -1 if rewriting did not
+  succeed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_RwrNodeRewrite( Gia_RwrMan_t * p, Gia_Obj_t * pObj, int iLit0, int iLit1, int Required )
+{
+    Gia_RwrCut_t * pCut;
+    int c, k, nCuts, nSaved, Out, Gain, iLit, nObjs;
+    int OutBest = -1, GainBest = -ABC_INFINITY;
+    p->nNodesTried++;
+    Gia_RwrObjPrepareCuts_rec( p, Abc_Lit2Var(iLit0) );
+    Gia_RwrObjPrepareCuts_rec( p, Abc_Lit2Var(iLit1) );
+    nCuts = Gia_RwrComputeCuts( p, -1, iLit0, iLit1, p->pCutsRoot );
+    // check if there is a trivial cut
+    for ( c = 1; c < nCuts; c++ )
+    {
+        pCut = p->pCutsRoot + c;
+        if ( pCut->nLeaves == 0 )
+            return (int)(pCut->uTruth == 0xFFFF);
+        if ( pCut->nLeaves == 1 )
+            return Abc_Var2Lit( pCut->pLeaves[0], pCut->uTruth == 0x5555 );
+    }
+    // evaluate the cuts
+    for ( c = 1; c < nCuts; c++ )
+    {
+        pCut = p->pCutsRoot + c;
+        if ( pCut->nLeaves < 3 )
+            continue;
+        nSaved = Gia_RwrNodeMffcMark( p, iLit0, iLit1, pCut->pLeaves, pCut->nLeaves );
+        Vec_IntClear( p->vCutLits );
+        for ( k = 0; k < pCut->nLeaves; k++ )
+            Vec_IntPush( p->vCutLits, Abc_Var2Lit(pCut->pLeaves[k], 0) );
+        if ( k == 3 )
+            Vec_IntPush( p->vCutLits, 0 );
+        Out = Dar2_LibEvalMffc( p->pNew, p->vCutLits, pCut->uTruth, nSaved, Required, p->vLeaves, &Gain );
+        if ( Out == -1 || Gain <= GainBest )
+            continue;
+        GainBest = Gain;
+        OutBest  = Out;
+        Vec_IntClear( p->vLeavesBest );
+        Vec_IntAppend( p->vLeavesBest, p->vLeaves );
+    }
+    if ( !(GainBest > 0 || (GainBest == 0 && p->fUseZeros)) )
+        return -1;
+    p->nNodesUsed++;
+    assert( OutBest >= 0 );
+    nObjs = Gia_ManObjNum( p->pNew );
+    iLit = Dar2_LibBuildBest( p->pNew, p->vLeavesBest, OutBest );
+    if ( nObjs < Gia_ManObjNum(p->pNew) )
+        Gia_RwrUpdateNew( p, nObjs );
+    return Abc_LitNotCond( iLit, Gia_ObjPhaseRealLit(p->pNew, iLit) ^ pObj->fPhase );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes one reconvergence-driven cut.]
+
+  Description [The root is the AND of two literals of the new AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_RwrLeafCost( Gia_Man_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    int Cost;
+    if ( !Gia_ObjIsAnd(pObj) )
+        return ABC_INFINITY;
+    Cost  = !Gia_ObjIsTravIdCurrentId( p, Gia_ObjFaninId0(pObj, iObj) );
+    Cost += !Gia_ObjIsTravIdCurrentId( p, Gia_ObjFaninId1(pObj, iObj) );
+    return Cost;
+}
+void Gia_RwrFindCut( Gia_Man_t * p, int iLit0, int iLit1, int nLeafMax, Vec_Int_t * vLeaves )
+{
+    Gia_Obj_t * pObj;
+    int i, k, iObj, iFanin, Cost, CostBest, iBest;
+    Gia_ManIncrementTravId( p );
+    Vec_IntClear( vLeaves );
+    Vec_IntPush( vLeaves, Abc_Lit2Var(iLit0) );
+    Vec_IntPush( vLeaves, Abc_Lit2Var(iLit1) );
+    Gia_ObjSetTravIdCurrentId( p, Abc_Lit2Var(iLit0) );
+    Gia_ObjSetTravIdCurrentId( p, Abc_Lit2Var(iLit1) );
+    while ( 1 )
+    {
+        // find the leaf with the smallest number of new fanins
+        iBest = -1;
+        CostBest = ABC_INFINITY;
+        Vec_IntForEachEntry( vLeaves, iObj, i )
+        {
+            Cost = Gia_RwrLeafCost( p, iObj );
+            if ( CostBest > Cost )
+                CostBest = Cost, iBest = i;
+        }
+        if ( iBest == -1 || Vec_IntSize(vLeaves) - 1 + CostBest > nLeafMax )
+            break;
+        // replace this leaf by its fanins
+        iObj = Vec_IntEntry( vLeaves, iBest );
+        pObj = Gia_ManObj( p, iObj );
+        Vec_IntDrop( vLeaves, iBest );
+        for ( k = 0; k < 2; k++ )
+        {
+            iFanin = k ? Gia_ObjFaninId1(pObj, iObj) : Gia_ObjFaninId0(pObj, iObj);
+            if ( Gia_ObjIsTravIdCurrentId(p, iFanin) )
+                continue;
+            Gia_ObjSetTravIdCurrentId( p, iFanin );
+            Vec_IntPush( vLeaves, iFanin );
+        }
+    }
+    assert( Vec_IntSize(vLeaves) <= nLeafMax );
+    Vec_IntSort( vLeaves, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Counts the number of new nodes added when using this graph.]
+
+  Description [The nodes of the MFFC and the nodes without references
+  are counted as new. Returns -1 if the number of nodes or the level
+  is exceeded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_RwrTryGraph( Gia_Man_t * pNew, Vec_Int_t * vCutLits, Kit_Graph_t * pGraph, int NodeMax, int LevelMax )
+{
+    Kit_Node_t * pNode, * pNode0, * pNode1;
+    int i, iLit, iLit0, iLit1, Counter = 0, LevelNew;
+    if ( Kit_GraphIsConst(pGraph) || Kit_GraphIsVar(pGraph) )
+        return 0;
+    Kit_GraphForEachLeaf( pGraph, pNode, i )
+    {
+        pNode->iFunc = Vec_IntEntry( vCutLits, i );
+        pNode->Level = Gia_ObjLevelId( pNew, Abc_Lit2Var(pNode->iFunc) );
+    }
+    Kit_GraphForEachNode( pGraph, pNode, i )
+    {
+        pNode0 = Kit_GraphNode( pGraph, pNode->eEdge0.Node );
+        pNode1 = Kit_GraphNode( pGraph, pNode->eEdge1.Node );
+        iLit = -1;
+        if ( pNode0->iFunc >= 0 && pNode1->iFunc >= 0 )
+        {
+            iLit0 = Abc_LitNotCond( pNode0->iFunc, pNode->eEdge0.fCompl );
+            iLit1 = Abc_LitNotCond( pNode1->iFunc, pNode->eEdge1.fCompl );
+            if ( iLit0 == 0 || iLit1 == 0 || iLit0 == Abc_LitNot(iLit1) )
+                iLit = 0;
+            else if ( iLit0 == 1 || iLit0 == iLit1 )
+                iLit = iLit1;
+            else if ( iLit1 == 1 )
+                iLit = iLit0;
+            else if ( (iLit = Gia_ManHashLookup(pNew, Gia_ObjFromLit(pNew, iLit0), Gia_ObjFromLit(pNew, iLit1))) == 0 )
+                iLit = -1;
+        }
+        // count the number of added nodes
+        if ( iLit == -1 || Gia_ObjIsTravIdCurrentId(pNew, Abc_Lit2Var(iLit)) || 
+            (Abc_Lit2Var(iLit) > 0 && Gia_ObjRefNumId(pNew, Abc_Lit2Var(iLit)) == 0) )
+        {
+            if ( ++Counter > NodeMax )
+                return -1;
+        }
+        // count the number of new levels
+        if ( iLit >= 0 )
+            LevelNew = Gia_ObjLevelId( pNew, Abc_Lit2Var(iLit) );
+        else
+            LevelNew = 1 + Abc_MaxInt( pNode0->Level, pNode1->Level );
+        if ( LevelNew > LevelMax )
+            return -1;
+        pNode->iFunc = iLit;
+        pNode->Level = LevelNew;
+    }
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the graph in the new AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_RwrBuildGraph( Gia_RwrMan_t * p, Vec_Int_t * vCutLits, Kit_Graph_t * pGraph )
+{
+    Kit_Node_t * pNode = NULL;
+    int i, iLit0, iLit1;
+    if ( Kit_GraphIsConst(pGraph) )
+        return Abc_LitNotCond( 1, Kit_GraphIsComplement(pGraph) );
+    Kit_GraphForEachLeaf( pGraph, pNode, i )
+        pNode->iFunc = Vec_IntEntry( vCutLits, i );
+    if ( Kit_GraphIsVar(pGraph) )
+        return Abc_LitNotCond( Kit_GraphVar(pGraph)->iFunc, Kit_GraphIsComplement(pGraph) );
+    Kit_GraphForEachNode( pGraph, pNode, i )
+    {
+        iLit0 = Abc_LitNotCond( Kit_GraphNode(pGraph, pNode->eEdge0.Node)->iFunc, pNode->eEdge0.fCompl );
+        iLit1 = Abc_LitNotCond( Kit_GraphNode(pGraph, pNode->eEdge1.Node)->iFunc, pNode->eEdge1.fCompl );
+        pNode->iFunc = Gia_RwrHashAnd( p, iLit0, iLit1 );
+    }
+    return Abc_LitNotCond( pNode->iFunc, Kit_GraphIsComplement(pGraph) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the truth table of the literal in terms of the leaves.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_RwrLitTruth( Gia_Man_t * p, int iLit, Vec_Int_t * vLeaves, unsigned * pTruth )
+{
+    int k = Vec_IntFind( vLeaves, Abc_Lit2Var(iLit) );
+    int nVars = Vec_IntSize( vLeaves );
+    if ( k >= 0 )
+        Kit_TruthIthVar( pTruth, nVars, k );
+    else
+        memcpy( pTruth, Gia_ObjComputeTruthTableCut(p, Gia_ManObj(p, Abc_Lit2Var(iLit)), vLeaves), sizeof(unsigned) * Kit_TruthWordNum(nVars) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs refactoring of one node using a reconvergence-driven cut.]
+
+  Description [The node is the AND of two literals of the new AIG.
+  Returns the literal of the new node or -1 if refactoring did not 
+  succeed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_RwrNodeRefactor( Gia_RwrMan_t * p, int iLit0, int iLit1, int Required )
+{
+    Kit_Graph_t * pGraph, * pGraphBest = NULL;
+    int i, iObj, nVars, nSaved, nAdded, Gain, GainBest = -1, iLit;
+    Gia_RwrFindCut( p->pNew, iLit0, iLit1, GIA_RWR_LEAF, p->vLeaves );
+    nVars  = Vec_IntSize( p->vLeaves );
+    nSaved = Gia_RwrNodeMffcMark( p, iLit0, iLit1, Vec_IntArray(p->vLeaves), nVars );
+    if ( nSaved < 2 )
+        return -1;
+    p->nNodesTried++;
+    Vec_IntClear( p->vCutLits );
+    Vec_IntForEachEntry( p->vLeaves, iObj, i )
+        Vec_IntPush( p->vCutLits, Abc_Var2Lit(iObj, 0) );
+    // get the truth table
+    Gia_RwrLitTruth( p->pNew, iLit0, p->vLeaves, p->pTruth0 );
+    Gia_RwrLitTruth( p->pNew, iLit1, p->vLeaves, p->pTruth1 );
+    Kit_TruthAndPhase( p->pTruth, p->pTruth0, p->pTruth1, nVars, Abc_LitIsCompl(iLit0), Abc_LitIsCompl(iLit1) );
+    if ( Kit_TruthIsConst0(p->pTruth, nVars) )
+        pGraphBest = Kit_GraphCreateConst0(), GainBest = nSaved;
+    else if ( Kit_TruthIsConst1(p->pTruth, nVars) )
+        pGraphBest = Kit_GraphCreateConst1(), GainBest = nSaved;
+    else
+    {
+        // try both phases
+        for ( i = 0; i < 2; i++ )
+        {
+            if ( i )
+                Kit_TruthNot( p->pTruth, p->pTruth, nVars );
+            if ( Kit_TruthIsop( p->pTruth, nVars, p->vMemory, 0 ) == -1 )
+                continue;
+            pGraph = Kit_SopFactor( p->vMemory, i, nVars, p->vMemory );
+            nAdded = Gia_RwrTryGraph( p->pNew, p->vCutLits, pGraph, nSaved - !p->fUseZeros, Required );
+            Gain   = nSaved - nAdded;
+            if ( nAdded > -1 && (GainBest < Gain || (GainBest == Gain &&
+                (Kit_GraphIsConst(pGraph) || Kit_GraphRootLevel(pGraph) < Kit_GraphRootLevel(pGraphBest)))) )
+            {
+                if ( pGraphBest )
+                    Kit_GraphFree( pGraphBest );
+                pGraphBest = pGraph;
+                GainBest = Gain;
+            }
+            else
+                Kit_GraphFree( pGraph );
+        }
+    }
+    if ( pGraphBest == NULL )
+        return -1;
+    if ( !(GainBest > 0 || (GainBest == 0 && p->fUseZeros)) )
+    {
+        Kit_GraphFree( pGraphBest );
+        return -1;
+    }
+    p->nNodesUsed++;
+    iLit = Gia_RwrBuildGraph( p, p->vCutLits, pGraphBest );
+    Kit_GraphFree( pGraphBest );
+    return iLit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one pass of rewriting or refactoring.]
+
+  Description [The new AIG is constructed in one topological traversal
+  of the old AIG. Each node is either replaced by the best structure 
+  found for its cuts in the new AIG, or copied into the new AIG. The 
+  references of the new AIG are maintained as if the old nodes were 
+  replaced in place, which makes the gain computation the same as in 
+  the AIG-based rewriting.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManDarRewriteInt( Gia_Man_t * p, int fRefactor, int fUseZeros, int fUpdateLevel, int fVerbose )
+{
+    Gia_RwrMan_t * pMan;
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i, k, iLit, iLit0, iLit1, Required;
+    abctime clk = Abc_Clock();
+    assert( !Gia_ManHasChoices(p) );
+    assert( p->pMuxes == NULL );
+    if ( !fRefactor )
+        Dar_LibPrepare( 5 );
+    Gia_ManSetPhase( p );
+    Gia_ManCreateRefs( p );
+    pMan = Gia_RwrManStart( p, !fRefactor, fUseZeros, fUpdateLevel );
+    pNew = pMan->pNew;
+    if ( fRefactor )
+        Gia_ObjComputeTruthTableStart( pNew, GIA_RWR_LEAF );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+            Gia_RwrManGrow( pMan );
+            continue;
+        }
+        if ( Gia_ObjIsCi(pObj) )
+            pObj->Value = Gia_RwrAppendCi( pMan );
+        else
+        {
+            assert( Gia_ObjIsAnd(pObj) );
+            iLit0 = Gia_ObjFanin0Copy(pObj);
+            iLit1 = Gia_ObjFanin1Copy(pObj);
+            iLit  = -1;
+            if ( Abc_Lit2Var(iLit0) > 0 && Abc_Lit2Var(iLit1) > 0 && Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1) )
+            {
+                Required = pMan->vRequired ? Vec_IntEntry(pMan->vRequired, i) : ABC_INFINITY;
+                if ( fRefactor )
+                    iLit = Gia_RwrNodeRefactor( pMan, iLit0, iLit1, Required );
+                else
+                    iLit = Gia_RwrNodeRewrite( pMan, pObj, iLit0, iLit1, Required );
+            }
+            if ( iLit == -1 )
+                iLit = Gia_RwrHashAnd( pMan, iLit0, iLit1 );
+            pObj->Value = iLit;
+            // transfer the references of the old node to the new one
+            for ( k = 0; k < Gia_ObjRefNum(p, pObj); k++ )
+                Gia_RwrObjRef_rec( pNew, Abc_Lit2Var(iLit) );
+            Gia_RwrObjDeref_rec( pNew, Abc_Lit2Var(iLit0) );
+            Gia_RwrObjDeref_rec( pNew, Abc_Lit2Var(iLit1) );
+            // recycle the cuts that are not likely to be needed
+            if ( pMan->pFanLeft && --pMan->pFanLeft[Gia_ObjFaninId0(pObj, i)] == 0 )
+                Gia_RwrObjRecycleCuts( pMan, Abc_Lit2Var(iLit0) );
+            if ( pMan->pFanLeft && --pMan->pFanLeft[Gia_ObjFaninId1(pObj, i)] == 0 )
+                Gia_RwrObjRecycleCuts( pMan, Abc_Lit2Var(iLit1) );
+            continue;
+        }
+        for ( k = 0; k < Gia_ObjRefNum(p, pObj); k++ )
+            Gia_RwrObjRef_rec( pNew, Abc_Lit2Var(pObj->Value) );
+    }
+    Gia_ManHashStop( pNew );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    if ( fRefactor )
+        Gia_ObjComputeTruthTableStop( pNew );
+    if ( fVerbose )
+    {
+        printf( "%s: Tried = %6d. Used = %6d. ", fRefactor ? "Refactor" : "Rewrite ", pMan->nNodesTried, pMan->nNodesUsed );
+        if ( !fRefactor )
+            printf( "Cut sets = %6d. ", pMan->nSets );
+    }
+    Gia_RwrManStop( pMan );
+    ABC_FREE( p->pRefs );
+    ABC_FREE( pNew->pRefs );
+    Gia_ManCleanupInPlace( pNew );
+    if ( fVerbose )
+    {
+        printf( "Nodes: %6d -> %6d.  ", Gia_ManAndNum(p), Gia_ManAndNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs DAG-aware rewriting and refactoring of GIA.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManDarRewrite( Gia_Man_t * p, int fUseZeros, int fUpdateLevel, int fVerbose )
+{
+    return Gia_ManDarRewriteInt( p, 0, fUseZeros, fUpdateLevel, fVerbose );
+}
+Gia_Man_t * Gia_ManDarRefactor( Gia_Man_t * p, int fUseZeros, int fUpdateLevel, int fVerbose )
+{
+    return Gia_ManDarRewriteInt( p, 1, fUseZeros, fUpdateLevel, fVerbose );
+}
+
+static inline Gia_Man_t * Gia_ManDarBalance( Gia_Man_t * p, int fUpdateLevel )
+{
+    return fUpdateLevel ? Gia_ManBalance( p, 0, 0, 0 ) : Gia_ManAreaBalance( p, 0, ABC_INFINITY, 0, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reproduces script "compress2" without converting into AIG.]
+
+  Description [Balancing is delay-oriented if fUpdateLevel is set and 
+  area-oriented otherwise.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManDarCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
+//alias compress2   "b -l; rw -l; rf -l; b -l; rw -l; rwz -l; b -l; rfz -l; rwz -l; b -l"
+{
+    Gia_Man_t * pNew, * pTemp;
+    pNew = Gia_ManDarRewrite( p, 0, fUpdateLevel, fVerbose );
+    if ( fVerbose ) Gia_ManPrintStats( pNew, NULL );
+    pNew = Gia_ManDarRefactor( pTemp = pNew, 0, fUpdateLevel, fVerbose );
+    Gia_ManStop( pTemp );
+    if ( fVerbose ) Gia_ManPrintStats( pNew, NULL );
+    pNew = Gia_ManDarBalance( pTemp = pNew, fUpdateLevel );
+    Gia_ManStop( pTemp );
+    if ( fVerbose ) Gia_ManPrintStats( pNew, NULL );
+    pNew = Gia_ManDarRewrite( pTemp = pNew, 0, fUpdateLevel, fVerbose );
+    Gia_ManStop( pTemp );
+    if ( fVerbose ) Gia_ManPrintStats( pNew, NULL );
+    pNew = Gia_ManDarRewrite( pTemp = pNew, 1, fUpdateLevel, fVerbose );
+    Gia_ManStop( pTemp );
+    if ( fVerbose ) Gia_ManPrintStats( pNew, NULL );
+    pNew = Gia_ManDarBalance( pTemp = pNew, fUpdateLevel );
+    Gia_ManStop( pTemp );
+    if ( fVerbose ) Gia_ManPrintStats( pNew, NULL );
+    pNew = Gia_ManDarRefactor( pTemp = pNew, 1, fUpdateLevel, fVerbose );
+    Gia_ManStop( pTemp );
+    if ( fVerbose ) Gia_ManPrintStats( pNew, NULL );
+    pNew = Gia_ManDarRewrite( pTemp = pNew, 1, fUpdateLevel, fVerbose );
+    Gia_ManStop( pTemp );
+    if ( fVerbose ) Gia_ManPrintStats( pNew, NULL );
+    pNew = Gia_ManDarBalance( pTemp = pNew, fUpdateLevel );
+    Gia_ManStop( pTemp );
+    if ( fVerbose ) Gia_ManPrintStats( pNew, NULL );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/tim/tim.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -186,6 +187,220 @@ Gia_Man_t * Gia_ManSeqCleanup( Gia_Man_t * p )
     return Gia_ManDupMarked( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Frees object-indexed data invalidated by compaction.]
+
+  Description [Data depending on the CI/CO numbering (including the 
+  timing manager) is freed only if fCioChange is set.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManCompactFreeData( Gia_Man_t * p, int fCioChange )
+{
+    if ( p->pHTable )
+        Gia_ManHashStop( p );
+    Gia_ManStaticFanoutStop( p );
+    Vec_IntFreeP( &p->vLevels );
+    p->nLevels = 0;
+    Vec_IntFreeP( &p->vMapping );
+    Vec_IntFreeP( &p->vCellMapping );
+    Vec_IntFreeP( &p->vPacking );
+    Vec_IntFreeP( &p->vLutConfigs );
+    Vec_IntFreeP( &p->vGateClasses );
+    Vec_IntFreeP( &p->vObjClasses );
+    Vec_IntFreeP( &p->vSwitching );
+    Vec_IntFreeP( &p->vTruths );
+    Vec_IntFreeP( &p->vDoms );
+    Vec_IntFreeP( &p->vTtNums );
+    Vec_IntFreeP( &p->vClassOld );
+    Vec_IntFreeP( &p->vClassNew );
+    Vec_IntFreeP( &p->vBarBufs );
+    Vec_FltFreeP( &p->vTiming );
+    Vec_WrdFreeP( &p->vSims );
+    Vec_IntErase( &p->vCopies );
+    ABC_FREE( p->pRefs );
+    ABC_FREE( p->pFanData );
+    p->nFansAlloc = 0;
+    ABC_FREE( p->pTravIds );
+    p->nTravIdsAlloc = 0;
+    ABC_FREE( p->pPlacement );
+    ABC_FREE( p->pSwitching );
+    ABC_FREE( p->pReprsOld );
+    ABC_FREE( p->pIso );
+    if ( !fCioChange )
+        return;
+    Tim_ManStopP( (Tim_Man_t **)&p->pManTime );
+    Vec_IntFreeP( &p->vCiNumsOrig );
+    Vec_IntFreeP( &p->vCoNumsOrig );
+    Vec_WrdFreeP( &p->vSimsPi );
+    if ( p->vNamesIn )
+        Vec_PtrFreeFree( p->vNamesIn ), p->vNamesIn = NULL;
+    if ( p->vNamesOut )
+        Vec_PtrFreeFree( p->vNamesOut ), p->vNamesOut = NULL;
+    Vec_FltFreeP( &p->vInArrs );
+    Vec_FltFreeP( &p->vOutReqs );
+    Vec_IntFreeP( &p->vUserPiIds );
+    Vec_IntFreeP( &p->vUserPoIds );
+    Vec_IntFreeP( &p->vUserFfIds );
+    Vec_IntFreeP( &p->vFlopClasses );
+    Vec_IntFreeP( &p->vInitClasses );
+    Vec_IntFreeP( &p->vRegClasses );
+    Vec_IntFreeP( &p->vRegInits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes marked objects without duplicating the manager.]
+
+  Description [This is the in-place counterpart of Gia_ManDupMarked().
+  Objects with fMark0 set are dropped. The remaining objects keep their
+  relative order and are moved down inside the same object array, so 
+  each object is written only after it has been read. The CI/CO arrays, 
+  the register count, MUX controls, equivalences and choices are remapped, 
+  the object storage is shrunk to the new size, and the other object-
+  indexed data is freed (it would be lost by Gia_ManDupMarked() as well). 
+  Returns the number of removed objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManCompactMarked( Gia_Man_t * p )
+{
+    Gia_Obj_t Obj, * pObj;
+    int nObjsOld = Gia_ManObjNum(p);
+    int nCis = Gia_ManCiNum(p), nPis = Gia_ManPiNum(p);
+    int nCos = Gia_ManCoNum(p), nPos = Gia_ManPoNum(p);
+    int fReprs = (p->pReprs && p->pNexts);
+    int * pMap, i, iNew = 1, iRepr, iSibl, nRos = 0, nRis = 0, fCioChange = 0;
+    unsigned Mux;
+    assert( !Gia_ManConst0(p)->fMark0 );
+    pMap = ABC_FALLOC( int, nObjsOld );
+    pMap[0] = 0;
+    Gia_ManConst0(p)->fMark1 = 0;
+    if ( fReprs )
+        Gia_ObjSetRepr( p, 0, GIA_VOID );
+    Vec_IntClear( p->vCis );
+    Vec_IntClear( p->vCos );
+    for ( i = 1; i < nObjsOld; i++ )
+    {
+        pObj = Gia_ManObj( p, i );
+        if ( pObj->fMark0 )
+        {
+            assert( !Gia_ObjIsBuf(pObj) );
+            continue;
+        }
+        Obj = *pObj;
+        pMap[i] = iNew;
+        pObj = Gia_ManObj( p, iNew );
+        *pObj = Obj;
+        pObj->fMark1 = 0;
+        if ( Gia_ObjIsCi(&Obj) )
+        {
+            nRos += (Gia_ObjCioId(&Obj) >= nPis);
+            fCioChange |= (Gia_ObjCioId(&Obj) != Vec_IntSize(p->vCis));
+            Gia_ObjSetCioId( pObj, Vec_IntSize(p->vCis) );
+            Vec_IntPush( p->vCis, iNew );
+        }
+        else if ( Gia_ObjIsCo(&Obj) )
+        {
+            assert( pMap[i - Obj.iDiff0] >= 0 );
+            pObj->iDiff0 = iNew - pMap[i - Obj.iDiff0];
+            nRis += (Gia_ObjCioId(&Obj) >= nPos);
+            fCioChange |= (Gia_ObjCioId(&Obj) != Vec_IntSize(p->vCos));
+            Gia_ObjSetCioId( pObj, Vec_IntSize(p->vCos) );
+            Vec_IntPush( p->vCos, iNew );
+        }
+        else if ( Gia_ObjIsAnd(&Obj) )
+        {
+            assert( pMap[i - Obj.iDiff0] >= 0 && pMap[i - Obj.iDiff1] >= 0 );
+            pObj->iDiff0 = iNew - pMap[i - Obj.iDiff0];
+            pObj->iDiff1 = iNew - pMap[i - Obj.iDiff1];
+        }
+        if ( p->pMuxes )
+        {
+            Mux = p->pMuxes[i];
+            assert( Mux == 0 || pMap[Abc_Lit2Var(Mux)] >= 0 );
+            p->pMuxes[iNew] = Mux ? Abc_Var2Lit( pMap[Abc_Lit2Var(Mux)], Abc_LitIsCompl(Mux) ) : 0;
+        }
+        if ( fReprs )
+        {
+            iRepr = Gia_ObjRepr( p, i );
+            memset( p->pReprs + iNew, 0, sizeof(Gia_Rpr_t) );
+            Gia_ObjSetRepr( p, iNew, (iRepr != GIA_VOID && pMap[iRepr] >= 0) ? pMap[iRepr] : GIA_VOID );
+        }
+        if ( p->pSibls )
+        {
+            iSibl = p->pSibls[i];
+            p->pSibls[iNew] = (iSibl && pMap[iSibl] >= 0) ? pMap[iSibl] : 0;
+        }
+        iNew++;
+    }
+    ABC_FREE( pMap );
+    assert( nRos == nRis );
+    fCioChange |= (Gia_ManCiNum(p) != nCis || Gia_ManCoNum(p) != nCos);
+    p->nRegs = nRos;
+    // shrink the storage
+    p->nObjs = p->nObjsAlloc = iNew;
+    p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, p->nObjsAlloc );
+    if ( p->pMuxes )
+        p->pMuxes = ABC_REALLOC( unsigned, p->pMuxes, p->nObjsAlloc );
+    if ( p->pSibls )
+        p->pSibls = ABC_REALLOC( int, p->pSibls, p->nObjsAlloc );
+    if ( fReprs )
+    {
+        p->pReprs = ABC_REALLOC( Gia_Rpr_t, p->pReprs, p->nObjsAlloc );
+        ABC_FREE( p->pNexts );
+        p->pNexts = Gia_ManDeriveNexts( p );
+    }
+    else
+        ABC_FREE( p->pReprs );
+    Gia_ManCompactFreeData( p, fCioChange );
+    return nObjsOld - iNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs combinational cleanup in place.]
+
+  Description [Similar to Gia_ManCleanup() but updates the given manager
+  instead of returning a cleaned-up copy. Returns the number of removed
+  objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManCleanupInPlace( Gia_Man_t * p )
+{
+    Gia_ManCombMarkUsed( p );
+    return Gia_ManCompactMarked( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs sequential cleanup in place.]
+
+  Description [Similar to Gia_ManSeqCleanup() but updates the given 
+  manager. Returns the number of removed objects.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSeqCleanupInPlace( Gia_Man_t * p )
+{
+    Gia_ManSeqMarkUsed( p );
+    return Gia_ManCompactMarked( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Find representatives due to identical fanins.]
@@ -258,6 +473,7 @@ Gia_Man_t * Gia_ManReduceEquiv( Gia_Man_t * p, int fVerbose )
 Gia_Man_t * Gia_ManSeqStructSweep( Gia_Man_t * p, int fConst, int fEquiv, int fVerbose )
 {
     Gia_Man_t * pTemp;
+    int nRegs, nAnds;
     if ( Gia_ManRegNum(p) == 0 )
         return Gia_ManCleanup( p );
     if ( fVerbose )
@@ -277,10 +493,12 @@ Gia_Man_t * Gia_ManSeqStructSweep( Gia_Man_t * p, int fConst, int fEquiv, int fV
     if ( fEquiv )
     while ( 1 )
     {
-        p = Gia_ManSeqCleanup( pTemp = p );
+        // the current manager is owned here, so it can be cleaned up in place
+        nRegs = Gia_ManRegNum(p);
+        nAnds = Gia_ManAndNum(p);
+        Gia_ManSeqCleanupInPlace( p );
         if ( fVerbose )
-            Gia_ManReportImprovement( pTemp, p );
-        Gia_ManStop( pTemp );
+            Gia_ManReportImprovementNum( nRegs, nAnds, p );
         if ( Gia_ManRegNum(p) == 0 )
             break;
         p = Gia_ManReduceEquiv( pTemp = p, fVerbose );
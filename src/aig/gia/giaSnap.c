@@ -0,0 +1,247 @@
+/**CFile****************************************************************
+
+  FileName    [giaSnap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Compressed in-memory snapshots of the AIG.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaSnap.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/zlib/zlib.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the AIG can be snapshot as compressed AIGER.]
+
+  Description [The snapshot is restored by the AIGER reader, which
+  reproduces object IDs only for a normalized AIG without buffers,
+  choices and MUXes. Attributes not serialized below (packing, timing,
+  boxes, register classes, etc) require a full copy.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SnapCanCompress( Gia_Man_t * p )
+{
+    if ( !Gia_ManIsNormalized(p) || Gia_ManHasChoices(p) || Gia_ManBufNum(p) || p->pMuxes )
+        return 0;
+    if ( p->pCexSeq || p->vPacking || p->pManTime || p->pAigExtra || p->vRegClasses ||
+         p->vRegInits || p->vConfigs || p->pCellStr )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a snapshot of the AIG.]
+
+  Description [The data is the binary AIGER of the AIG followed by
+  the LUT mapping (if present) written in the object order, which is
+  the layout produced by Gia_ManTransferMapping(). The data is
+  compressed using zlib. If the AIG cannot be compressed or if
+  fCompress is 0, keeps a full copy instead.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Snap_t * Gia_SnapStart( Gia_Man_t * p, int fCompress )
+{
+    Gia_Snap_t * pSnap;
+    Vec_Str_t * vData;
+    Vec_Int_t * vMap = NULL;
+    uLongf nZipSize;
+    int i, k, iFan;
+    pSnap = ABC_CALLOC( Gia_Snap_t, 1 );
+    pSnap->pName = Abc_UtilStrsav( Gia_ManName(p) );
+    pSnap->nPis  = Gia_ManPiNum(p);
+    pSnap->nPos  = Gia_ManPoNum(p);
+    pSnap->nRegs = Gia_ManRegNum(p);
+    pSnap->nObjs = Gia_ManObjNum(p);
+    if ( !fCompress || !Gia_SnapCanCompress(p) )
+    {
+        pSnap->pGia = Gia_ManDupWithAttributes( p );
+        return pSnap;
+    }
+    vData = Gia_AigerWriteIntoMemoryStr( p );
+    pSnap->nAiger = Vec_StrSize( vData );
+    if ( Gia_ManHasMapping(p) )
+    {
+        vMap = Vec_IntAlloc( 2 * Gia_ManObjNum(p) );
+        Vec_IntFill( vMap, Gia_ManObjNum(p), 0 );
+        Gia_ManForEachLut( p, i )
+        {
+            Vec_IntWriteEntry( vMap, i, Vec_IntSize(vMap) );
+            Vec_IntPush( vMap, Gia_ObjLutSize(p, i) );
+            Gia_LutForEachFanin( p, i, iFan, k )
+                Vec_IntPush( vMap, iFan );
+            Vec_IntPush( vMap, Gia_ObjLutMuxId(p, i) );
+        }
+        pSnap->nMapping = Vec_IntSize( vMap );
+        Vec_StrPushBuffer( vData, (char *)Vec_IntArray(vMap), sizeof(int) * Vec_IntSize(vMap) );
+        Vec_IntFree( vMap );
+    }
+    pSnap->pSpec      = Abc_UtilStrsav( p->pSpec );
+    pSnap->nAnd2Delay = p->nAnd2Delay;
+    pSnap->nDataRaw   = Vec_StrSize( vData );
+    nZipSize          = compressBound( (uLong)Vec_StrSize(vData) );
+    pSnap->pData      = ABC_ALLOC( char, nZipSize );
+    if ( compress2( (Bytef *)pSnap->pData, &nZipSize, (const Bytef *)Vec_StrArray(vData), (uLong)Vec_StrSize(vData), Z_BEST_SPEED ) != Z_OK )
+    {
+        ABC_FREE( pSnap->pData );
+        pSnap->pGia = Gia_ManDupWithAttributes( p );
+    }
+    else
+    {
+        pSnap->nData = (int)nZipSize;
+        pSnap->pData = ABC_REALLOC( char, pSnap->pData, pSnap->nData );
+    }
+    Vec_StrFree( vData );
+    return pSnap;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores a fresh copy of the AIG from the snapshot.]
+
+  Description [The snapshot is not changed and can be restored again.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_SnapRestore( Gia_Snap_t * pSnap )
+{
+    Gia_Man_t * pNew;
+    char * pBuffer;
+    uLongf nSize;
+    if ( pSnap->pGia )
+        return Gia_ManDupWithAttributes( pSnap->pGia );
+    pBuffer = ABC_ALLOC( char, pSnap->nDataRaw );
+    nSize = (uLongf)pSnap->nDataRaw;
+    if ( uncompress( (Bytef *)pBuffer, &nSize, (const Bytef *)pSnap->pData, (uLong)pSnap->nData ) != Z_OK || (int)nSize != pSnap->nDataRaw )
+    {
+        printf( "Gia_SnapRestore(): Decompressing the snapshot has failed.\n" );
+        ABC_FREE( pBuffer );
+        return NULL;
+    }
+    pNew = Gia_AigerReadFromMemory( pBuffer, pSnap->nAiger, 1, 0 );
+    assert( Gia_ManObjNum(pNew) == pSnap->nObjs );
+    ABC_FREE( pNew->pName );
+    pNew->pName = Abc_UtilStrsav( pSnap->pName );
+    pNew->pSpec = Abc_UtilStrsav( pSnap->pSpec );
+    pNew->nAnd2Delay = pSnap->nAnd2Delay;
+    if ( pSnap->nMapping )
+    {
+        pNew->vMapping = Vec_IntStart( pSnap->nMapping );
+        memcpy( Vec_IntArray(pNew->vMapping), pBuffer + pSnap->nAiger, sizeof(int) * pSnap->nMapping );
+    }
+    ABC_FREE( pBuffer );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the snapshot.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SnapStop( Gia_Snap_t * pSnap )
+{
+    if ( pSnap->pGia )
+        Gia_ManStop( pSnap->pGia );
+    ABC_FREE( pSnap->pData );
+    ABC_FREE( pSnap->pName );
+    ABC_FREE( pSnap->pSpec );
+    ABC_FREE( pSnap );
+}
+void Gia_SnapStopP( Gia_Snap_t ** ppSnap )
+{
+    if ( *ppSnap == NULL )
+        return;
+    Gia_SnapStop( *ppSnap );
+    *ppSnap = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the memory used by the snapshot in bytes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+double Gia_SnapMemory( Gia_Snap_t * pSnap )
+{
+    if ( pSnap->pGia )
+        return sizeof(Gia_Snap_t) + Gia_ManMemory(pSnap->pGia) + (Gia_ManHasMapping(pSnap->pGia) ? 4.0 * Vec_IntCap(pSnap->pGia->vMapping) : 0);
+    return sizeof(Gia_Snap_t) + pSnap->nData;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the snapshot.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SnapPrint( Gia_Snap_t * pSnap )
+{
+    printf( "%-8s : ", pSnap->pName );
+    printf( "i/o =%7d/%7d  ", pSnap->nPis, pSnap->nPos );
+    if ( pSnap->nRegs )
+        printf( "ff =%7d  ", pSnap->nRegs );
+    printf( "obj =%9d  ", pSnap->nObjs );
+    if ( pSnap->pGia )
+        printf( "full copy  " );
+    else
+        printf( "zip =%6.2f x  ", pSnap->nData ? 1.0 * (pSnap->nObjs * sizeof(Gia_Obj_t) + 4.0 * pSnap->nMapping) / pSnap->nData : 0.0 );
+    printf( "mem =%8.2f MB\n", Gia_SnapMemory(pSnap) / (1<<20) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "abc.h"
+#include "abcInt.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -328,6 +329,89 @@ int Abc_ObjFanoutFaninNum( Abc_Obj_t * pFanout, Abc_Obj_t * pFanin )
     return -1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Copies one fanin/fanout array into the new memory manager.]
+
+  Description [The capacity is rounded up to a power of two (at least 2)
+  to stay compatible with the growth and recycling in Vec_IntPushMem().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_NtkCompactFanioArray( Mem_Step_t * pMemMan, Vec_Int_t * p )
+{
+    int * pArray, nCap, i;
+    if ( p->nSize == 0 )
+    {
+        p->nCap   = 0;
+        p->pArray = NULL;
+        return;
+    }
+    for ( nCap = 2; nCap < p->nSize; nCap *= 2 );
+    pArray = (int *)Mem_StepEntryFetch( pMemMan, nCap * 4 );
+    for ( i = 0; i < p->nSize; i++ )
+        pArray[i] = p->pArray[i];
+    p->nCap   = nCap;
+    p->pArray = pArray;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if much of the fanin/fanout memory is unused.]
+
+  Description [Repeated restructuring grows and recycles the fanin/fanout
+  arrays, leaving free entries scattered across the memory manager
+  and the large arrays that are never reclaimed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkFanioIsFragmented( Abc_Ntk_t * pNtk )
+{
+    ABC_INT64_T nMemAlloc, nMemUsed;
+    if ( pNtk->pMmStep == NULL )
+        return 0;
+    nMemAlloc = Mem_StepReadMemAlloc( pNtk->pMmStep );
+    nMemUsed  = Mem_StepReadMemUsed( pNtk->pMmStep );
+    return nMemAlloc > (1 << 20) && nMemAlloc - nMemUsed > nMemAlloc / 4;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the fanin/fanout arrays into a fresh memory manager.]
+
+  Description [The arrays are copied in the order of object IDs, so that
+  the arrays of the neighboring objects are adjacent in memory, while
+  the old memory manager, including the recycled entries, is released.
+  The fanin/fanout lists themselves are not changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkCompactFanio( Abc_Ntk_t * pNtk )
+{
+    Mem_Step_t * pMemMan;
+    Abc_Obj_t * pObj;
+    int i;
+    if ( pNtk->pMmStep == NULL )
+        return;
+    pMemMan = Mem_StepStart( ABC_NUM_STEPS );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        Abc_NtkCompactFanioArray( pMemMan, &pObj->vFanins );
+        Abc_NtkCompactFanioArray( pMemMan, &pObj->vFanouts );
+    }
+    Mem_StepStop( pNtk->pMmStep, 0 );
+    pNtk->pMmStep = pMemMan;
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
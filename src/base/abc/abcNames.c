@@ -72,6 +72,25 @@ char * Abc_ObjAssignName( Abc_Obj_t * pObj, char * pName, char * pSuffix )
     return Nm_ManStoreIdName( pObj->pNtk->pManName, pObj->Id, pObj->Type, pName, pSuffix );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Assigns the name of one object to another object.]
+
+  Description [Same as Abc_ObjAssignName( pObj, Abc_ObjName(pObjOld), NULL ),
+  but if the old object has a name, the name manager copies the handle 
+  of the name instead of the string.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_ObjCopyName( Abc_Obj_t * pObj, Abc_Obj_t * pObjOld )
+{
+    if ( Nm_ManCopyIdName( pObj->pNtk->pManName, pObj->Id, pObj->Type, pObjOld->pNtk->pManName, pObjOld->Id ) == 0 )
+        Abc_ObjAssignName( pObj, Abc_ObjName(pObjOld), NULL );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Appends name to the prefix]
@@ -148,11 +167,11 @@ void Abc_NtkTrasferNames( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkNew )
     assert( Nm_ManNumEntries(pNtkNew->pManName) == 0 );
     // copy the CI/CO/box names
     Abc_NtkForEachCi( pNtk, pObj, i )
-        Abc_ObjAssignName( pObj->pCopy, Abc_ObjName(Abc_ObjFanout0Ntk(pObj)), NULL );
+        Abc_ObjCopyName( pObj->pCopy, Abc_ObjFanout0Ntk(pObj) );
     Abc_NtkForEachCo( pNtk, pObj, i ) 
-        Abc_ObjAssignName( pObj->pCopy, Abc_ObjName(Abc_ObjFanin0Ntk(pObj)), NULL );
+        Abc_ObjCopyName( pObj->pCopy, Abc_ObjFanin0Ntk(pObj) );
     Abc_NtkForEachBox( pNtk, pObj, i ) 
-        Abc_ObjAssignName( pObj->pCopy, Abc_ObjName(pObj), NULL );
+        Abc_ObjCopyName( pObj->pCopy, pObj );
 }
 
 /**Function*************************************************************
@@ -177,13 +196,13 @@ void Abc_NtkTrasferNamesNoLatches( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkNew )
     // copy the CI/CO/box name and skip latches and theirs inputs/outputs
     Abc_NtkForEachCi( pNtk, pObj, i )
         if ( Abc_ObjFaninNum(pObj) == 0 || !Abc_ObjIsLatch(Abc_ObjFanin0(pObj)) )
-            Abc_ObjAssignName( pObj->pCopy, Abc_ObjName(Abc_ObjFanout0Ntk(pObj)), NULL );
+            Abc_ObjCopyName( pObj->pCopy, Abc_ObjFanout0Ntk(pObj) );
     Abc_NtkForEachCo( pNtk, pObj, i ) 
         if ( Abc_ObjFanoutNum(pObj) == 0 || !Abc_ObjIsLatch(Abc_ObjFanout0(pObj)) )
-            Abc_ObjAssignName( pObj->pCopy, Abc_ObjName(Abc_ObjFanin0Ntk(pObj)), NULL );
+            Abc_ObjCopyName( pObj->pCopy, Abc_ObjFanin0Ntk(pObj) );
     Abc_NtkForEachBox( pNtk, pObj, i ) 
         if ( !Abc_ObjIsLatch(pObj) )
-            Abc_ObjAssignName( pObj->pCopy, Abc_ObjName(pObj), NULL );
+            Abc_ObjCopyName( pObj->pCopy, pObj );
 }
 
 /**Function*************************************************************
@@ -492,7 +511,7 @@ void Abc_NtkAddDummyPiNames( Abc_Ntk_t * pNtk )
     int nDigits, i;
     nDigits = Abc_Base10Log( Abc_NtkPiNum(pNtk) );
     Abc_NtkForEachPi( pNtk, pObj, i )
-        Abc_ObjAssignName( pObj, Abc_ObjNameDummy("pi", i, nDigits), NULL );
+        Nm_ManStoreIdNameDummy( pNtk->pManName, pObj->Id, pObj->Type, "pi", i, nDigits );
 }
 
 /**Function*************************************************************
@@ -512,7 +531,7 @@ void Abc_NtkAddDummyPoNames( Abc_Ntk_t * pNtk )
     int nDigits, i;
     nDigits = Abc_Base10Log( Abc_NtkPoNum(pNtk) );
     Abc_NtkForEachPo( pNtk, pObj, i )
-        Abc_ObjAssignName( pObj, Abc_ObjNameDummy("po", i, nDigits), NULL );
+        Nm_ManStoreIdNameDummy( pNtk->pManName, pObj->Id, pObj->Type, "po", i, nDigits );
 }
 
 /**Function*************************************************************
@@ -568,9 +587,9 @@ void Abc_NtkAddDummyBoxNames( Abc_Ntk_t * pNtk )
     nDigits = Abc_Base10Log( Abc_NtkLatchNum(pNtk) );
     Abc_NtkForEachLatch( pNtk, pObj, i )
     {
-        Abc_ObjAssignName( pObj, Abc_ObjNameDummy("l", i, nDigits), NULL );
-        Abc_ObjAssignName( Abc_ObjFanin0(pObj),  Abc_ObjNameDummy(PrefLi, i, nDigits), NULL );
-        Abc_ObjAssignName( Abc_ObjFanout0(pObj), Abc_ObjNameDummy(PrefLo, i, nDigits), NULL );
+        Nm_ManStoreIdNameDummy( pNtk->pManName, pObj->Id, pObj->Type, "l", i, nDigits );
+        Nm_ManStoreIdNameDummy( pNtk->pManName, Abc_ObjFanin0(pObj)->Id, Abc_ObjFanin0(pObj)->Type, PrefLi, i, nDigits );
+        Nm_ManStoreIdNameDummy( pNtk->pManName, Abc_ObjFanout0(pObj)->Id, Abc_ObjFanout0(pObj)->Type, PrefLo, i, nDigits );
     }
 /*
     nDigits = Abc_Base10Log( Abc_NtkBlackboxNum(pNtk) );
@@ -1162,7 +1162,7 @@ Abc_Ntk_t * Abc_NtkCreateTarget( Abc_Ntk_t * pNtk, Vec_Ptr_t * vRoots, Vec_Int_t
     Abc_NtkForEachCi( pNtk, pObj, i )
     {
         pObj->pCopy = Abc_NtkCreatePi(pNtkNew);
-        Abc_ObjAssignName( pObj->pCopy, Abc_ObjName(pObj), NULL );
+        Abc_ObjCopyName( pObj->pCopy, pObj );
     }
     // copy the nodes
     Vec_PtrForEachEntry( Abc_Obj_t *, vNodes, pObj, i )
@@ -86,6 +86,12 @@ void Abc_ObjRecycle( Abc_Obj_t * pObj )
         ABC_FREE( pObj->vFanouts.pArray );
         ABC_FREE( pObj->vFanins.pArray );
     }
+    else
+    {
+        // return the arrays to the manager, so that Mem_StepReadMemUsed() counts only the live ones
+        Mem_StepEntryRecycle( pNtk->pMmStep, (char *)pObj->vFanouts.pArray, pObj->vFanouts.nCap * 4 );
+        Mem_StepEntryRecycle( pNtk->pMmStep, (char *)pObj->vFanins.pArray, pObj->vFanins.nCap * 4 );
+    }
     // clean the memory to make deleted object distinct from the live one
     memset( pObj, 0, sizeof(Abc_Obj_t) );
     // recycle the object
@@ -350,23 +356,23 @@ Abc_Obj_t * Abc_NtkDupObj( Abc_Ntk_t * pNtkNew, Abc_Obj_t * pObj, int fCopyName
         if ( Abc_ObjIsCi(pObj) )
         {
             if ( !Abc_NtkIsNetlist(pNtkNew) )
-                Abc_ObjAssignName( pObjNew, Abc_ObjName(Abc_ObjFanout0Ntk(pObj)), NULL );
+                Abc_ObjCopyName( pObjNew, Abc_ObjFanout0Ntk(pObj) );
         }
         else if ( Abc_ObjIsCo(pObj) )
         {
             if ( !Abc_NtkIsNetlist(pNtkNew) )
             {
                 if ( Abc_ObjIsPo(pObj) )
-                    Abc_ObjAssignName( pObjNew, Abc_ObjName(Abc_ObjFanin0Ntk(pObj)), NULL );
+                    Abc_ObjCopyName( pObjNew, Abc_ObjFanin0Ntk(pObj) );
                 else
                 {
                     assert( Abc_ObjIsLatch(Abc_ObjFanout0(pObj)) );
-                    Abc_ObjAssignName( pObjNew, Abc_ObjName(pObj), NULL );
+                    Abc_ObjCopyName( pObjNew, pObj );
                 }
             }
         }
         else if ( Abc_ObjIsBox(pObj) || Abc_ObjIsNet(pObj) )
-            Abc_ObjAssignName( pObjNew, Abc_ObjName(pObj), NULL );
+            Abc_ObjCopyName( pObjNew, pObj );
     }
     // copy functionality/names
     if ( Abc_ObjIsNode(pObj) ) // copy the function if functionality is compatible
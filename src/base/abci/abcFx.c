@@ -23,6 +23,17 @@
 #include "misc/vec/vecQue.h"
 #include "misc/vec/vecHsh.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -82,17 +93,25 @@ ABC_NAMESPACE_IMPL_START
 
 */
 
+#define FX_DIVS_COMPACT 100000  // the smallest number of divisors to consider compaction
+#define FX_PAR_PAIRS    (1<<16) // the number of cube pairs processed by a thread in one job
+#define FX_DIVS_START   (1<<24) // the largest number of divisors to preallocate
+#define PAR_THR_MAX     100
+
 typedef struct Fx_Man_t_ Fx_Man_t;
 struct Fx_Man_t_
 {
     // user's data
     Vec_Wec_t *     vCubes;     // cube -> lit
     int             LitCountMax;// max size of divisor to extract
+    int             nProcs;     // the number of threads to create the divisors
     // internal data
     Vec_Wec_t *     vLits;      // lit -> cube
     Vec_Int_t *     vCounts;    // literal counts (currently not used)
     Hsh_VecMan_t *  pHash;      // hash table for normalized divisors
     Vec_Flt_t *     vWeights;   // divisor weights
+    Vec_Int_t *     vDivPairs;  // the number of cube pairs of each divisor
+    int             nDivsLive;  // the number of divisors with cube pairs
     Vec_Que_t *     vPrio;      // priority queue for divisors by weight
     Vec_Int_t *     vVarCube;   // mapping ObjId into its first cube
     Vec_Int_t *     vLevels;    // variable levels
@@ -114,7 +133,28 @@ struct Fx_Man_t_
     int             nDivMux[3]; // 0 = mux, 1 = compl mux, 2 = no mux
 };
 
+typedef struct Fx_ParThData_t_ Fx_ParThData_t;
+struct Fx_ParThData_t_
+{
+    Fx_Man_t *      p;          // the manager (read-only)
+    int             iStart;     // the first pivot cube of the job
+    int             iStop;      // the cube following the last pivot cube
+    Vec_Int_t *     vRecs;      // divisor records (size, base, literals)
+    Vec_Int_t *     vCubeFree;  // cube-free divisor
+    int             nDivMux[3]; // divisor statistics
+    int             fWarning;   // the warning is printed
+    int             fWorking;   // the thread is busy
+};
+
 static inline int Fx_ManGetFirstVarCube( Fx_Man_t * p, Vec_Int_t * vCube ) { return Vec_IntEntry( p->vVarCube, Vec_IntEntry(vCube, 0) ); }
+static inline int Fx_ManGetCubeVar( Vec_Wec_t * vCubes, int iCube )         { return Vec_IntEntry( Vec_WecEntry(vCubes, iCube), 0 );      }
+static inline void Fx_ManAddDivPairs( Fx_Man_t * p, int iDiv, int nPairs )
+{
+    int * pPairs = Vec_IntEntryP( p->vDivPairs, iDiv );
+    p->nDivsLive -= (*pPairs != 0);
+    *pPairs += nPairs;
+    p->nDivsLive += (*pPairs != 0);
+}
 
 #define Fx_ManForEachCubeVec( vVec, vCubes, vCube, i )           \
     for ( i = 0; (i < Vec_IntSize(vVec)) && ((vCube) = Vec_WecEntry(vCubes, Vec_IntEntry(vVec, i))); i++ )
@@ -300,9 +340,9 @@ int Abc_NtkFxCheck( Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int fVerbose, int fVeryVerbose )
+int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int nProcs, int fVerbose, int fVeryVerbose )
 {
-    extern int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fVerbose, int fVeryVerbose );
+    extern int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int nProcs, int fVerbose, int fVeryVerbose );
     Vec_Wec_t * vCubes;
     assert( Abc_NtkIsSopLogic(pNtk) );
     // check unique fanins
@@ -319,7 +359,7 @@ int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int f
     // collect information about the covers
     vCubes = Abc_NtkFxRetrieve( pNtk );
     // call the fast extract procedure
-    if ( Fx_FastExtract( vCubes, Abc_NtkObjNumMax(pNtk), nNewNodesMax, LitCountMax, fVerbose, fVeryVerbose ) > 0 )
+    if ( Fx_FastExtract( vCubes, Abc_NtkObjNumMax(pNtk), nNewNodesMax, LitCountMax, nProcs, fVerbose, fVeryVerbose ) > 0 )
     {
         // update the network
         Abc_NtkFxInsert( pNtk, vCubes );
@@ -367,6 +407,7 @@ void Fx_ManStop( Fx_Man_t * p )
     Vec_IntFree( p->vCounts );
     Hsh_VecManStop( p->pHash );
     Vec_FltFree( p->vWeights );
+    Vec_IntFree( p->vDivPairs );
     Vec_QueFree( p->vPrio );
     Vec_IntFree( p->vVarCube );
     Vec_IntFree( p->vLevels );
@@ -797,23 +838,26 @@ int Fx_ManCubeSingleCubeDivisors( Fx_Man_t * p, Vec_Int_t * vPivot, int fRemove,
             if ( Vec_FltSize(p->vWeights) == iDiv )
             {
                 Vec_FltPush(p->vWeights, -2 + 0.9 - 0.001 * Fx_ManComputeLevelDiv(p, p->vCubeFree));
+                Vec_IntPush(p->vDivPairs, 0);
                 p->nDivsS++;
             }
             assert( iDiv < Vec_FltSize(p->vWeights) );
             Vec_FltAddToEntry( p->vWeights, iDiv, 1 );
+            Fx_ManAddDivPairs( p, iDiv, 1 );
             p->nPairsS++;
         }
         else
         {
             assert( iDiv < Vec_FltSize(p->vWeights) );
             Vec_FltAddToEntry( p->vWeights, iDiv, -1 );
+            Fx_ManAddDivPairs( p, iDiv, -1 );
             p->nPairsS--;
         }
         if ( fUpdate )
         {
             if ( Vec_QueIsMember(p->vPrio, iDiv) )
                 Vec_QueUpdate( p->vPrio, iDiv );
-            else if ( !fRemove )
+            else if ( !fRemove && Vec_FltEntry(p->vWeights, iDiv) > 0.0 )
                 Vec_QuePush( p->vPrio, iDiv );
         }
     }
@@ -848,42 +892,255 @@ void Fx_ManCubeDoubleCubeDivisors( Fx_Man_t * p, int iFirst, Vec_Int_t * vPivot,
         if ( !fRemove )
         {
             if ( iDiv == Vec_FltSize(p->vWeights) )
+            {
                 Vec_FltPush(p->vWeights, -Vec_IntSize(p->vCubeFree) + 0.9 - 0.0009 * Fx_ManComputeLevelDiv(p, p->vCubeFree));
+                Vec_IntPush(p->vDivPairs, 0);
+            }
             assert( iDiv < Vec_FltSize(p->vWeights) );
             Vec_FltAddToEntry( p->vWeights, iDiv, Base + Vec_IntSize(p->vCubeFree) - 1 );
+            Fx_ManAddDivPairs( p, iDiv, 1 );
             p->nPairsD++;
         }
         else
         {
             assert( iDiv < Vec_FltSize(p->vWeights) );
             Vec_FltAddToEntry( p->vWeights, iDiv, -(Base + Vec_IntSize(p->vCubeFree) - 1) );
+            Fx_ManAddDivPairs( p, iDiv, -1 );
             p->nPairsD--;
         }
         if ( fUpdate )
         {
             if ( Vec_QueIsMember(p->vPrio, iDiv) )
                 Vec_QueUpdate( p->vPrio, iDiv );
-            else if ( !fRemove )
+            else if ( !fRemove && Vec_FltEntry(p->vWeights, iDiv) > 0.0 )
                 Vec_QuePush( p->vPrio, iDiv );
         }
     } 
 }
+/**Function*************************************************************
+
+  Synopsis    [Creates two-cube divisors using several threads.]
+
+  Description [The pivot cubes are split into jobs with roughly the same
+  number of cube pairs. For each job, a thread computes the cube-free
+  divisors of the pairs and records them without touching the hash table.
+  The records are added to the hash table in the main thread in the order
+  of the cubes, so the divisors get the same numbers and weights as when
+  they are created by one thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Fx_ManParCollectJob( Fx_ParThData_t * pThData )
+{
+    Fx_Man_t * p = pThData->p;
+    Vec_Int_t * vCube, * vPivot, * vCubeFree = pThData->vCubeFree;
+    int i, k, Value, Base;
+    Vec_IntClear( pThData->vRecs );
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+    {
+        vPivot = Vec_WecEntry( p->vCubes, i );
+        Vec_WecForEachLevelStart( p->vCubes, vCube, k, i+1 )
+        {
+            if ( Vec_IntSize(vCube) == 0 )
+                continue;
+            if ( Vec_IntEntry(vCube, 0) != Vec_IntEntry(vPivot, 0) )
+                break;
+            Base = Fx_ManDivFindCubeFree( vCube, vPivot, vCubeFree, &pThData->fWarning );
+            if ( Vec_IntSize(vCubeFree) == 4 )
+            { 
+                Value = Fx_ManDivNormalize( vCubeFree );
+                if ( Value == 0 )
+                    pThData->nDivMux[0]++;
+                else if ( Value == 1 )
+                    pThData->nDivMux[1]++;
+                else
+                    pThData->nDivMux[2]++;
+            }
+            if ( p->LitCountMax && p->LitCountMax < Vec_IntSize(vCubeFree) )
+                continue;
+            Vec_IntPush( pThData->vRecs, Vec_IntSize(vCubeFree) );
+            Vec_IntPush( pThData->vRecs, Base );
+            Vec_IntAppend( pThData->vRecs, vCubeFree );
+        }
+    }
+}
+void Fx_ManParAddJob( Fx_Man_t * p, Fx_ParThData_t * pThData )
+{
+    Vec_Int_t vCubeFree;
+    int * pRec, * pStop, iDiv, Base;
+    pRec  = Vec_IntArray( pThData->vRecs );
+    pStop = Vec_IntLimit( pThData->vRecs );
+    for ( ; pRec < pStop; pRec += 2 + vCubeFree.nSize )
+    {
+        vCubeFree.nSize = vCubeFree.nCap = pRec[0];
+        vCubeFree.pArray = pRec + 2;
+        Base = pRec[1];
+        iDiv = Hsh_VecManAdd( p->pHash, &vCubeFree );
+        if ( iDiv == Vec_FltSize(p->vWeights) )
+        {
+            Vec_FltPush(p->vWeights, -Vec_IntSize(&vCubeFree) + 0.9 - 0.0009 * Fx_ManComputeLevelDiv(p, &vCubeFree));
+            Vec_IntPush(p->vDivPairs, 0);
+        }
+        assert( iDiv < Vec_FltSize(p->vWeights) );
+        Vec_FltAddToEntry( p->vWeights, iDiv, Base + Vec_IntSize(&vCubeFree) - 1 );
+        Fx_ManAddDivPairs( p, iDiv, 1 );
+        p->nPairsD++;
+    }
+    p->nDivMux[0] += pThData->nDivMux[0];
+    p->nDivMux[1] += pThData->nDivMux[1];
+    p->nDivMux[2] += pThData->nDivMux[2];
+    memset( pThData->nDivMux, 0, sizeof(int) * 3 );
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Fx_ManCreateDivisorsPar( Fx_Man_t * p, int * fWarning )
+{
+    Vec_Int_t * vCube;
+    int i;
+    Vec_WecForEachLevel( p->vCubes, vCube, i )
+        Fx_ManCubeDoubleCubeDivisors( p, i+1, vCube, 0, 0, fWarning ); // add - no update
+}
+
+#else // pthreads are used
+
+void * Fx_ManParWorkerThread( void * pArg )
+{
+    Fx_ParThData_t * pThData = (Fx_ParThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->iStart == -1 )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Fx_ManParCollectJob( pThData );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+void Fx_ManCreateDivisorsPar( Fx_Man_t * p, int * fWarning )
+{
+    Fx_ParThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    int nProcs = Abc_MinInt( p->nProcs, PAR_THR_MAX );
+    int i, k, status, nPairs, iNext = 0, iStop = 0;
+    // start the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Fx_ParThData_t) );
+        ThData[i].p         = p;
+        ThData[i].iStart    = -1;
+        ThData[i].vRecs     = Vec_IntAlloc( 1000 );
+        ThData[i].vCubeFree = Vec_IntAlloc( 100 );
+        status = pthread_create( WorkerThread + i, NULL, Fx_ManParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // process the cubes in batches of jobs
+    while ( iNext < Vec_WecSize(p->vCubes) )
+    {
+        for ( i = 0; i < nProcs && iNext < Vec_WecSize(p->vCubes); i++ )
+        {
+            // the pivot cube pairs with the following cubes of the same node
+            for ( nPairs = 0, k = iNext; k < Vec_WecSize(p->vCubes) && nPairs < FX_PAR_PAIRS; k++ )
+            {
+                if ( iStop <= k )
+                    for ( iStop = k + 1; iStop < Vec_WecSize(p->vCubes); iStop++ )
+                        if ( Fx_ManGetCubeVar(p->vCubes, iStop) != Fx_ManGetCubeVar(p->vCubes, k) )
+                            break;
+                nPairs += iStop - k - 1;
+            }
+            ThData[i].iStart   = iNext;
+            ThData[i].iStop    = iNext = k;
+            ThData[i].fWorking = 1;
+        }
+        // add the divisors in the order of the jobs
+        for ( k = 0; k < i; k++ )
+        {
+            volatile int * pPlace = &ThData[k].fWorking;
+            while ( *pPlace );
+            Fx_ManParAddJob( p, ThData + k );
+        }
+    }
+    // stop the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        assert( !ThData[i].fWorking );
+        ThData[i].iStart   = -1;
+        ThData[i].fWorking = 1;
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pthread_join( WorkerThread[i], NULL );
+        *fWarning |= ThData[i].fWarning;
+        Vec_IntFree( ThData[i].vRecs );
+        Vec_IntFree( ThData[i].vCubeFree );
+    }
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Creates divisors.]
+
+  Description [The hash table is sized by the number of literal pairs and 
+  cube pairs, which is an upper bound on the number of divisors, to avoid 
+  resizing it while the divisors are added.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Fx_ManCountPairs( Fx_Man_t * p )
+{
+    Vec_Int_t * vCube;
+    word nPairs = 0;
+    int i, iStop = 0;
+    Vec_WecForEachLevel( p->vCubes, vCube, i )
+    {
+        if ( iStop <= i )
+            for ( iStop = i + 1; iStop < Vec_WecSize(p->vCubes); iStop++ )
+                if ( Fx_ManGetCubeVar(p->vCubes, iStop) != Fx_ManGetCubeVar(p->vCubes, i) )
+                    break;
+        nPairs += (word)(Vec_IntSize(vCube) - 1) * (Vec_IntSize(vCube) - 2) / 2;
+        nPairs += iStop - i - 1;
+    }
+    // the pairs often share divisors, so the estimate is also limited by the size of the cover
+    nPairs = Abc_MinWord( nPairs, 2 * (word)p->nLits + Vec_WecSize(p->vCubes) );
+    return (int)Abc_MinWord( nPairs, FX_DIVS_START );
+}
 void Fx_ManCreateDivisors( Fx_Man_t * p )
 {
     Vec_Int_t * vCube;
     float Weight;
-    int i, fWarning = 0;
+    int i, nDivsMax, fWarning = 0;
     // alloc hash table
     assert( p->pHash == NULL );
-    p->pHash = Hsh_VecManStart( 1000 );
-    p->vWeights = Vec_FltAlloc( 1000 );
+    nDivsMax = Abc_MaxInt( 1000, Fx_ManCountPairs(p) );
+    p->pHash = Hsh_VecManStart( nDivsMax );
+    p->vWeights = Vec_FltAlloc( nDivsMax );
+    p->vDivPairs = Vec_IntAlloc( nDivsMax );
     // create single-cube two-literal divisors
     Vec_WecForEachLevel( p->vCubes, vCube, i )
         Fx_ManCubeSingleCubeDivisors( p, vCube, 0, 0 ); // add - no update
     assert( p->nDivsS == Vec_FltSize(p->vWeights) );
     // create two-cube divisors
-    Vec_WecForEachLevel( p->vCubes, vCube, i )
-        Fx_ManCubeDoubleCubeDivisors( p, i+1, vCube, 0, 0, &fWarning ); // add - no update
+    if ( p->nProcs > 1 )
+        Fx_ManCreateDivisorsPar( p, &fWarning );
+    else
+    {
+        Vec_WecForEachLevel( p->vCubes, vCube, i )
+            Fx_ManCubeDoubleCubeDivisors( p, i+1, vCube, 0, 0, &fWarning ); // add - no update
+    }
     // create queue with all divisors
     p->vPrio = Vec_QueAlloc( Vec_FltSize(p->vWeights) );
     Vec_QueSetPriority( p->vPrio, Vec_FltArrayP(p->vWeights) );
@@ -892,6 +1149,51 @@ void Fx_ManCreateDivisors( Fx_Man_t * p )
             Vec_QuePush( p->vPrio, i );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Removes the divisors that are not present in any cube pair.]
+
+  Description [Each extraction adds divisors of the updated cubes to
+  the hash table, while the divisors of the old cubes stay there with
+  no cube pairs. When the table is dominated by such divisors, it is
+  rebuilt with the remaining ones, and the queue is recreated.]
+               
+  SideEffects [Renumbers the divisors.]
+
+  SeeAlso     []
+
+***********************************************************************/
+void Fx_ManCompactDivisors( Fx_Man_t * p )
+{
+    Hsh_VecMan_t * pHash;
+    Vec_Flt_t * vWeights;
+    Vec_Int_t * vDivPairs;
+    float Weight;
+    int i, nPairs, nDivs = p->nDivsLive;
+    pHash     = Hsh_VecManStart( Abc_MaxInt(1000, 2 * nDivs) );
+    vWeights  = Vec_FltAlloc( Abc_MaxInt(1000, 2 * nDivs) );
+    vDivPairs = Vec_IntAlloc( Abc_MaxInt(1000, 2 * nDivs) );
+    Vec_IntForEachEntry( p->vDivPairs, nPairs, i )
+    {
+        if ( nPairs == 0 )
+            continue;
+        Hsh_VecManAdd( pHash, Hsh_VecReadEntry(p->pHash, i) );
+        Vec_FltPush( vWeights, Vec_FltEntry(p->vWeights, i) );
+        Vec_IntPush( vDivPairs, nPairs );
+    }
+    assert( Hsh_VecSize(pHash) == nDivs );
+    Hsh_VecManStop( p->pHash );   p->pHash     = pHash;
+    Vec_FltFree( p->vWeights );   p->vWeights  = vWeights;
+    Vec_IntFree( p->vDivPairs );  p->vDivPairs = vDivPairs;
+    // recreate the queue
+    Vec_QueFree( p->vPrio );
+    p->vPrio = Vec_QueAlloc( Vec_FltSize(p->vWeights) );
+    Vec_QueSetPriority( p->vPrio, Vec_FltArrayP(p->vWeights) );
+    Vec_FltForEachEntry( p->vWeights, Weight, i )
+        if ( Weight > 0.0 )
+            Vec_QuePush( p->vPrio, i );
+}
+
 
 /**Function*************************************************************
 
@@ -925,7 +1227,6 @@ static inline void Fx_ManCompressCubes( Vec_Wec_t * vCubes, Vec_Int_t * vLit2Cub
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Fx_ManGetCubeVar( Vec_Wec_t * vCubes, int iCube )  { return Vec_IntEntry( Vec_WecEntry(vCubes, iCube), 0 );      }
 void Fx_ManFindCommonPairs( Vec_Wec_t * vCubes, Vec_Int_t * vPart0, Vec_Int_t * vPart1, Vec_Int_t * vPairs, Vec_Int_t * vCompls, Vec_Int_t * vDiv, Vec_Int_t * vCubeFree, int * fWarning )
 {
     int * pBeg1 = vPart0->pArray;
@@ -1058,6 +1359,9 @@ void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
     }
     assert( Vec_IntSize(p->vLevels) == iVarNew );
     Vec_IntPush( p->vLevels, Level );
+    // the cube pair of the new node is not added to the matrix but it is
+    // removed when these cubes are updated, so the divisor should be kept
+    Fx_ManAddDivPairs( p, iDiv, 1 );
     // do not add new cubes to the matrix 
     p->nLits += Vec_IntSize( vDiv );
     // create new literals
@@ -1149,7 +1453,7 @@ void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
         if ( p->nCompls && i > 1 ) // the last two lits are possibly complemented
             Vec_IntTwoRemove( Vec_WecEntry(p->vLits, Abc_LitNot(Abc_Lit2Var(Lit0))), p->vCubesD );
     }
-    
+
     // check predicted improvement: (new SOP lits == old SOP lits - divisor weight)
     assert( p->nLits == nLitsNew );
 }
@@ -1167,7 +1471,7 @@ void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
   SeeAlso     []
 
 ***********************************************************************/
-int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fVerbose, int fVeryVerbose )
+int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int nProcs, int fVerbose, int fVeryVerbose )
 {
     int fVeryVeryVerbose = 0;
     int i, iDiv, fWarning = 0;
@@ -1176,6 +1480,7 @@ int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitC
     // initialize the data-structure
     p = Fx_ManStart( vCubes );
     p->LitCountMax = LitCountMax;
+    p->nProcs = nProcs;
     Fx_ManCreateLiterals( p, ObjIdMax );
     Fx_ManComputeLevel( p );
     Fx_ManCreateDivisors( p );
@@ -1193,6 +1498,8 @@ int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitC
         Fx_ManUpdate( p, iDiv, &fWarning );
         if ( fVeryVeryVerbose )
             Fx_PrintMatrix( p );
+        if ( Hsh_VecSize(p->pHash) > Abc_MaxInt(FX_DIVS_COMPACT, 2 * p->nDivsLive) )
+            Fx_ManCompactDivisors( p );
     }
     if ( fVerbose )
         Fx_PrintStats( p, Abc_Clock() - clk );
@@ -20,6 +20,7 @@
 
 #include "base/abc/abc.h"
 #include "bool/dec/dec.h"
+#include "misc/util/utilTruth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -30,6 +31,7 @@ ABC_NAMESPACE_IMPL_START
 
 #define ABC_RS_DIV1_MAX    150   // the max number of divisors to consider
 #define ABC_RS_DIV2_MAX    500   // the max number of pair-wise divisors to consider
+#define ABC_RS_SIGN_WORDS    4   // the min number of words when signatures are sampled
 
 typedef struct Abc_ManRes_t_ Abc_ManRes_t;
 struct Abc_ManRes_t_
@@ -45,12 +47,15 @@ struct Abc_ManRes_t_
     int                nLastGain;  // the gain the number of nodes
     Vec_Ptr_t *        vDivs;      // the divisors
     // representation of the simulation info
-    int                nBits;      // the number of simulation bits
-    int                nWords;     // the number of unsigneds for siminfo
+    int                nBits;      // the number of simulation bits of the current cut
+    int                nWords;     // the number of words of the current cut
+    int                nWordsMax;  // the number of words of the largest cut
     Vec_Ptr_t        * vSims;      // simulation info
-    unsigned         * pInfo;      // pointer to simulation info
+    word             * pInfo;      // pointer to simulation info
+    int                pSignBase[64]; // random minterms sampled for the signatures
+    int                pSignPos[64];  // the same minterms for the current cut
     // observability don't-cares
-    unsigned *         pCareSet;
+    word *             pCareSet;
     // internal divisor storage
     Vec_Ptr_t        * vDivs1UP;   // the single-node unate divisors
     Vec_Ptr_t        * vDivs1UN;   // the single-node unate divisors
@@ -102,7 +107,7 @@ static void          Abc_ManResubPrint( Abc_ManRes_t * p );
 
 // other procedures
 static int           Abc_ManResubCollectDivs( Abc_ManRes_t * p, Abc_Obj_t * pRoot, Vec_Ptr_t * vLeaves, int Required );
-static void          Abc_ManResubSimulate( Vec_Ptr_t * vDivs, int nLeaves, Vec_Ptr_t * vSims, int nLeavesMax, int nWords );
+static void          Abc_ManResubSimulate( Abc_ManRes_t * p );
 static void          Abc_ManResubPrintDivs( Abc_ManRes_t * p, Abc_Obj_t * pRoot, Vec_Ptr_t * vLeaves );
 
 static void          Abc_ManResubDivsS( Abc_ManRes_t * p, int Required );
@@ -119,6 +124,80 @@ static int           Abc_CutVolumeCheck( Abc_Obj_t * pNode, Vec_Ptr_t * vLeaves
 
 extern abctime s_ResubTime;
 
+// the simulation info of each divisor is preceded by its signature, which 
+// contains the values of 64 sampled minterms of the cut; the checks below 
+// start from the signature, so most of the failing candidates are rejected 
+// after looking at one word, while the signature is never more restrictive 
+// than the complete simulation info; the complemented divisors are handled 
+// using the masks (0 or ~0) XOR-ed with the simulation info
+
+static inline word * Abc_ResubSim( Abc_Obj_t * pObj )   { return (word *)Abc_ObjRegular(pObj)->pData - 1;        }
+static inline word   Abc_ResubMask( Abc_Obj_t * pObj )  { return Abc_ObjIsComplement(pObj) ? ~(word)0 : 0;      }
+
+// checks that ((p0 ^ m0) & ~(pR ^ mR)) is const0 in the care set
+static inline int Abc_ResubImply( word * p0, word m0, word * pR, word mR, word * pC, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( (p0[w] ^ m0) & ~(pR[w] ^ mR) & pC[w] )
+            return 0;
+    return 1;
+}
+// checks that ((((p0 ^ m0) & (p1 ^ m1)) ^ m) & ~(pR ^ mR)) is const0 in the care set
+static inline int Abc_ResubImply2( word * p0, word m0, word * p1, word m1, word m, word * pR, word mR, word * pC, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( (((p0[w] ^ m0) & (p1[w] ^ m1)) ^ m) & ~(pR[w] ^ mR) & pC[w] )
+            return 0;
+    return 1;
+}
+// checks that p0 is equal to pR in the care set
+static inline int Abc_ResubEqual( word * p0, word * pR, word * pC, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( (p0[w] ^ pR[w]) & pC[w] )
+            return 0;
+    return 1;
+}
+// checks that (((p0 ^ m0) & (p1 ^ m1)) ^ m) is equal to pR in the care set
+static inline int Abc_ResubEqual2( word * p0, word m0, word * p1, word m1, word m, word * pR, word * pC, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( ((((p0[w] ^ m0) & (p1[w] ^ m1)) ^ m) ^ pR[w]) & pC[w] )
+            return 0;
+    return 1;
+}
+// checks that (((p0 ^ m) & (p1 ^ m) & (p2 ^ m)) ^ m) is equal to pR in the care set
+static inline int Abc_ResubEqual3( word * p0, word * p1, word * p2, word m, word * pR, word * pC, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( ((((p0[w] ^ m) & (p1[w] ^ m) & (p2[w] ^ m)) ^ m) ^ pR[w]) & pC[w] )
+            return 0;
+    return 1;
+}
+// checks that (((p0 ^ m0) & (((p1 ^ m1) & (p2 ^ m2)) ^ m12)) ^ m) is equal to pR in the care set
+static inline int Abc_ResubEqual21( word * p0, word m0, word * p1, word m1, word * p2, word m2, word m12, word m, word * pR, word * pC, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( ((((p0[w] ^ m0) & (((p1[w] ^ m1) & (p2[w] ^ m2)) ^ m12)) ^ m) ^ pR[w]) & pC[w] )
+            return 0;
+    return 1;
+}
+// checks that (((((p0 ^ m0) & (p1 ^ m1)) ^ m01) & (((p2 ^ m2) & (p3 ^ m3)) ^ m23)) ^ m) is equal to pR in the care set
+static inline int Abc_ResubEqual22( word * p0, word m0, word * p1, word m1, word m01, word * p2, word m2, word * p3, word m3, word m23, word m, word * pR, word * pC, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( ((((((p0[w] ^ m0) & (p1[w] ^ m1)) ^ m01) & (((p2[w] ^ m2) & (p3[w] ^ m3)) ^ m23)) ^ m) ^ pR[w]) & pC[w] )
+            return 0;
+    return 1;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -202,7 +281,7 @@ pManRes->timeCut += Abc_Clock() - clk;
         {
 clk = Abc_Clock();
             Abc_NtkDontCareClear( pManOdc );
-            Abc_NtkDontCareCompute( pManOdc, pNode, vLeaves, pManRes->pCareSet );
+            Abc_NtkDontCareCompute( pManOdc, pNode, vLeaves, (unsigned *)pManRes->pCareSet );
 pManRes->timeTruth += Abc_Clock() - clk;
         }
 
@@ -287,32 +366,31 @@ s_ResubTime = Abc_Clock() - clkStart;
 Abc_ManRes_t * Abc_ManResubStart( int nLeavesMax, int nDivsMax )
 {
     Abc_ManRes_t * p;
-    unsigned * pData;
-    int i, k;
-    assert( sizeof(unsigned) == 4 );
+    unsigned Rand = 0x9E3779B9;
+    int i;
     p = ABC_ALLOC( Abc_ManRes_t, 1 );
     memset( p, 0, sizeof(Abc_ManRes_t) );
     p->nLeavesMax = nLeavesMax;
     p->nDivsMax   = nDivsMax;
     p->vDivs      = Vec_PtrAlloc( p->nDivsMax );
-    // allocate simulation info
-    p->nBits      = (1 << p->nLeavesMax);
-    p->nWords     = (p->nBits <= 32)? 1 : (p->nBits / 32);
-    p->pInfo      = ABC_ALLOC( unsigned, p->nWords * (p->nDivsMax + 1) );
-    memset( p->pInfo, 0, sizeof(unsigned) * p->nWords * p->nLeavesMax );
+    // allocate simulation info (each entry is preceded by its signature)
+    p->nWordsMax  = Abc_TtWordNum( p->nLeavesMax );
+    p->nWords     = p->nWordsMax;
+    p->nBits      = 64 * p->nWords;
+    p->pInfo      = ABC_CALLOC( word, (p->nWordsMax + 1) * (p->nDivsMax + 1) );
     p->vSims      = Vec_PtrAlloc( p->nDivsMax );
     for ( i = 0; i < p->nDivsMax; i++ )
-        Vec_PtrPush( p->vSims, p->pInfo + i * p->nWords );
+        Vec_PtrPush( p->vSims, p->pInfo + i * (p->nWordsMax + 1) + 1 );
     // assign the care set
-    p->pCareSet  = p->pInfo + p->nDivsMax * p->nWords;
-    Abc_InfoFill( p->pCareSet, p->nWords );
+    p->pCareSet  = p->pInfo + p->nDivsMax * (p->nWordsMax + 1) + 1;
+    Abc_TtFill( p->pCareSet - 1, p->nWordsMax + 1 );
     // set elementary truth tables
-    for ( k = 0; k < p->nLeavesMax; k++ )
+    Abc_TtElemInit( (word **)Vec_PtrArray(p->vSims), p->nLeavesMax );
+    // select the minterms for the signatures
+    for ( i = 0; i < 64; i++ )
     {
-        pData = (unsigned *)p->vSims->pArray[k];
-        for ( i = 0; i < p->nBits; i++ )
-            if ( i & (1 << k) )
-                pData[i>>5] |= (1 << (i&31));
+        Rand = 1664525 * Rand + 1013904223;
+        p->pSignBase[i] = (int)(Rand >> 8);
     }
     // create the remaining divisors
     p->vDivs1UP  = Vec_PtrAlloc( p->nDivsMax );
@@ -565,26 +643,36 @@ void Abc_ManResubPrintDivs( Abc_ManRes_t * p, Abc_Obj_t * pRoot, Vec_Ptr_t * vLe
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_ManResubSimulate( Vec_Ptr_t * vDivs, int nLeaves, Vec_Ptr_t * vSims, int nLeavesMax, int nWords )
+static inline word Abc_ManResubSign( Abc_ManRes_t * p, word * pData )
+{
+    word Sign = 0;
+    int i;
+    if ( p->nWords < ABC_RS_SIGN_WORDS )
+        return pData[0];
+    for ( i = 0; i < 64; i++ )
+        Sign |= ((pData[p->pSignPos[i] >> 6] >> (p->pSignPos[i] & 63)) & 1) << i;
+    return Sign;
+}
+void Abc_ManResubSimulate( Abc_ManRes_t * p )
 {
     Abc_Obj_t * pObj;
-    unsigned * puData0, * puData1, * puData;
-    int i, k;
-    assert( Vec_PtrSize(vDivs) - nLeaves <= Vec_PtrSize(vSims) - nLeavesMax );
+    word * puData0, * puData1, * puData;
+    int i, k, nWords = p->nWords;
+    assert( Vec_PtrSize(p->vDivs) - p->nLeaves <= Vec_PtrSize(p->vSims) - p->nLeavesMax );
     // simulate
-    Vec_PtrForEachEntry( Abc_Obj_t *, vDivs, pObj, i )
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs, pObj, i )
     {
-        if ( i < nLeaves )
+        if ( i < p->nLeaves )
         { // initialize the leaf
-            pObj->pData = Vec_PtrEntry( vSims, i );
+            pObj->pData = Vec_PtrEntry( p->vSims, i );
             continue;
         }
         // set storage for the node's simulation info
-        pObj->pData = Vec_PtrEntry( vSims, i - nLeaves + nLeavesMax );
+        pObj->pData = Vec_PtrEntry( p->vSims, i - p->nLeaves + p->nLeavesMax );
         // get pointer to the simulation info
-        puData  = (unsigned *)pObj->pData;
-        puData0 = (unsigned *)Abc_ObjFanin0(pObj)->pData;
-        puData1 = (unsigned *)Abc_ObjFanin1(pObj)->pData;
+        puData  = (word *)pObj->pData;
+        puData0 = (word *)Abc_ObjFanin0(pObj)->pData;
+        puData1 = (word *)Abc_ObjFanin1(pObj)->pData;
         // simulate
         if ( Abc_ObjFaninC0(pObj) && Abc_ObjFaninC1(pObj) )
             for ( k = 0; k < nWords; k++ )
@@ -599,15 +687,17 @@ void Abc_ManResubSimulate( Vec_Ptr_t * vDivs, int nLeaves, Vec_Ptr_t * vSims, in
             for ( k = 0; k < nWords; k++ )
                 puData[k] = puData0[k] & puData1[k];
     }
-    // normalize
-    Vec_PtrForEachEntry( Abc_Obj_t *, vDivs, pObj, i )
+    // normalize and compute the signatures
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs, pObj, i )
     {
-        puData = (unsigned *)pObj->pData;
-        pObj->fPhase = (puData[0] & 1);
+        puData = (word *)pObj->pData;
+        pObj->fPhase = (int)(puData[0] & 1);
         if ( pObj->fPhase )
             for ( k = 0; k < nWords; k++ )
                 puData[k] = ~puData[k];
+        puData[-1] = Abc_ManResubSign( p, puData );
     }
+    p->pCareSet[-1] = Abc_ManResubSign( p, p->pCareSet );
 }
 
 
@@ -841,34 +931,24 @@ Dec_Graph_t * Abc_ManResubQuit3( Abc_Obj_t * pRoot, Abc_Obj_t * pObj0, Abc_Obj_t
 void Abc_ManResubDivsS( Abc_ManRes_t * p, int Required )
 {
     Abc_Obj_t * pObj;
-    unsigned * puData, * puDataR;
-    int i, w;
+    word * puData, * puDataR = Abc_ResubSim(p->pRoot), * puCare = p->pCareSet - 1;
+    int i, nWords = p->nWords + 1;
     Vec_PtrClear( p->vDivs1UP );
     Vec_PtrClear( p->vDivs1UN );
     Vec_PtrClear( p->vDivs1B );
-    puDataR = (unsigned *)p->pRoot->pData;
     Vec_PtrForEachEntryStop( Abc_Obj_t *, p->vDivs, pObj, i, p->nDivs )
     {
         if ( (int)pObj->Level > Required - 1 )
             continue;
-
-        puData = (unsigned *)pObj->pData;
+        puData = Abc_ResubSim( pObj );
         // check positive containment
-        for ( w = 0; w < p->nWords; w++ )
-//            if ( puData[w] & ~puDataR[w] )
-            if ( puData[w] & ~puDataR[w] & p->pCareSet[w] ) // care set
-                break;
-        if ( w == p->nWords )
+        if ( Abc_ResubImply( puData, 0, puDataR, 0, puCare, nWords ) )
         {
             Vec_PtrPush( p->vDivs1UP, pObj );
             continue;
         }
         // check negative containment
-        for ( w = 0; w < p->nWords; w++ )
-//            if ( ~puData[w] & puDataR[w] )
-            if ( ~puData[w] & puDataR[w] & p->pCareSet[w] ) // care set
-                break;
-        if ( w == p->nWords )
+        if ( Abc_ResubImply( puDataR, 0, puData, 0, puCare, nWords ) )
         {
             Vec_PtrPush( p->vDivs1UN, pObj );
             continue;
@@ -892,105 +972,52 @@ void Abc_ManResubDivsS( Abc_ManRes_t * p, int Required )
 void Abc_ManResubDivsD( Abc_ManRes_t * p, int Required )
 {
     Abc_Obj_t * pObj0, * pObj1;
-    unsigned * puData0, * puData1, * puDataR;
-    int i, k, w;
+    word * puData0, * puData1, * puDataR = Abc_ResubSim(p->pRoot), * puCare = p->pCareSet - 1;
+    word m0, m1, Full = ~(word)0;
+    int i, k, c, nWords = p->nWords + 1;
     Vec_PtrClear( p->vDivs2UP0 );
     Vec_PtrClear( p->vDivs2UP1 );
     Vec_PtrClear( p->vDivs2UN0 );
     Vec_PtrClear( p->vDivs2UN1 );
-    puDataR = (unsigned *)p->pRoot->pData;
     Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs1B, pObj0, i )
     {
         if ( (int)pObj0->Level > Required - 2 )
             continue;
 
-        puData0 = (unsigned *)pObj0->pData;
+        puData0 = Abc_ResubSim( pObj0 );
         Vec_PtrForEachEntryStart( Abc_Obj_t *, p->vDivs1B, pObj1, k, i + 1 )
         {
             if ( (int)pObj1->Level > Required - 2 )
                 continue;
 
-            puData1 = (unsigned *)pObj1->pData;
-
+            puData1 = Abc_ResubSim( pObj1 );
+            // the pair (d0 ^ m0, d1 ^ m1) stands for AND of the two literals, 
+            // except that the pair of two complemented divisors stands for OR
             if ( Vec_PtrSize(p->vDivs2UP0) < ABC_RS_DIV2_MAX )
             {
                 // get positive unate divisors
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] & puData1[w]) & ~puDataR[w] )
-                    if ( (puData0[w] & puData1[w]) & ~puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
-                {
-                    Vec_PtrPush( p->vDivs2UP0, pObj0 );
-                    Vec_PtrPush( p->vDivs2UP1, pObj1 );
-                }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (~puData0[w] & puData1[w]) & ~puDataR[w] )
-                    if ( (~puData0[w] & puData1[w]) & ~puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
-                {
-                    Vec_PtrPush( p->vDivs2UP0, Abc_ObjNot(pObj0) );
-                    Vec_PtrPush( p->vDivs2UP1, pObj1 );
-                }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] & ~puData1[w]) & ~puDataR[w] )
-                    if ( (puData0[w] & ~puData1[w]) & ~puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                for ( c = 0; c < 4; c++ )
                 {
-                    Vec_PtrPush( p->vDivs2UP0, pObj0 );
-                    Vec_PtrPush( p->vDivs2UP1, Abc_ObjNot(pObj1) );
-                }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] | puData1[w]) & ~puDataR[w] )
-                    if ( (puData0[w] | puData1[w]) & ~puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
-                {
-                    Vec_PtrPush( p->vDivs2UP0, Abc_ObjNot(pObj0) );
-                    Vec_PtrPush( p->vDivs2UP1, Abc_ObjNot(pObj1) );
+                    m0 = (c & 1) ? Full : 0;
+                    m1 = (c & 2) ? Full : 0;
+                    if ( !Abc_ResubImply2( puData0, m0, puData1, m1, m0 & m1, puDataR, 0, puCare, nWords ) )
+                        continue;
+                    Vec_PtrPush( p->vDivs2UP0, Abc_ObjNotCond(pObj0, c & 1) );
+                    Vec_PtrPush( p->vDivs2UP1, Abc_ObjNotCond(pObj1, c >> 1) );
                 }
             }
 
             if ( Vec_PtrSize(p->vDivs2UN0) < ABC_RS_DIV2_MAX )
             {
                 // get negative unate divisors
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ~(puData0[w] & puData1[w]) & puDataR[w] )
-                    if ( ~(puData0[w] & puData1[w]) & puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
-                {
-                    Vec_PtrPush( p->vDivs2UN0, pObj0 );
-                    Vec_PtrPush( p->vDivs2UN1, pObj1 );
-                }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ~(~puData0[w] & puData1[w]) & puDataR[w] )
-                    if ( ~(~puData0[w] & puData1[w]) & puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
-                {
-                    Vec_PtrPush( p->vDivs2UN0, Abc_ObjNot(pObj0) );
-                    Vec_PtrPush( p->vDivs2UN1, pObj1 );
-                }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ~(puData0[w] & ~puData1[w]) & puDataR[w] )
-                    if ( ~(puData0[w] & ~puData1[w]) & puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                for ( c = 0; c < 4; c++ )
                 {
-                    Vec_PtrPush( p->vDivs2UN0, pObj0 );
-                    Vec_PtrPush( p->vDivs2UN1, Abc_ObjNot(pObj1) );
-                }
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ~(puData0[w] | puData1[w]) & puDataR[w] )
-                    if ( ~(puData0[w] | puData1[w]) & puDataR[w] & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
-                {
-                    Vec_PtrPush( p->vDivs2UN0, Abc_ObjNot(pObj0) );
-                    Vec_PtrPush( p->vDivs2UN1, Abc_ObjNot(pObj1) );
+                    m0 = (c & 1) ? Full : 0;
+                    m1 = (c & 2) ? Full : 0;
+                    if ( !Abc_ResubImply2( puData0, m0, puData1, m1, ~(m0 & m1), puDataR, Full, puCare, nWords ) )
+                        continue;
+                    Vec_PtrPush( p->vDivs2UN0, Abc_ObjNotCond(pObj0, c & 1) );
+                    Vec_PtrPush( p->vDivs2UN1, Abc_ObjNotCond(pObj1, c >> 1) );
                 }
             }
         }
@@ -1014,14 +1041,8 @@ void Abc_ManResubDivsD( Abc_ManRes_t * p, int Required )
 Dec_Graph_t * Abc_ManResubQuit( Abc_ManRes_t * p )
 {
     Dec_Graph_t * pGraph;
-    unsigned * upData;
-    int w;
-    upData = (unsigned *)p->pRoot->pData;
-    for ( w = 0; w < p->nWords; w++ )
-//        if ( upData[w] )
-        if ( upData[w] & p->pCareSet[w] ) // care set
-            break;
-    if ( w != p->nWords )
+    // check that the root is const0 in the care set
+    if ( !Abc_ResubImply( Abc_ResubSim(p->pRoot), 0, p->pCareSet - 1, ~(word)0, p->pCareSet - 1, p->nWords + 1 ) )
         return NULL;
     // get constant node graph
     if ( p->pRoot->fPhase )
@@ -1045,19 +1066,11 @@ Dec_Graph_t * Abc_ManResubQuit( Abc_ManRes_t * p )
 Dec_Graph_t * Abc_ManResubDivs0( Abc_ManRes_t * p )
 {
     Abc_Obj_t * pObj;
-    unsigned * puData, * puDataR;
-    int i, w;
-    puDataR = (unsigned *)p->pRoot->pData;
+    word * puDataR = Abc_ResubSim(p->pRoot), * puCare = p->pCareSet - 1;
+    int i, nWords = p->nWords + 1;
     Vec_PtrForEachEntryStop( Abc_Obj_t *, p->vDivs, pObj, i, p->nDivs )
-    {
-        puData = (unsigned *)pObj->pData;
-        for ( w = 0; w < p->nWords; w++ )
-//            if ( puData[w] != puDataR[w] )
-            if ( (puData[w] ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                break;
-        if ( w == p->nWords )
+        if ( Abc_ResubEqual( Abc_ResubSim(pObj), puDataR, puCare, nWords ) )
             return Abc_ManResubQuit0( p->pRoot, pObj );
-    }
     return NULL;
 }
 
@@ -1075,43 +1088,30 @@ Dec_Graph_t * Abc_ManResubDivs0( Abc_ManRes_t * p )
 Dec_Graph_t * Abc_ManResubDivs1( Abc_ManRes_t * p, int Required )
 {
     Abc_Obj_t * pObj0, * pObj1;
-    unsigned * puData0, * puData1, * puDataR;
-    int i, k, w;
-    puDataR = (unsigned *)p->pRoot->pData;
+    word * puData0, * puDataR = Abc_ResubSim(p->pRoot), * puCare = p->pCareSet - 1, Full = ~(word)0;
+    int i, k, nWords = p->nWords + 1;
     // check positive unate divisors
     Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs1UP, pObj0, i )
     {
-        puData0 = (unsigned *)pObj0->pData;
+        puData0 = Abc_ResubSim( pObj0 );
         Vec_PtrForEachEntryStart( Abc_Obj_t *, p->vDivs1UP, pObj1, k, i + 1 )
         {
-            puData1 = (unsigned *)pObj1->pData;
-            for ( w = 0; w < p->nWords; w++ )
-//                if ( (puData0[w] | puData1[w]) != puDataR[w] )
-                if ( ((puData0[w] | puData1[w]) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                    break;
-            if ( w == p->nWords )
-            {
-                p->nUsedNode1Or++;
-                return Abc_ManResubQuit1( p->pRoot, pObj0, pObj1, 1 );
-            }
+            if ( !Abc_ResubEqual2( puData0, Full, Abc_ResubSim(pObj1), Full, Full, puDataR, puCare, nWords ) )
+                continue;
+            p->nUsedNode1Or++;
+            return Abc_ManResubQuit1( p->pRoot, pObj0, pObj1, 1 );
         }
     }
     // check negative unate divisors
     Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs1UN, pObj0, i )
     {
-        puData0 = (unsigned *)pObj0->pData;
+        puData0 = Abc_ResubSim( pObj0 );
         Vec_PtrForEachEntryStart( Abc_Obj_t *, p->vDivs1UN, pObj1, k, i + 1 )
         {
-            puData1 = (unsigned *)pObj1->pData;
-            for ( w = 0; w < p->nWords; w++ )
-//                if ( (puData0[w] & puData1[w]) != puDataR[w] )
-                if ( ((puData0[w] & puData1[w]) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                    break;
-            if ( w == p->nWords )
-            {
-                p->nUsedNode1And++;
-                return Abc_ManResubQuit1( p->pRoot, pObj0, pObj1, 0 );
-            }
+            if ( !Abc_ResubEqual2( puData0, 0, Abc_ResubSim(pObj1), 0, 0, puDataR, puCare, nWords ) )
+                continue;
+            p->nUsedNode1And++;
+            return Abc_ManResubQuit1( p->pRoot, pObj0, pObj1, 0 );
         }
     }
     return NULL;
@@ -1131,66 +1131,24 @@ Dec_Graph_t * Abc_ManResubDivs1( Abc_ManRes_t * p, int Required )
 Dec_Graph_t * Abc_ManResubDivs12( Abc_ManRes_t * p, int Required )
 {
     Abc_Obj_t * pObj0, * pObj1, * pObj2, * pObjMax, * pObjMin0 = NULL, * pObjMin1 = NULL;
-    unsigned * puData0, * puData1, * puData2, * puDataR;
-    int i, k, j, w, LevelMax;
-    puDataR = (unsigned *)p->pRoot->pData;
-    // check positive unate divisors
-    Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs1UP, pObj0, i )
-    {
-        puData0 = (unsigned *)pObj0->pData;
-        Vec_PtrForEachEntryStart( Abc_Obj_t *, p->vDivs1UP, pObj1, k, i + 1 )
-        {
-            puData1 = (unsigned *)pObj1->pData;
-            Vec_PtrForEachEntryStart( Abc_Obj_t *, p->vDivs1UP, pObj2, j, k + 1 )
-            {
-                puData2 = (unsigned *)pObj2->pData;
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] | puData1[w] | puData2[w]) != puDataR[w] )
-                    if ( ((puData0[w] | puData1[w] | puData2[w]) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
-                {
-                    LevelMax = Abc_MaxInt( pObj0->Level, Abc_MaxInt(pObj1->Level, pObj2->Level) );
-                    assert( LevelMax <= Required - 1 );
-
-                    pObjMax = NULL;
-                    if ( (int)pObj0->Level == LevelMax )
-                        pObjMax = pObj0, pObjMin0 = pObj1, pObjMin1 = pObj2;
-                    if ( (int)pObj1->Level == LevelMax )
-                    {
-                        if ( pObjMax ) continue;
-                        pObjMax = pObj1, pObjMin0 = pObj0, pObjMin1 = pObj2;
-                    }
-                    if ( (int)pObj2->Level == LevelMax )
-                    {
-                        if ( pObjMax ) continue;
-                        pObjMax = pObj2, pObjMin0 = pObj0, pObjMin1 = pObj1;
-                    }
-
-                    p->nUsedNode2Or++;
-                    assert(pObjMin0);
-                    assert(pObjMin1);
-                    return Abc_ManResubQuit21( p->pRoot, pObjMin0, pObjMin1, pObjMax, 1 );
-                }
-            }
-        }
-    }
-    // check negative unate divisors
-    Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs1UN, pObj0, i )
+    Vec_Ptr_t * vDivs;
+    word * puData0, * puData1, * puDataR = Abc_ResubSim(p->pRoot), * puCare = p->pCareSet - 1, Mask;
+    int i, k, j, LevelMax, fOrGate, nWords = p->nWords + 1;
+    // check positive unate divisors, then negative unate divisors
+    for ( fOrGate = 1; fOrGate >= 0; fOrGate-- )
     {
-        puData0 = (unsigned *)pObj0->pData;
-        Vec_PtrForEachEntryStart( Abc_Obj_t *, p->vDivs1UN, pObj1, k, i + 1 )
+        vDivs = fOrGate ? p->vDivs1UP : p->vDivs1UN;
+        Mask  = fOrGate ? ~(word)0 : 0;
+        Vec_PtrForEachEntry( Abc_Obj_t *, vDivs, pObj0, i )
         {
-            puData1 = (unsigned *)pObj1->pData;
-            Vec_PtrForEachEntryStart( Abc_Obj_t *, p->vDivs1UN, pObj2, j, k + 1 )
+            puData0 = Abc_ResubSim( pObj0 );
+            Vec_PtrForEachEntryStart( Abc_Obj_t *, vDivs, pObj1, k, i + 1 )
             {
-                puData2 = (unsigned *)pObj2->pData;
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] & puData1[w] & puData2[w]) != puDataR[w] )
-                    if ( ((puData0[w] & puData1[w] & puData2[w]) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                if ( w == p->nWords )
+                puData1 = Abc_ResubSim( pObj1 );
+                Vec_PtrForEachEntryStart( Abc_Obj_t *, vDivs, pObj2, j, k + 1 )
                 {
+                    if ( !Abc_ResubEqual3( puData0, puData1, Abc_ResubSim(pObj2), Mask, puDataR, puCare, nWords ) )
+                        continue;
                     LevelMax = Abc_MaxInt( pObj0->Level, Abc_MaxInt(pObj1->Level, pObj2->Level) );
                     assert( LevelMax <= Required - 1 );
 
@@ -1208,10 +1166,13 @@ Dec_Graph_t * Abc_ManResubDivs12( Abc_ManRes_t * p, int Required )
                         pObjMax = pObj2, pObjMin0 = pObj0, pObjMin1 = pObj1;
                     }
 
-                    p->nUsedNode2And++;
+                    if ( fOrGate )
+                        p->nUsedNode2Or++;
+                    else
+                        p->nUsedNode2And++;
                     assert(pObjMin0);
                     assert(pObjMin1);
-                    return Abc_ManResubQuit21( p->pRoot, pObjMin0, pObjMin1, pObjMax, 0 );
+                    return Abc_ManResubQuit21( p->pRoot, pObjMin0, pObjMin1, pObjMax, fOrGate );
                 }
             }
         }
@@ -1233,97 +1194,36 @@ Dec_Graph_t * Abc_ManResubDivs12( Abc_ManRes_t * p, int Required )
 Dec_Graph_t * Abc_ManResubDivs2( Abc_ManRes_t * p, int Required )
 {
     Abc_Obj_t * pObj0, * pObj1, * pObj2;
-    unsigned * puData0, * puData1, * puData2, * puDataR;
-    int i, k, w;
-    puDataR = (unsigned *)p->pRoot->pData;
-    // check positive unate divisors
+    word * puData0, * puDataR = Abc_ResubSim(p->pRoot), * puCare = p->pCareSet - 1, Full = ~(word)0, m1, m2;
+    int i, k, nWords = p->nWords + 1;
+    // check positive unate divisors: OR(d0, pair) = NOT(AND(NOT(d0), NOT(pair)))
     Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs1UP, pObj0, i )
     {
-        puData0 = (unsigned *)pObj0->pData;
+        puData0 = Abc_ResubSim( pObj0 );
         Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs2UP0, pObj1, k )
         {
             pObj2 = (Abc_Obj_t *)Vec_PtrEntry( p->vDivs2UP1, k );
-
-            puData1 = (unsigned *)Abc_ObjRegular(pObj1)->pData;
-            puData2 = (unsigned *)Abc_ObjRegular(pObj2)->pData;
-            if ( Abc_ObjIsComplement(pObj1) && Abc_ObjIsComplement(pObj2) )
-            {
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] | (puData1[w] | puData2[w])) != puDataR[w] )
-                    if ( ((puData0[w] | (puData1[w] | puData2[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-            }
-            else if ( Abc_ObjIsComplement(pObj1) )
-            {
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] | (~puData1[w] & puData2[w])) != puDataR[w] )
-                    if ( ((puData0[w] | (~puData1[w] & puData2[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-            }
-            else if ( Abc_ObjIsComplement(pObj2) )
-            {
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] | (puData1[w] & ~puData2[w])) != puDataR[w] )
-                    if ( ((puData0[w] | (puData1[w] & ~puData2[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-            }
-            else 
-            {
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] | (puData1[w] & puData2[w])) != puDataR[w] )
-                    if ( ((puData0[w] | (puData1[w] & puData2[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-            }
-            if ( w == p->nWords )
-            {
-                p->nUsedNode2OrAnd++;
-                return Abc_ManResubQuit2( p->pRoot, pObj0, pObj1, pObj2, 1 );
-            }
+            m1 = Abc_ResubMask( pObj1 );
+            m2 = Abc_ResubMask( pObj2 );
+            if ( !Abc_ResubEqual21( puData0, Full, Abc_ResubSim(pObj1), m1, Abc_ResubSim(pObj2), m2, ~(m1 & m2), Full, puDataR, puCare, nWords ) )
+                continue;
+            p->nUsedNode2OrAnd++;
+            return Abc_ManResubQuit2( p->pRoot, pObj0, pObj1, pObj2, 1 );
         }
     }
-    // check negative unate divisors
+    // check negative unate divisors: AND(d0, pair)
     Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs1UN, pObj0, i )
     {
-        puData0 = (unsigned *)pObj0->pData;
+        puData0 = Abc_ResubSim( pObj0 );
         Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs2UN0, pObj1, k )
         {
             pObj2 = (Abc_Obj_t *)Vec_PtrEntry( p->vDivs2UN1, k );
-
-            puData1 = (unsigned *)Abc_ObjRegular(pObj1)->pData;
-            puData2 = (unsigned *)Abc_ObjRegular(pObj2)->pData;
-            if ( Abc_ObjIsComplement(pObj1) && Abc_ObjIsComplement(pObj2) )
-            {
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] & (puData1[w] | puData2[w])) != puDataR[w] )
-                    if ( ((puData0[w] & (puData1[w] | puData2[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-            }
-            else if ( Abc_ObjIsComplement(pObj1) )
-            {
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] & (~puData1[w] & puData2[w])) != puDataR[w] )
-                    if ( ((puData0[w] & (~puData1[w] & puData2[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-            }
-            else if ( Abc_ObjIsComplement(pObj2) )
-            {
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] & (puData1[w] & ~puData2[w])) != puDataR[w] )
-                    if ( ((puData0[w] & (puData1[w] & ~puData2[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-            }
-            else 
-            {
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( (puData0[w] & (puData1[w] & puData2[w])) != puDataR[w] )
-                    if ( ((puData0[w] & (puData1[w] & puData2[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-            }
-            if ( w == p->nWords )
-            {
-                p->nUsedNode2AndOr++;
-                return Abc_ManResubQuit2( p->pRoot, pObj0, pObj1, pObj2, 0 );
-            }
+            m1 = Abc_ResubMask( pObj1 );
+            m2 = Abc_ResubMask( pObj2 );
+            if ( !Abc_ResubEqual21( puData0, 0, Abc_ResubSim(pObj1), m1, Abc_ResubSim(pObj2), m2, m1 & m2, 0, puDataR, puCare, nWords ) )
+                continue;
+            p->nUsedNode2AndOr++;
+            return Abc_ManResubQuit2( p->pRoot, pObj0, pObj1, pObj2, 0 );
         }
     }
     return NULL;
@@ -1343,247 +1243,27 @@ Dec_Graph_t * Abc_ManResubDivs2( Abc_ManRes_t * p, int Required )
 Dec_Graph_t * Abc_ManResubDivs3( Abc_ManRes_t * p, int Required )
 {
     Abc_Obj_t * pObj0, * pObj1, * pObj2, * pObj3;
-    unsigned * puData0, * puData1, * puData2, * puData3, * puDataR;
-    int i, k, w = 0, Flag;
-    puDataR = (unsigned *)p->pRoot->pData;
-    // check positive unate divisors
+    word * puData0, * puData1, * puDataR = Abc_ResubSim(p->pRoot), * puCare = p->pCareSet - 1, Full = ~(word)0, m0, m1, m2, m3;
+    int i, k, nWords = p->nWords + 1;
+    // check positive unate divisors: OR(pair0, pair1) = NOT(AND(NOT(pair0), NOT(pair1)))
     Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs2UP0, pObj0, i )
     {
         pObj1 = (Abc_Obj_t *)Vec_PtrEntry( p->vDivs2UP1, i );
-        puData0 = (unsigned *)Abc_ObjRegular(pObj0)->pData;
-        puData1 = (unsigned *)Abc_ObjRegular(pObj1)->pData;
-        Flag = (Abc_ObjIsComplement(pObj0) << 3) | (Abc_ObjIsComplement(pObj1) << 2);
-
+        puData0 = Abc_ResubSim( pObj0 );
+        puData1 = Abc_ResubSim( pObj1 );
+        m0 = Abc_ResubMask( pObj0 );
+        m1 = Abc_ResubMask( pObj1 );
         Vec_PtrForEachEntryStart( Abc_Obj_t *, p->vDivs2UP0, pObj2, k, i + 1 )
         {
             pObj3 = (Abc_Obj_t *)Vec_PtrEntry( p->vDivs2UP1, k );
-            puData2 = (unsigned *)Abc_ObjRegular(pObj2)->pData;
-            puData3 = (unsigned *)Abc_ObjRegular(pObj3)->pData;
-
-            Flag = (Flag & 12) | ((int)Abc_ObjIsComplement(pObj2) << 1) | (int)Abc_ObjIsComplement(pObj3);
-            assert( Flag < 16 );
-            switch( Flag )
-            {
-            case 0: // 0000
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] & puData1[w]) | (puData2[w] & puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] & puData1[w]) | (puData2[w] & puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-            case 1: // 0001
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] & puData1[w]) | (puData2[w] & ~puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] & puData1[w]) | (puData2[w] & ~puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-            case 2: // 0010
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] & puData1[w]) | (~puData2[w] & puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] & puData1[w]) | (~puData2[w] & puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-            case 3: // 0011
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] & puData1[w]) | (puData2[w] | puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] & puData1[w]) | (puData2[w] | puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-
-            case 4: // 0100
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] & ~puData1[w]) | (puData2[w] & puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] & ~puData1[w]) | (puData2[w] & puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-            case 5: // 0101
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] & ~puData1[w]) | (puData2[w] & ~puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] & ~puData1[w]) | (puData2[w] & ~puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-            case 6: // 0110
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] & ~puData1[w]) | (~puData2[w] & puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] & ~puData1[w]) | (~puData2[w] & puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-            case 7: // 0111
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] & ~puData1[w]) | (puData2[w] | puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] & ~puData1[w]) | (puData2[w] | puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-
-            case 8: // 1000
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((~puData0[w] & puData1[w]) | (puData2[w] & puData3[w])) != puDataR[w] )
-                    if ( (((~puData0[w] & puData1[w]) | (puData2[w] & puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-            case 9: // 1001
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((~puData0[w] & puData1[w]) | (puData2[w] & ~puData3[w])) != puDataR[w] )
-                    if ( (((~puData0[w] & puData1[w]) | (puData2[w] & ~puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-            case 10: // 1010
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((~puData0[w] & puData1[w]) | (~puData2[w] & puData3[w])) != puDataR[w] )
-                    if ( (((~puData0[w] & puData1[w]) | (~puData2[w] & puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-            case 11: // 1011
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((~puData0[w] & puData1[w]) | (puData2[w] | puData3[w])) != puDataR[w] )
-                    if ( (((~puData0[w] & puData1[w]) | (puData2[w] | puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-
-            case 12: // 1100
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] | puData1[w]) | (puData2[w] & puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] | puData1[w]) | (puData2[w] & puData3[w])) ^ puDataR[w]) & p->pCareSet[w] ) // care set
-                        break;
-                break;
-            case 13: // 1101
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] | puData1[w]) | (puData2[w] & ~puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] | puData1[w]) | (puData2[w] & ~puData3[w])) ^ puDataR[w]) & p->pCareSet[w] )
-                        break;
-                break;
-            case 14: // 1110
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] | puData1[w]) | (~puData2[w] & puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] | puData1[w]) | (~puData2[w] & puData3[w])) ^ puDataR[w]) & p->pCareSet[w] )
-                        break;
-                break;
-            case 15: // 1111
-                for ( w = 0; w < p->nWords; w++ )
-//                    if ( ((puData0[w] | puData1[w]) | (puData2[w] | puData3[w])) != puDataR[w] )
-                    if ( (((puData0[w] | puData1[w]) | (puData2[w] | puData3[w])) ^ puDataR[w]) & p->pCareSet[w] )
-                        break;
-                break;
-
-            }
-            if ( w == p->nWords )
-            {
-                p->nUsedNode3OrAnd++;
-                return Abc_ManResubQuit3( p->pRoot, pObj0, pObj1, pObj2, pObj3, 1 );
-            }
-        }
-    }
-/*
-    // check negative unate divisors
-    Vec_PtrForEachEntry( Abc_Obj_t *, p->vDivs2UN0, pObj0, i )
-    {
-        pObj1 = Vec_PtrEntry( p->vDivs2UN1, i );
-        puData0 = Abc_ObjRegular(pObj0)->pData;
-        puData1 = Abc_ObjRegular(pObj1)->pData;
-        Flag = (Abc_ObjIsComplement(pObj0) << 3) | (Abc_ObjIsComplement(pObj1) << 2);
-
-        Vec_PtrForEachEntryStart( Abc_Obj_t *, p->vDivs2UN0, pObj2, k, i + 1 )
-        {
-            pObj3 = Vec_PtrEntry( p->vDivs2UN1, k );
-            puData2 = Abc_ObjRegular(pObj2)->pData;
-            puData3 = Abc_ObjRegular(pObj3)->pData;
-
-            Flag = (Flag & 12) | (Abc_ObjIsComplement(pObj2) << 1) | Abc_ObjIsComplement(pObj3);
-            assert( Flag < 16 );
-            switch( Flag )
-            {
-            case 0: // 0000
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] & puData1[w]) & (puData2[w] & puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 1: // 0001
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] & puData1[w]) & (puData2[w] & ~puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 2: // 0010
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] & puData1[w]) & (~puData2[w] & puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 3: // 0011
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] & puData1[w]) & (puData2[w] | puData3[w])) != puDataR[w] )
-                        break;
-                break;
-
-            case 4: // 0100
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] & ~puData1[w]) & (puData2[w] & puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 5: // 0101
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] & ~puData1[w]) & (puData2[w] & ~puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 6: // 0110
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] & ~puData1[w]) & (~puData2[w] & puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 7: // 0111
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] & ~puData1[w]) & (puData2[w] | puData3[w])) != puDataR[w] )
-                        break;
-                break;
-
-            case 8: // 1000
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((~puData0[w] & puData1[w]) & (puData2[w] & puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 9: // 1001
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((~puData0[w] & puData1[w]) & (puData2[w] & ~puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 10: // 1010
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((~puData0[w] & puData1[w]) & (~puData2[w] & puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 11: // 1011
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((~puData0[w] & puData1[w]) & (puData2[w] | puData3[w])) != puDataR[w] )
-                        break;
-                break;
-
-            case 12: // 1100
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] | puData1[w]) & (puData2[w] & puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 13: // 1101
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] | puData1[w]) & (puData2[w] & ~puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 14: // 1110
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] | puData1[w]) & (~puData2[w] & puData3[w])) != puDataR[w] )
-                        break;
-                break;
-            case 15: // 1111
-                for ( w = 0; w < p->nWords; w++ )
-                    if ( ((puData0[w] | puData1[w]) & (puData2[w] | puData3[w])) != puDataR[w] )
-                        break;
-                break;
-
-            }
-            if ( w == p->nWords )
-            {
-                p->nUsedNode3AndOr++;
-                return Abc_ManResubQuit3( p->pRoot, pObj0, pObj1, pObj2, pObj3, 0 );
-            }
+            m2 = Abc_ResubMask( pObj2 );
+            m3 = Abc_ResubMask( pObj3 );
+            if ( !Abc_ResubEqual22( puData0, m0, puData1, m1, ~(m0 & m1), Abc_ResubSim(pObj2), m2, Abc_ResubSim(pObj3), m3, ~(m2 & m3), Full, puDataR, puCare, nWords ) )
+                continue;
+            p->nUsedNode3OrAnd++;
+            return Abc_ManResubQuit3( p->pRoot, pObj0, pObj1, pObj2, pObj3, 1 );
         }
     }
-*/
     return NULL;
 }
 
@@ -1623,7 +1303,7 @@ Dec_Graph_t * Abc_ManResubEval( Abc_ManRes_t * p, Abc_Obj_t * pRoot, Vec_Ptr_t *
 {
     extern int Abc_NodeMffcInside( Abc_Obj_t * pNode, Vec_Ptr_t * vLeaves, Vec_Ptr_t * vInside );
     Dec_Graph_t * pGraph;
-    int Required;
+    int i, Required;
     abctime clk;
 
     Required = fUpdateLevel? Abc_ObjRequiredLevel(pRoot) : ABC_INFINITY;
@@ -1649,9 +1329,15 @@ clk = Abc_Clock();
     p->nTotalDivs   += p->nDivs;
     p->nTotalLeaves += p->nLeaves;
 
-    // simulate the nodes
+    // simulate the nodes using as many words as needed for this cut
 clk = Abc_Clock();
-    Abc_ManResubSimulate( p->vDivs, p->nLeaves, p->vSims, p->nLeavesMax, p->nWords );
+    p->nWords = Abc_TtWordNum( p->nLeaves );
+    p->nBits  = 64 * p->nWords;
+    for ( i = 0; i < 64; i++ )
+        p->pSignPos[i] = p->pSignBase[i] & (p->nBits - 1);
+    if ( p->nLeaves < 6 )
+        p->pCareSet[0] = Abc_Tt6Stretch( p->pCareSet[0], p->nLeaves );
+    Abc_ManResubSimulate( p );
 p->timeSim += Abc_Clock() - clk;
 
 clk = Abc_Clock();
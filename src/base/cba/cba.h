@@ -1082,7 +1082,7 @@ static inline void Cba_NtkMissingFonNames( Cba_Ntk_t * p, char * pPref )
 
 
 /*=== cbaBlast.c =============================================================*/
-extern Gia_Man_t *   Cba_ManBlast( Cba_Man_t * p, int fBarBufs, int fSeq, int fVerbose );
+extern Gia_Man_t *   Cba_ManBlast( Cba_Man_t * p, int fBarBufs, int fSeq, int nProcs, int fVerbose );
 extern Cba_Man_t *   Cba_ManInsertGia( Cba_Man_t * p, Gia_Man_t * pGia );
 extern Cba_Man_t *   Cba_ManInsertAbc( Cba_Man_t * p, void * pAbc );
 /*=== cbaCba.c ===============================================================*/
@@ -1099,6 +1099,7 @@ extern void          Cba_NtkObjOrder( Cba_Ntk_t * p, Vec_Int_t * vObjs, Vec_Int_
 extern int           Cba_NtkCiFonNum( Cba_Ntk_t * p );
 extern int           Cba_NtkCoFinNum( Cba_Ntk_t * p );
 extern int           Cba_NtkCheckComboLoop( Cba_Ntk_t * p );
+extern int           Cba_NtkIsTopoOrder( Cba_Ntk_t * p );
 extern int           Cba_ManIsTopoOrder( Cba_Man_t * p );
 extern Vec_Int_t *   Cba_NtkCollectDfs( Cba_Ntk_t * p );
 extern Cba_Man_t *   Cba_ManCollapse( Cba_Man_t * p );
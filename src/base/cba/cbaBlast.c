@@ -24,11 +24,32 @@
 #include "bool/dec/dec.h"
 #include "base/main/mainInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
+
+#define CBA_THR_MAX 100
+
+typedef struct Cba_BlastThData_t_ Cba_BlastThData_t;
+struct Cba_BlastThData_t_
+{
+    Vec_Ptr_t *      vNtks;          // modules of the current level
+    Vec_Ptr_t *      vTemps;         // blasted modules indexed by module ID
+    int *            piNext;         // the next module to blast
+    void *           pMutex;         // the mutex guarding piNext
+};
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -582,6 +603,63 @@ void Cba_BlastSqrt( Gia_Man_t * pNew, int * pNum, int nNum, Vec_Int_t * vTmp, Ve
     Vec_IntReverseOrder( vRes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Instantiates the blasted module of a user box.]
+
+  Description [The module is blasted once into a combinational template,
+  whose CIs and COs are the bits of the module inputs and outputs.
+  Each instance remaps the template into the current AIG using the bits
+  of the box fanins. The bits of the box outputs are returned in vRes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cba_NtkBlastInstance( Gia_Man_t * pNew, Cba_Ntk_t * p, int iBox, Gia_Man_t * pTemp, Vec_Int_t * vBits, Vec_Int_t * vTemp0, Vec_Int_t * vCopies, Vec_Int_t * vRes )
+{
+    Cba_Ntk_t * pMod = Cba_ObjNtk( p, iBox );
+    Gia_Obj_t * pObj;
+    int i, k, b, iFin, iFon, nRange, nRangeMod, iCi = 0, iCo = 0, * pFans;
+    assert( Cba_ObjFinNum(p, iBox) == Cba_NtkPiNum(pMod) );
+    assert( Cba_ObjFonNum(p, iBox) == Cba_NtkPoNum(pMod) );
+    Vec_IntFill( vCopies, Gia_ManObjNum(pTemp), -1 );
+    Vec_IntWriteEntry( vCopies, 0, 0 );
+    // the template CIs are the bits of the module inputs
+    Cba_ObjForEachFinFon( p, iBox, iFin, iFon, k )
+    {
+        nRange    = iFon ? Cba_FonRangeSize( p, iFon ) : 0;
+        nRangeMod = Cba_ObjRangeSize( pMod, Cba_NtkPi(pMod, k) );
+        pFans     = Cba_FonIsReal(iFon) ? Vec_IntEntryP( vBits, Cba_FonCopy(p, iFon) ) : NULL;
+        pFans     = Cba_VecLoadFanins( p, vTemp0, iFon, pFans, nRange, Abc_MaxInt(nRange, nRangeMod), iFon ? Cba_FonSigned(p, iFon) : 0 );
+        for ( b = 0; b < nRangeMod; b++ )
+            Vec_IntWriteEntry( vCopies, Gia_ObjId(pTemp, Gia_ManCi(pTemp, iCi++)), pFans[b] );
+    }
+    assert( iCi == Gia_ManCiNum(pTemp) );
+    // remap the internal nodes
+    Gia_ManForEachAnd( pTemp, pObj, i )
+        Vec_IntWriteEntry( vCopies, i, Gia_ManHashAnd(pNew, Abc_LitNotCond(Vec_IntEntry(vCopies, Gia_ObjFaninId0(pObj, i)), Gia_ObjFaninC0(pObj)), 
+                                                            Abc_LitNotCond(Vec_IntEntry(vCopies, Gia_ObjFaninId1(pObj, i)), Gia_ObjFaninC1(pObj))) );
+    // the template COs are the bits of the module outputs
+    Vec_IntClear( vRes );
+    Cba_ObjForEachFon( p, iBox, iFon, k )
+    {
+        iFin      = Cba_ObjFinFon( pMod, Cba_NtkPo(pMod, k), 0 );
+        nRangeMod = iFin ? Cba_FonRangeSize( pMod, iFin ) : 0;
+        nRange    = Cba_FonRangeSize( p, iFon );
+        for ( b = 0; b < nRangeMod; b++, iCo++ )
+        {
+            pObj = Gia_ManCo( pTemp, iCo );
+            if ( b < nRange )
+                Vec_IntPush( vRes, Abc_LitNotCond(Vec_IntEntry(vCopies, Gia_ObjFaninId0p(pTemp, pObj)), Gia_ObjFaninC0(pObj)) );
+        }
+        for ( ; b < nRange; b++ )
+            Vec_IntPush( vRes, 0 );
+    }
+    assert( iCo == Gia_ManCoNum(pTemp) );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -593,7 +671,7 @@ void Cba_BlastSqrt( Gia_Man_t * pNew, int * pNum, int nNum, Vec_Int_t * vTmp, Ve
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Cba_NtkBlast( Cba_Ntk_t * p, int fSeq )
+Gia_Man_t * Cba_NtkBlastInt( Cba_Ntk_t * p, int fSeq, Vec_Ptr_t * vTemps, int * pnAnds )
 {
     int fUseOldMultiplierBlasting = 0;
     Gia_Man_t * pTemp, * pNew;
@@ -604,6 +682,7 @@ Gia_Man_t * Cba_NtkBlast( Cba_Ntk_t * p, int fSeq )
     int * pFans0, * pFans1, * pFans2;
     int nRange, nRange0, nRange1, nRange2;
     int Type, iFon, iFon0, iFon1, iFon2, fSigned01;
+    Vec_Int_t * vCopies = vTemps ? Vec_IntAlloc( 1000 ) : NULL;
     int i, k, b, iFin, iObj, iLit, nAndPrev;
     Vec_IntClear( vBits );
     Vec_IntGrow( vBits, nBits );
@@ -611,8 +690,6 @@ Gia_Man_t * Cba_NtkBlast( Cba_Ntk_t * p, int fSeq )
     vTemp1 = Vec_IntAlloc( 1000 );
     vTemp2 = Vec_IntAlloc( 1000 );
     vRes   = Vec_IntAlloc( 1000 );
-    // clean AND-gate counters
-    memset( p->pDesign->nAnds, 0, sizeof(int) * CBA_BOX_LAST );
     // create AIG manager
     pNew = Gia_ManStart( 5 * Cba_NtkObjNum(p) + 1000 );
     pNew->pName = Abc_UtilStrsav( Cba_ManName(p->pDesign) );
@@ -645,7 +722,13 @@ Gia_Man_t * Cba_NtkBlast( Cba_Ntk_t * p, int fSeq )
         fSigned01 = (Cba_ObjFinNum(p, i) > 1 && Cba_FonSigned(p, iFon0) && Cba_FonSigned(p, iFon1));
         nAndPrev  = Gia_ManAndNum(pNew);
         Vec_IntClear( vRes );
-        if ( Type == CBA_BOX_SLICE )
+        if ( Type == CBA_OBJ_BOX )
+        {
+            Gia_Man_t * pTemplate = vTemps ? (Gia_Man_t *)Vec_PtrEntry( vTemps, Cba_ObjNtkId(p, i) ) : NULL;
+            assert( pTemplate != NULL );
+            Cba_NtkBlastInstance( pNew, p, i, pTemplate, vBits, vTemp0, vCopies, vRes );
+        }
+        else if ( Type == CBA_BOX_SLICE )
         {
             int Left   = Cba_ObjLeft( p, i );
             int Right  = Cba_ObjRight( p, i );
@@ -939,10 +1022,12 @@ Gia_Man_t * Cba_NtkBlast( Cba_Ntk_t * p, int fSeq )
         }
         else assert( 0 );
         Vec_IntAppend( vBits, vRes );
-        p->pDesign->nAnds[Type] += Gia_ManAndNum(pNew) - nAndPrev;
+        if ( pnAnds )
+            pnAnds[Type] += Gia_ManAndNum(pNew) - nAndPrev;
     }
     assert( nBits == Vec_IntSize(vBits) );
-    p->pDesign->nAnds[0] = Gia_ManAndNum(pNew);
+    if ( pnAnds )
+        pnAnds[0] = Gia_ManAndNum(pNew);
     // create COs
     Cba_NtkForEachPo( p, iObj, i )
     {
@@ -1004,6 +1089,7 @@ Gia_Man_t * Cba_NtkBlast( Cba_Ntk_t * p, int fSeq )
     Vec_IntFree( vTemp1 );
     Vec_IntFree( vTemp2 );
     Vec_IntFree( vRes );
+    Vec_IntFreeP( &vCopies );
     // finalize AIG
     pNew = Gia_ManCleanup( pTemp = pNew );
     Gia_ManDupRemapLiterals( vBits, pTemp );
@@ -1034,9 +1120,195 @@ Gia_Man_t * Cba_NtkBlast( Cba_Ntk_t * p, int fSeq )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Cba_ManBlast( Cba_Man_t * p, int fBarBufs, int fSeq, int fVerbose )
+Gia_Man_t * Cba_NtkBlast( Cba_Ntk_t * p, int fSeq )
+{
+    memset( p->pDesign->nAnds, 0, sizeof(int) * CBA_BOX_LAST );
+    return Cba_NtkBlastInt( p, fSeq, NULL, p->pDesign->nAnds );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the modules instantiated in the hierarchy by level.]
+
+  Description [Returns the array of levels, each containing the modules
+  whose instances are only the modules of the lower levels. The root is
+  not included. Returns NULL if some of the modules are sequential or are
+  not in the topological order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cba_ManBlastLevels_rec( Cba_Ntk_t * p, Vec_Int_t * vLevels )
 {
-    return Cba_NtkBlast( Cba_ManRoot(p), fSeq );
+    int iObj, Level = 0;
+    if ( Vec_IntEntry(vLevels, Cba_NtkId(p)) >= 0 )
+        return Vec_IntEntry(vLevels, Cba_NtkId(p));
+    Cba_NtkForEachBoxUser( p, iObj )
+        Level = Abc_MaxInt( Level, 1 + Cba_ManBlastLevels_rec(Cba_ObjNtk(p, iObj), vLevels) );
+    Vec_IntWriteEntry( vLevels, Cba_NtkId(p), Level );
+    return Level;
+}
+Vec_Wec_t * Cba_ManBlastLevels( Cba_Man_t * p )
+{
+    Cba_Ntk_t * pNtk, * pRoot = Cba_ManRoot(p);
+    Vec_Int_t * vLevels = Vec_IntStartFull( Cba_ManNtkNum(p) + 1 );
+    Vec_Wec_t * vRes;
+    int i, Level, nLevels = Cba_ManBlastLevels_rec( pRoot, vLevels );
+    vRes = Vec_WecStart( nLevels );
+    Cba_ManForEachNtk( p, pNtk, i )
+    {
+        if ( pNtk == pRoot || (Level = Vec_IntEntry(vLevels, i)) < 0 )
+            continue;
+        if ( Cba_NtkIsSeq(pNtk) )
+        {
+            printf( "Hierarchical bit-blasting does not support sequential module \"%s\".\n", Cba_NtkName(pNtk) );
+            break;
+        }
+        if ( !Cba_NtkIsTopoOrder(pNtk) )
+        {
+            printf( "Module \"%s\" is not in a topological order.\n", Cba_NtkName(pNtk) );
+            break;
+        }
+        Vec_WecPush( vRes, Level, i );
+    }
+    Vec_IntFree( vLevels );
+    if ( i <= Cba_ManNtkNum(p) )
+        Vec_WecFreeP( &vRes );
+    return vRes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Blasts the modules of one level using several threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cba_ManBlastLevel( Cba_BlastThData_t * pThData )
+{
+    Cba_Ntk_t * pNtk;
+    while ( 1 )
+    {
+        int iNext;
+#ifdef ABC_USE_PTHREADS
+        if ( pThData->pMutex )
+            pthread_mutex_lock( (pthread_mutex_t *)pThData->pMutex );
+#endif
+        iNext = (*pThData->piNext)++;
+#ifdef ABC_USE_PTHREADS
+        if ( pThData->pMutex )
+            pthread_mutex_unlock( (pthread_mutex_t *)pThData->pMutex );
+#endif
+        if ( iNext >= Vec_PtrSize(pThData->vNtks) )
+            break;
+        // each module is blasted by one thread, which owns its bit mapping;
+        // the AND-gate counters of the design are only updated for the root
+        pNtk = (Cba_Ntk_t *)Vec_PtrEntry( pThData->vNtks, iNext );
+        Vec_PtrWriteEntry( pThData->vTemps, Cba_NtkId(pNtk), Cba_NtkBlastInt(pNtk, 0, pThData->vTemps, NULL) );
+    }
+}
+#ifdef ABC_USE_PTHREADS
+void * Cba_ManBlastWorkerThread( void * pArg )
+{
+    Cba_ManBlastLevel( (Cba_BlastThData_t *)pArg );
+    pthread_exit( NULL );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Bit-blasts the hierarchical design.]
+
+  Description [Each module instantiated in the hierarchy is blasted once,
+  starting from the leaves, and the modules of the same level are blasted
+  concurrently by nProcs threads. The instances of a module are created
+  by remapping its blasted template into the AIG of the parent.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cba_ManBlast( Cba_Man_t * p, int fBarBufs, int fSeq, int nProcs, int fVerbose )
+{
+    Cba_BlastThData_t ThData[CBA_THR_MAX];
+    Cba_Ntk_t * pRoot = Cba_ManRoot(p);
+    Gia_Man_t * pNew, * pTemp;
+    Vec_Ptr_t * vTemps, * vNtks;
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    abctime clk = Abc_Clock();
+    int i, k, iNtk, iNext, nTemps = 0;
+    if ( Cba_NtkBoxUserNum(pRoot) == 0 )
+        return Cba_NtkBlast( pRoot, fSeq );
+    if ( (vLevels = Cba_ManBlastLevels(p)) == NULL )
+        return NULL;
+    nProcs = Abc_MinInt( Abc_MaxInt(nProcs, 1), CBA_THR_MAX );
+#ifndef ABC_USE_PTHREADS
+    nProcs = 1;
+#endif
+    vTemps = Vec_PtrStart( Cba_ManNtkNum(p) + 1 );
+    vNtks  = Vec_PtrAlloc( 100 );
+    memset( ThData, 0, sizeof(Cba_BlastThData_t) * nProcs );
+    Vec_WecForEachLevel( vLevels, vLevel, i )
+    {
+        Vec_PtrClear( vNtks );
+        Vec_IntForEachEntry( vLevel, iNtk, k )
+            Vec_PtrPush( vNtks, Cba_ManNtk(p, iNtk) );
+        nTemps += Vec_PtrSize(vNtks);
+        iNext = 0;
+        for ( k = 0; k < nProcs; k++ )
+        {
+            ThData[k].vNtks  = vNtks;
+            ThData[k].vTemps = vTemps;
+            ThData[k].piNext = &iNext;
+        }
+#ifdef ABC_USE_PTHREADS
+        if ( nProcs > 1 && Vec_PtrSize(vNtks) > 1 )
+        {
+            pthread_t WorkerThread[CBA_THR_MAX];
+            pthread_mutex_t Mutex;
+            int status, nThreads = Abc_MinInt( nProcs, Vec_PtrSize(vNtks) );
+            pthread_mutex_init( &Mutex, NULL );
+            for ( k = 0; k < nThreads; k++ )
+            {
+                ThData[k].pMutex = (void *)&Mutex;
+                status = pthread_create( WorkerThread + k, NULL, Cba_ManBlastWorkerThread, (void *)(ThData + k) );  assert( status == 0 );
+            }
+            for ( k = 0; k < nThreads; k++ )
+                pthread_join( WorkerThread[k], NULL );
+            pthread_mutex_destroy( &Mutex );
+            for ( k = 0; k < nThreads; k++ )
+                ThData[k].pMutex = NULL;
+            continue;
+        }
+#endif
+        Cba_ManBlastLevel( ThData );
+    }
+    if ( fVerbose )
+    {
+        printf( "Blasted %d modules on %d levels using %d thread%s.  ", nTemps, Vec_WecSize(vLevels), nProcs, nProcs > 1 ? "s" : "" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // blast the root using the templates
+    memset( p->nAnds, 0, sizeof(int) * CBA_BOX_LAST );
+    pNew = Cba_NtkBlastInt( pRoot, fSeq, vTemps, p->nAnds );
+    Vec_PtrForEachEntry( Gia_Man_t *, vTemps, pTemp, i )
+        if ( pTemp )
+            Gia_ManStop( pTemp );
+    Vec_PtrFree( vTemps );
+    Vec_PtrFree( vNtks );
+    Vec_WecFree( vLevels );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Total blasting time", Abc_Clock() - clk );
+    return pNew;
 }
 
 /**Function*************************************************************
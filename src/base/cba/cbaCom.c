@@ -353,12 +353,23 @@ int Cba_CommandPut( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Cba_Man_t * p = Cba_AbcGetMan(pAbc);
     Gia_Man_t * pGia = NULL;
-    int c, fBarBufs = 1, fSeq = 0, fVerbose  = 0;
+    int c, nProcs = 1, fBarBufs = 1, fSeq = 0, fVerbose  = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "bsvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pbsvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
         case 'b':
             fBarBufs ^= 1;
             break;
@@ -379,7 +390,7 @@ int Cba_CommandPut( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( 1, "Cba_CommandPut(): There is no current design.\n" );
         return 0;
     }
-    pGia = Cba_ManBlast( p, fBarBufs, fSeq, fVerbose );
+    pGia = Cba_ManBlast( p, fBarBufs, fSeq, nProcs, fVerbose );
     if ( pGia == NULL )
     {
         Abc_Print( 1, "Cba_CommandPut(): Conversion to AIG has failed.\n" );
@@ -388,8 +399,9 @@ int Cba_CommandPut( Abc_Frame_t * pAbc, int argc, char ** argv )
     Abc_FrameUpdateGia( pAbc, pGia );
     return 0;
 usage:
-    Abc_Print( -2, "usage: @put [-bsvh]\n" );
+    Abc_Print( -2, "usage: @put [-P num] [-bsvh]\n" );
     Abc_Print( -2, "\t         extracts AIG from the hierarchical design\n" );
+    Abc_Print( -2, "\t-P num : the number of threads blasting the modules [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-b     : toggle using barrier buffers [default = %s]\n", fBarBufs? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle blasting sequential elements [default = %s]\n", fSeq? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
@@ -524,12 +536,23 @@ int Cba_CommandBlast( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Gia_Man_t * pNew = NULL;
     Cba_Man_t * p = Cba_AbcGetMan(pAbc);
-    int c, fSeq = 0, fVerbose  = 0;
+    int c, nProcs = 1, fSeq = 0, fVerbose  = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "svh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Psvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
         case 's':
             fSeq ^= 1;
             break;
@@ -547,7 +570,7 @@ int Cba_CommandBlast( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( 1, "Cba_CommandBlast(): There is no current design.\n" );
         return 0;
     }
-    pNew = Cba_ManBlast( p, 0, fSeq, fVerbose );
+    pNew = Cba_ManBlast( p, 0, fSeq, nProcs, fVerbose );
     if ( pNew == NULL )
     {
         Abc_Print( 1, "Cba_CommandBlast(): Bit-blasting has failed.\n" );
@@ -556,8 +579,9 @@ int Cba_CommandBlast( Abc_Frame_t * pAbc, int argc, char ** argv )
     Abc_FrameUpdateGia( pAbc, pNew );
     return 0;
 usage:
-    Abc_Print( -2, "usage: %%blast [-svh]\n" );
+    Abc_Print( -2, "usage: %%blast [-P num] [-svh]\n" );
     Abc_Print( -2, "\t         performs bit-blasting of the word-level design\n" );
+    Abc_Print( -2, "\t-P num : the number of threads blasting the modules [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-s     : toggle blasting sequential elements [default = %s]\n", fSeq? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -632,7 +656,7 @@ int Cba_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
     fclose( pFile );
 
     // extract AIG from the current design
-    pFirst = Cba_ManBlast( p, 0, 0, 0 );
+    pFirst = Cba_ManBlast( p, 0, 0, 1, 0 );
     if ( pFirst == NULL )
     {
         Abc_Print( -1, "Extracting AIG from the current design has failed.\n" );
@@ -647,7 +671,7 @@ int Cba_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
     else if ( !strcmp( Extra_FileNameExtension(pFileName), "cba" )  )
         pTemp = Cba_ManReadCba( pFileName );
     else assert( 0 );
-    pSecond = Cba_ManBlast( pTemp, 0, 0, 0 );
+    pSecond = Cba_ManBlast( pTemp, 0, 0, 1, 0 );
     Cba_ManFree( pTemp );
     if ( pSecond == NULL )
     {
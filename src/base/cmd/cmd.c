@@ -28,6 +28,7 @@
 #include "base/main/mainInt.h"
 #include "cmdInt.h"
 #include "misc/util/utilSignal.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -36,6 +37,7 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 static int CmdCommandTime          ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandProfile       ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandEcho          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandQuit          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandAbcrc         ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -60,6 +62,8 @@ static int CmdCommandSis           ( Abc_Frame_t * pAbc, int argc, char ** argv
 static int CmdCommandMvsis         ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandCapo          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandStarter       ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandServer        ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandBench         ( Abc_Frame_t * pAbc, int argc, char ** argv );
 
 extern int Cmd_CommandAbcLoadPlugIn( Abc_Frame_t * pAbc, int argc, char ** argv );
 
@@ -85,6 +89,7 @@ void Cmd_Init( Abc_Frame_t * pAbc )
     Cmd_HistoryRead( pAbc );
 
     Cmd_CommandAdd( pAbc, "Basic", "time",          CmdCommandTime,            0 );
+    Cmd_CommandAdd( pAbc, "Basic", "profile",       CmdCommandProfile,         0 );
     Cmd_CommandAdd( pAbc, "Basic", "echo",          CmdCommandEcho,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "quit",          CmdCommandQuit,            0 );
     Cmd_CommandAdd( pAbc, "Basic", "abcrc",         CmdCommandAbcrc,           0 );
@@ -110,6 +115,8 @@ void Cmd_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "Various", "mvsis",       CmdCommandMvsis,           1 );
     Cmd_CommandAdd( pAbc, "Various", "capo",        CmdCommandCapo,            0 );
     Cmd_CommandAdd( pAbc, "Various", "starter",     CmdCommandStarter,         0 );
+    Cmd_CommandAdd( pAbc, "Various", "server",      CmdCommandServer,          0 );
+    Cmd_CommandAdd( pAbc, "Various", "bench",       CmdCommandBench,           0 );
 
     Cmd_CommandAdd( pAbc, "Various", "load_plugin", Cmd_CommandAbcLoadPlugIn,  0 );
 }
@@ -148,6 +155,13 @@ void Cmd_End( Abc_Frame_t * pAbc )
     st__free_table( pAbc->tFlags );
 
     Vec_PtrFreeFree( pAbc->aHistory );
+
+    // the profiler is shared by all frames
+    if ( Abc_FrameIsLast(pAbc) )
+    {
+        Abc_ProfStop();
+        Abc_ProfClear();
+    }
 }
 
 
@@ -219,6 +233,93 @@ int CmdCommandTime( Abc_Frame_t * pAbc, int argc, char **argv )
     return 1;
 }
 
+/**Function********************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+int CmdCommandProfile( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    char * pFileJson = NULL, * pFileTrace = NULL;
+    int c, fToggle = 0, fClear = 0, fPrint = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "jtscph" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'j':
+            if ( globalUtilOptind >= argc )
+            {
+                fprintf( pAbc->Err, "Command line switch \"-j\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pFileJson = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 't':
+            if ( globalUtilOptind >= argc )
+            {
+                fprintf( pAbc->Err, "Command line switch \"-t\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pFileTrace = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 's':
+            fToggle ^= 1;
+            break;
+        case 'c':
+            fClear ^= 1;
+            break;
+        case 'p':
+            fPrint ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind )
+        goto usage;
+    if ( !fToggle && !fClear && !pFileJson && !pFileTrace )
+        fPrint = 1;
+    if ( fPrint )
+        Abc_ProfPrint( pAbc->Out );
+    if ( pFileJson && !Abc_ProfDumpJson( pFileJson ) )
+        fprintf( pAbc->Err, "Cannot write profiling data into file \"%s\".\n", pFileJson );
+    if ( pFileTrace && !Abc_ProfDumpTrace( pFileTrace ) )
+        fprintf( pAbc->Err, "Cannot write profiling trace into file \"%s\".\n", pFileTrace );
+    if ( fClear )
+        Abc_ProfClear();
+    if ( fToggle )
+    {
+        if ( Abc_ProfIsOn() )
+            Abc_ProfStop();
+        else
+            Abc_ProfStart();
+    }
+    return 0;
+
+  usage:
+    fprintf( pAbc->Err, "usage: profile [-scph] [-j <file>] [-t <file>]\n" );
+    fprintf( pAbc->Err, "      \t\trecords the runtime and the peak memory of each command\n" );
+    fprintf( pAbc->Err, "      \t\tand of the phases inside (such as cut enumeration or SAT)\n" );
+    fprintf( pAbc->Err, "   -s \t\tstarts or stops recording [default = %s]\n", Abc_ProfIsOn()? "on": "off" );
+    fprintf( pAbc->Err, "   -c \t\tclears the recorded data\n" );
+    fprintf( pAbc->Err, "   -p \t\tprints the summary (default if no other action is given)\n" );
+    fprintf( pAbc->Err, "   -j <file> : writes the recorded data in JSON\n" );
+    fprintf( pAbc->Err, "   -t <file> : writes the recorded data in Chrome trace format\n" );
+    fprintf( pAbc->Err, "   -h \t\tprint the command usage\n" );
+    return 1;
+}
+
 /**Function********************************************************************
 
   Synopsis    []
@@ -2476,6 +2577,231 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int CmdCommandServer( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    extern int Cmd_RunServer( Abc_Frame_t * pAbc, char * pSockName, int nJobsMax, int nReqsMax, int fVerbose );
+    extern int Cmd_RunClient( char * pSockName, char * pScript );
+    char * pScript = NULL;
+    int c, nJobsMax  =  4;
+    int nReqsMax     =  0;
+    int fVerbose     =  0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "NRCvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nJobsMax = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nJobsMax <= 0 ) 
+                goto usage;
+            break;
+        case 'R':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-R\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nReqsMax = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nReqsMax < 0 ) 
+                goto usage;
+            break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by a string (possibly in quotes).\n" );
+                goto usage;
+            }
+            pScript = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+    {
+        Abc_Print( -2, "The socket name should be given on the command line.\n" );
+        return 1;
+    }
+    if ( pScript )
+        return Cmd_RunClient( argv[globalUtilOptind], pScript ) != 0;
+    return Cmd_RunServer( pAbc, argv[globalUtilOptind], nJobsMax, nReqsMax, fVerbose );
+
+usage:
+    Abc_Print( -2, "usage: server [-NR num] [-C cmd] [-vh] <socket>\n" );
+    Abc_Print( -2, "\t         keeps the current ABC session (with the libraries loaded) resident\n" );
+    Abc_Print( -2, "\t         and executes the scripts received over the Unix-domain socket;\n" );
+    Abc_Print( -2, "\t         each script runs in a forked copy of the session, which sends back\n" );
+    Abc_Print( -2, "\t         the output followed by the line \"ABC_STATUS <num>\"\n" );
+    Abc_Print( -2, "\t-N num : the number of concurrent jobs [default = %d]\n", nJobsMax );
+    Abc_Print( -2, "\t-R num : the number of requests to serve before stopping (0 = no limit) [default = %d]\n", nReqsMax );
+    Abc_Print( -2, "\t-C cmd : sends the script to the server running on <socket> and prints the output\n" );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    Abc_Print( -2, "\t<socket> : the file name of the socket\n");
+    return 1;
+}
+
+/**Function********************************************************************
+
+  Synopsis    [Runs the built-in benchmarks or compares their results.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+******************************************************************************/
+int CmdCommandBench( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    extern int  Cmd_BenchRun( Abc_Frame_t * pAbc, char * pFilter, int nRuns, char * pFileName );
+    extern int  Cmd_BenchCompare( char * pFileBase, char * pFileNew, double TimeLimit, double MemLimit, double QorLimit );
+    extern void Cmd_BenchPrintFlows();
+    char * pFilter   = NULL;
+    char * pFileName = NULL;
+    double TimeLimit = 10;
+    double MemLimit  = 10;
+    double QorLimit  =  0;
+    int c, nRuns     =  1;
+    int fCompare     =  0;
+    int fList        =  0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "RFoTMQclh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'R':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-R\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nRuns = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nRuns <= 0 ) 
+                goto usage;
+            break;
+        case 'F':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-F\" should be followed by a string.\n" );
+                goto usage;
+            }
+            pFilter = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'o':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-o\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pFileName = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by a number.\n" );
+                goto usage;
+            }
+            TimeLimit = atof(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( TimeLimit < 0 ) 
+                goto usage;
+            break;
+        case 'M':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-M\" should be followed by a number.\n" );
+                goto usage;
+            }
+            MemLimit = atof(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( MemLimit < 0 ) 
+                goto usage;
+            break;
+        case 'Q':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-Q\" should be followed by a number.\n" );
+                goto usage;
+            }
+            QorLimit = atof(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( QorLimit < 0 ) 
+                goto usage;
+            break;
+        case 'c':
+            fCompare ^= 1;
+            break;
+        case 'l':
+            fList ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( fList )
+    {
+        Cmd_BenchPrintFlows();
+        return 0;
+    }
+    if ( fCompare )
+    {
+        if ( argc != globalUtilOptind + 2 )
+        {
+            Abc_Print( -1, "Two result files should be given on the command line.\n" );
+            return 1;
+        }
+        return Cmd_BenchCompare( argv[globalUtilOptind], argv[globalUtilOptind+1], TimeLimit, MemLimit, QorLimit ) != 0;
+    }
+    if ( argc != globalUtilOptind )
+        goto usage;
+    return Cmd_BenchRun( pAbc, pFilter, nRuns, pFileName );
+
+usage:
+    Abc_Print( -2, "usage: bench [-R num] [-F name] [-o file] [-TMQ num] [-clh] [<base.json> <new.json>]\n" );
+    Abc_Print( -2, "\t         runs the built-in catalog of flows on the bundled and generated designs\n" );
+    Abc_Print( -2, "\t         and reports runtime, peak memory and quality of results\n" );
+    Abc_Print( -2, "\t-R num  : the number of runs of each flow (the fastest one is reported) [default = %d]\n", nRuns );
+    Abc_Print( -2, "\t-F name : runs only the flows whose flow or design names contain this string [default = all]\n" );
+    Abc_Print( -2, "\t-o file : the JSON file to write the results [default = none]\n" );
+    Abc_Print( -2, "\t-T num  : the wall-time increase (in percent) reported as a regression [default = %.1f]\n", TimeLimit );
+    Abc_Print( -2, "\t-M num  : the memory increase (in percent) reported as a regression [default = %.1f]\n", MemLimit );
+    Abc_Print( -2, "\t-Q num  : the quality degradation (in percent) reported as a regression [default = %.1f]\n", QorLimit );
+    Abc_Print( -2, "\t-c      : compares two result files instead of running the flows [default = %s]\n", fCompare? "yes": "no" );
+    Abc_Print( -2, "\t-l      : lists the flows [default = %s]\n", fList? "yes": "no" );
+    Abc_Print( -2, "\t-h      : print the command usage\n");
+    return 1;
+}
+
 /**Function********************************************************************
 
   Synopsis    [Print the version string.]
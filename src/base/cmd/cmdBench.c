@@ -0,0 +1,700 @@
+/**CFile****************************************************************
+
+  FileName    [cmdBench.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Built-in performance benchmarks.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: cmdBench.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/mainInt.h"
+#include "aig/gia/gia.h"
+#include "misc/util/utilSignal.h"
+#include "misc/util/utilProf.h"
+#include "cmdInt.h"
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#include <sys/time.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The benchmark runs a fixed catalog of flows. Each flow is executed in
+// a fresh session (the resource file is not sourced, so the scripts use
+// the full command names), which makes the results independent of the
+// order of the flows and of the state of the current session. The designs
+// are either bundled with the sources (i10.aig) or generated.
+
+// the designs
+enum { CMD_BENCH_I10, CMD_BENCH_MULT, CMD_BENCH_SEQ, CMD_BENCH_DESIGNS };
+static char * s_BenchDesigns[CMD_BENCH_DESIGNS] = { "i10", "mult32", "counters" };
+
+// the sizes of the generated designs
+#define CMD_BENCH_MULT_BITS   32
+#define CMD_BENCH_CNT_BITS    32
+
+// the quality metrics
+enum { CMD_BENCH_AND, CMD_BENCH_LUT, CMD_BENCH_AREA, CMD_BENCH_STATUS, CMD_BENCH_FRAMES };
+static char * s_BenchMetrics[] = { "and", "lut", "area", "status", "frames" };
+
+typedef struct Cmd_BenchFlow_t_ Cmd_BenchFlow_t;
+struct Cmd_BenchFlow_t_
+{
+    char *       pName;          // the name of the flow
+    int          iDesign;        // the design
+    int          Metric;         // the quality metric
+    char *       pScript;        // the script ("%s" stands for the design file)
+};
+
+static Cmd_BenchFlow_t s_BenchFlows[] = {
+    { "dc2",     CMD_BENCH_I10,   CMD_BENCH_AND,     "read %s; strash; dc2"                 },
+    { "dc2",     CMD_BENCH_MULT,  CMD_BENCH_AND,     "read %s; strash; dc2"                 },
+    { "&if",     CMD_BENCH_I10,   CMD_BENCH_LUT,     "&r %s; &st; &if -K 6"                 },
+    { "&if",     CMD_BENCH_MULT,  CMD_BENCH_LUT,     "&r %s; &st; &if -K 6"                 },
+    { "&nf",     CMD_BENCH_I10,   CMD_BENCH_AREA,    "&r %s; &st; &nf; &put"                },
+    { "&nf",     CMD_BENCH_MULT,  CMD_BENCH_AREA,    "&r %s; &st; &nf; &put"                },
+    { "&cec",    CMD_BENCH_MULT,  CMD_BENCH_STATUS,  "&r %s; &st; &syn2; &dc2; &cec"        },
+    { "bmc3",    CMD_BENCH_SEQ,   CMD_BENCH_FRAMES,  "read %s; strash; bmc3 -F 100"         },
+    { "pdr",     CMD_BENCH_SEQ,   CMD_BENCH_STATUS,  "read %s; strash; pdr"                 },
+    { "scorr",   CMD_BENCH_SEQ,   CMD_BENCH_AND,     "read %s; strash; scorr"               },
+    { NULL,      0,               0,                 NULL                                   }
+};
+
+// the cell library used by the standard-cell mapper
+static char * s_BenchGenlib =
+    "GATE ZERO    0  O=CONST0;\n"
+    "GATE ONE     0  O=CONST1;\n"
+    "GATE INV     1  O=!a;              PIN * INV    1 999 0.9 0.3 0.9 0.3\n"
+    "GATE BUF     2  O=a;               PIN * NONINV 1 999 1.0 0.0 1.0 0.0\n"
+    "GATE NAND2   2  O=!(a*b);          PIN * INV    1 999 1.0 0.2 1.0 0.2\n"
+    "GATE NAND3   3  O=!(a*b*c);        PIN * INV    1 999 1.1 0.3 1.1 0.3\n"
+    "GATE NOR2    2  O=!(a+b);          PIN * INV    1 999 1.4 0.5 1.4 0.5\n"
+    "GATE NOR3    3  O=!(a+b+c);        PIN * INV    1 999 2.4 0.7 2.4 0.7\n"
+    "GATE AND2    3  O=a*b;             PIN * NONINV 1 999 1.9 0.3 1.9 0.3\n"
+    "GATE OR2     3  O=a+b;             PIN * NONINV 1 999 2.4 0.3 2.4 0.3\n"
+    "GATE AOI21   3  O=!(a*b+c);        PIN * INV    1 999 1.6 0.4 1.6 0.4\n"
+    "GATE OAI21   3  O=!((a+b)*c);      PIN * INV    1 999 1.6 0.4 1.6 0.4\n"
+    "GATE XOR2    5  O=a*!b+!a*b;       PIN * UNKNOWN 2 999 1.9 0.5 1.9 0.5\n"
+    "GATE XNOR2   5  O=a*b+!a*!b;       PIN * UNKNOWN 2 999 2.1 0.5 2.1 0.5\n";
+
+typedef struct Cmd_BenchRes_t_ Cmd_BenchRes_t;
+struct Cmd_BenchRes_t_
+{
+    int          fFailed;        // the script failed
+    double       Time;           // CPU time of the calling thread in seconds (the smallest over the runs)
+    double       Wall;           // wall time in seconds (the smallest over the runs)
+    double       Mem;            // peak resident memory in MB (the largest over the runs)
+    double       Qor;            // the value of the quality metric
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns wall time in seconds.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static double Cmd_BenchWallTime()
+{
+#ifndef _WIN32
+    struct timeval tv;
+    gettimeofday( &tv, NULL );
+    return (double)tv.tv_sec + 1.0e-6 * tv.tv_usec;
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resets or reads the peak resident memory in MB.]
+
+  Description [On Linux, the peak is reset before each run, so that
+  the memory of the previous runs is not counted. Elsewhere, returns
+  the peak of the process.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static double Cmd_BenchPeakMem( int fReset )
+{
+#ifdef __linux__
+    char Buffer[256];
+    double Peak = -1;
+    FILE * pFile;
+    if ( fReset )
+    {
+#ifdef __GLIBC__
+        // return the memory freed by the previous flows to the system
+        malloc_trim( 0 );
+#endif
+        pFile = fopen( "/proc/self/clear_refs", "w" );
+        if ( pFile )
+        {
+            fputs( "5", pFile );
+            fclose( pFile );
+        }
+        return 0;
+    }
+    pFile = fopen( "/proc/self/status", "r" );
+    if ( pFile )
+    {
+        while ( fgets( Buffer, 256, pFile ) )
+            if ( !strncmp( Buffer, "VmHWM:", 6 ) )
+            {
+                Peak = atof( Buffer + 6 ) / 1024;
+                break;
+            }
+        fclose( pFile );
+    }
+    if ( Peak >= 0 )
+        return Peak;
+#endif
+    return fReset ? 0 : (double)Abc_ProfPeakRss() / 1024;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Generates the binary counter and the Gray-code counter.]
+
+  Description [Both counters are incremented when the input is 1. The
+  output is 1 if the Gray-code counter differs from the Gray code of the
+  binary counter, which never happens. The proof needs the relations
+  between the state bits of the two counters, which are not equivalences.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Cmd_BenchGenCounters( int nBits )
+{
+    Gia_Man_t * p;
+    Vec_Int_t * vBin  = Vec_IntAlloc( nBits );
+    Vec_Int_t * vGray = Vec_IntAlloc( nBits );
+    Vec_Int_t * vNext = Vec_IntAlloc( 2 * nBits );
+    int i, iEn, iCarry, iCarry2, iPref, iLit, iOut = 0;
+    p = Gia_ManStart( 20 * nBits );
+    p->pName = Abc_UtilStrsav( "counters" );
+    iEn = Gia_ManAppendCi( p );
+    for ( i = 0; i < nBits; i++ )
+        Vec_IntPush( vBin, Gia_ManAppendCi(p) );
+    for ( i = 0; i < nBits; i++ )
+        Vec_IntPush( vGray, Gia_ManAppendCi(p) );
+    Gia_ManHashAlloc( p );
+    // the property: the Gray code of the binary counter is equal to the Gray-code counter
+    for ( i = 0; i < nBits; i++ )
+    {
+        iLit = i + 1 < nBits ? Gia_ManHashXor( p, Vec_IntEntry(vBin, i), Vec_IntEntry(vBin, i+1) ) : Vec_IntEntry(vBin, i);
+        iOut = Gia_ManHashOr( p, iOut, Gia_ManHashXor(p, iLit, Vec_IntEntry(vGray, i)) );
+    }
+    // the next state of the binary counter
+    iCarry = iEn;
+    for ( i = 0; i < nBits; i++ )
+    {
+        Vec_IntPush( vNext, Gia_ManHashXor(p, Vec_IntEntry(vBin, i), iCarry) );
+        iCarry = Gia_ManHashAnd( p, Vec_IntEntry(vBin, i), iCarry );
+    }
+    // the next state of the Gray-code counter (converted to binary, incremented, converted back)
+    iCarry = iEn;
+    iPref  = 0;
+    for ( i = nBits - 1; i >= 0; i-- )
+        Vec_IntWriteEntry( vGray, i, (iPref = Gia_ManHashXor(p, iPref, Vec_IntEntry(vGray, i))) );
+    for ( i = 0; i < nBits; i++ )
+    {
+        iCarry2 = Gia_ManHashAnd( p, Vec_IntEntry(vGray, i), iCarry );
+        Vec_IntWriteEntry( vGray, i, Gia_ManHashXor(p, Vec_IntEntry(vGray, i), iCarry) );
+        iCarry = iCarry2;
+    }
+    for ( i = 0; i < nBits; i++ )
+        Vec_IntPush( vNext, i + 1 < nBits ? Gia_ManHashXor(p, Vec_IntEntry(vGray, i), Vec_IntEntry(vGray, i+1)) : Vec_IntEntry(vGray, i) );
+    Gia_ManHashStop( p );
+    Gia_ManAppendCo( p, iOut );
+    Vec_IntForEachEntry( vNext, iLit, i )
+        Gia_ManAppendCo( p, iLit );
+    Gia_ManSetRegNum( p, 2 * nBits );
+    Vec_IntFree( vBin );
+    Vec_IntFree( vGray );
+    Vec_IntFree( vNext );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a temporary file.]
+
+  Description [The file name is added to vTemps. Returns NULL if the 
+  file cannot be created.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Cmd_BenchTempFile( char * pSuffix, Vec_Ptr_t * vTemps )
+{
+    char * pFileName = NULL;
+    int fd = Util_SignalTmpFile( "__abctmp_bench_", pSuffix, &pFileName );
+    if ( fd == -1 )
+    {
+        Abc_Print( -1, "Cannot create a temporary file.\n" );
+        return NULL;
+    }
+#ifdef WIN32
+    _close( fd );
+#else
+    close( fd );
+#endif
+    Vec_PtrPush( vTemps, pFileName );
+    return pFileName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Executes the script in a new session.]
+
+  Description [Returns the session, which should be stopped by the caller,
+  or NULL if the script failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Frame_t * Cmd_BenchExecute( char * pScript )
+{
+    Abc_Frame_t * pSes = Abc_SessionStart();
+    if ( Abc_SessionExecute( pSes, pScript ) )
+    {
+        Abc_Print( -1, "Benchmark script \"%s\" has failed.\n", pScript );
+        Abc_SessionStop( pSes );
+        return NULL;
+    }
+    return pSes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the designs.]
+
+  Description [Generated designs are written into temporary files,
+  which are collected in vTemps. The unavailable designs are NULL.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_BenchPrepare( char ** pFiles, char ** ppGenlib, Vec_Ptr_t * vTemps )
+{
+    char Command[1000], * pTemp, * pTemp2;
+    Abc_Frame_t * pSes;
+    Gia_Man_t * pGia;
+    FILE * pFile;
+    int i;
+    for ( i = 0; i < CMD_BENCH_DESIGNS; i++ )
+        pFiles[i] = NULL;
+    // the cell library
+    if ( (*ppGenlib = Cmd_BenchTempFile( ".genlib", vTemps )) == NULL )
+        return 0;
+    if ( (pFile = fopen( *ppGenlib, "wb" )) == NULL )
+    {
+        Abc_Print( -1, "Cannot open file \"%s\" for writing.\n", *ppGenlib );
+        return 0;
+    }
+    fputs( s_BenchGenlib, pFile );
+    fclose( pFile );
+    // the design bundled with the sources
+    if ( (pFile = fopen( "i10.aig", "rb" )) )
+    {
+        fclose( pFile );
+        pFiles[CMD_BENCH_I10] = Abc_UtilStrsav( "i10.aig" );
+    }
+    else
+        Abc_Print( 0, "Cannot find \"i10.aig\" in the current directory. The flows using it are skipped.\n" );
+    // the multiplier
+    pTemp = Cmd_BenchTempFile( ".blif", vTemps );
+    pTemp2 = Cmd_BenchTempFile( ".aig", vTemps );
+    if ( pTemp == NULL || pTemp2 == NULL )
+        return 0;
+    sprintf( Command, "gen -m -N %d %s; read %s; strash; write_aiger %s", CMD_BENCH_MULT_BITS, pTemp, pTemp, pTemp2 );
+    if ( (pSes = Cmd_BenchExecute( Command )) )
+        pFiles[CMD_BENCH_MULT] = pTemp2, Abc_SessionStop( pSes );
+    // the pair of counters
+    if ( (pTemp = Cmd_BenchTempFile( ".aig", vTemps )) == NULL )
+        return 0;
+    pGia = Cmd_BenchGenCounters( CMD_BENCH_CNT_BITS );
+    Gia_AigerWrite( pGia, pTemp, 0, 0 );
+    Gia_ManStop( pGia );
+    pFiles[CMD_BENCH_SEQ] = pTemp;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one flow.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_BenchRunFlow( Cmd_BenchFlow_t * pFlow, char * pFile, char * pGenlib, int nRuns, Cmd_BenchRes_t * pRes )
+{
+    char Command[1000];
+    Abc_Frame_t * pSes;
+    Abc_Ntk_t * pNtk;
+    double Wall, Mem;
+    abctime clk;
+    int r;
+    memset( pRes, 0, sizeof(Cmd_BenchRes_t) );
+    sprintf( Command, pFlow->pScript, pFile );
+    for ( r = 0; r < nRuns; r++ )
+    {
+        pSes = Abc_SessionStart();
+        if ( pFlow->Metric == CMD_BENCH_AREA )
+        {
+            sprintf( Command, "read_genlib %s", pGenlib );
+            if ( Abc_SessionExecute( pSes, Command ) )
+            {
+                Abc_Print( -1, "Reading the cell library has failed.\n" );
+                Abc_SessionStop( pSes );
+                pRes->fFailed = 1;
+                break;
+            }
+            sprintf( Command, pFlow->pScript, pFile );
+        }
+        Cmd_BenchPeakMem( 1 );
+        Wall = Cmd_BenchWallTime();
+        clk  = Abc_Clock();
+        pRes->fFailed = Abc_SessionExecute( pSes, Command ) != 0;
+        clk  = Abc_Clock() - clk;
+        Wall = Cmd_BenchWallTime() - Wall;
+        Mem  = Cmd_BenchPeakMem( 0 );
+        if ( r == 0 || pRes->Time > 1.0 * clk / CLOCKS_PER_SEC )
+            pRes->Time = 1.0 * clk / CLOCKS_PER_SEC;
+        if ( r == 0 || pRes->Wall > Wall )
+            pRes->Wall = Wall;
+        pRes->Mem = Abc_MaxDouble( pRes->Mem, Mem );
+        // collect the quality metric
+        pNtk = pSes->pNtkCur;
+        if ( pFlow->Metric == CMD_BENCH_AND )
+            pRes->Qor = pNtk ? Abc_NtkNodeNum(pNtk) : -1;
+        else if ( pFlow->Metric == CMD_BENCH_LUT )
+            pRes->Qor = (pSes->pGia && Gia_ManHasMapping(pSes->pGia)) ? Gia_ManLutNum(pSes->pGia) : -1;
+        else if ( pFlow->Metric == CMD_BENCH_AREA )
+            pRes->Qor = (pNtk && Abc_NtkHasMapping(pNtk)) ? Abc_NtkGetMappedArea(pNtk) : -1;
+        else if ( pFlow->Metric == CMD_BENCH_STATUS )
+            pRes->Qor = pSes->Status;
+        else if ( pFlow->Metric == CMD_BENCH_FRAMES )
+            pRes->Qor = pSes->nFrames;
+        Abc_SessionStop( pSes );
+        if ( pRes->fFailed )
+            break;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the benchmarks and writes the results.]
+
+  Description [Only the flows whose names or design names contain
+  pFilter are run. Returns 1 if the designs cannot be prepared or if
+  some of the flows have failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_BenchRun( Abc_Frame_t * pAbc, char * pFilter, int nRuns, char * pFileName )
+{
+    char * pFiles[CMD_BENCH_DESIGNS], * pGenlib, * pTemp;
+    Vec_Ptr_t * vTemps = Vec_PtrAlloc( 10 );
+    Cmd_BenchRes_t * pRes, * pResAll;
+    Cmd_BenchFlow_t * pFlow;
+    FILE * pFile = NULL;
+    int i, nFlows = 0, nFirst = 1, nFailed = 0;
+    if ( pFileName && (pFile = fopen( pFileName, "wb" )) == NULL )
+    {
+        Abc_Print( -1, "Cannot open file \"%s\" for writing.\n", pFileName );
+        Vec_PtrFree( vTemps );
+        return 1;
+    }
+    for ( pFlow = s_BenchFlows; pFlow->pName; pFlow++ )
+        nFlows++;
+    pResAll = ABC_CALLOC( Cmd_BenchRes_t, nFlows );
+    if ( !Cmd_BenchPrepare( pFiles, &pGenlib, vTemps ) )
+        nFlows = 0, nFailed++;
+    // run the flows
+    for ( i = 0, pFlow = s_BenchFlows; pFlow->pName; i++, pFlow++ )
+    {
+        pRes = pResAll + i;
+        pRes->fFailed = -1;
+        if ( nFlows == 0 )
+            continue;
+        if ( pFilter && !strstr( pFlow->pName, pFilter ) && !strstr( s_BenchDesigns[pFlow->iDesign], pFilter ) )
+            continue;
+        if ( pFiles[pFlow->iDesign] == NULL )
+            continue;
+        Abc_Print( 1, "Running flow \"%s\" on design \"%s\".\n", pFlow->pName, s_BenchDesigns[pFlow->iDesign] );
+        fflush( stdout );
+        Cmd_BenchRunFlow( pFlow, pFiles[pFlow->iDesign], pGenlib, nRuns, pRes );
+        nFailed += pRes->fFailed;
+    }
+    // print the results
+    Abc_Print( 1, "\n%-8s %-10s %10s %10s %10s %8s %12s\n", "Flow", "Design", "CPU, s", "Wall, s", "Mem, MB", "Metric", "Value" );
+    for ( i = 0, pFlow = s_BenchFlows; pFlow->pName; i++, pFlow++ )
+    {
+        pRes = pResAll + i;
+        if ( pRes->fFailed == -1 )
+            continue;
+        Abc_Print( 1, "%-8s %-10s ", pFlow->pName, s_BenchDesigns[pFlow->iDesign] );
+        if ( pRes->fFailed )
+            Abc_Print( 1, "%10s\n", "failed" );
+        else
+            Abc_Print( 1, "%10.3f %10.3f %10.1f %8s %12.2f\n", pRes->Time, pRes->Wall, pRes->Mem, s_BenchMetrics[pFlow->Metric], pRes->Qor );
+    }
+    // write the results
+    if ( pFile )
+    {
+        fprintf( pFile, "{\n" );
+        fprintf( pFile, "  \"version\": \"%s\",\n", pAbc->sVersion ? pAbc->sVersion : "" );
+        fprintf( pFile, "  \"runs\": %d,\n", nRuns );
+        fprintf( pFile, "  \"results\": [\n" );
+        for ( i = 0, pFlow = s_BenchFlows; pFlow->pName; i++, pFlow++ )
+        {
+            pRes = pResAll + i;
+            if ( pRes->fFailed == -1 )
+                continue;
+            fprintf( pFile, "%s    {\"flow\": \"%s\", \"design\": \"%s\", \"failed\": %d, \"time\": %.3f, \"wall\": %.3f, \"peak_mb\": %.1f, \"metric\": \"%s\", \"qor\": %.2f}",
+                nFirst ? "" : ",\n", pFlow->pName, s_BenchDesigns[pFlow->iDesign], pRes->fFailed,
+                pRes->Time, pRes->Wall, pRes->Mem, s_BenchMetrics[pFlow->Metric], pRes->Qor );
+            nFirst = 0;
+        }
+        fprintf( pFile, "\n  ]\n}\n" );
+        fclose( pFile );
+        Abc_Print( 1, "The results were written into file \"%s\".\n", pFileName );
+    }
+    // clean up
+    Vec_PtrForEachEntry( char *, vTemps, pTemp, i )
+    {
+        Util_SignalTmpFileRemove( pTemp, 0 );
+        ABC_FREE( pTemp );
+    }
+    Vec_PtrFree( vTemps );
+    ABC_FREE( pFiles[CMD_BENCH_I10] );
+    ABC_FREE( pResAll );
+    return nFailed > 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Extracts the value of the key from the JSON line.]
+
+  Description [Returns 0 if the key is not found.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_BenchJsonStr( char * pLine, char * pKey, char * pBuffer, int nSize )
+{
+    char * pCur, * pStop;
+    char Pattern[100];
+    sprintf( Pattern, "\"%s\": \"", pKey );
+    if ( (pCur = strstr( pLine, Pattern )) == NULL )
+        return 0;
+    pCur += strlen( Pattern );
+    if ( (pStop = strchr( pCur, '\"' )) == NULL || pStop - pCur >= nSize )
+        return 0;
+    strncpy( pBuffer, pCur, pStop - pCur );
+    pBuffer[pStop - pCur] = 0;
+    return 1;
+}
+static double Cmd_BenchJsonNum( char * pLine, char * pKey )
+{
+    char * pCur;
+    char Pattern[100];
+    sprintf( Pattern, "\"%s\": ", pKey );
+    if ( (pCur = strstr( pLine, Pattern )) == NULL )
+        return -1;
+    return atof( pCur + strlen(Pattern) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the results written by Cmd_BenchRun().]
+
+  Description [Each entry of the array is the line of one flow.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Ptr_t * Cmd_BenchReadResults( char * pFileName )
+{
+    Vec_Ptr_t * vLines;
+    char Buffer[1000];
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( -1, "Cannot open file \"%s\" with the benchmark results.\n", pFileName );
+        return NULL;
+    }
+    vLines = Vec_PtrAlloc( 100 );
+    while ( fgets( Buffer, 1000, pFile ) )
+        if ( strstr( Buffer, "\"flow\": " ) )
+            Vec_PtrPush( vLines, Abc_UtilStrsav(Buffer) );
+    fclose( pFile );
+    return vLines;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares two result files.]
+
+  Description [Reports a regression when the wall time or the memory grows by
+  more than the given percentage (and by more than 0.05 sec or 1 MB, to
+  ignore the noise on small runs), when the quality metric grows by more
+  than the given percentage (for "status" and "frames", when it changes),
+  or when the flow failed or is missing. The CPU time is only printed,
+  because Abc_Clock() does not count the time of the worker threads.
+  Returns the number of regressions or -1 if a file cannot be read.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_BenchCompare( char * pFileBase, char * pFileNew, double TimeLimit, double MemLimit, double QorLimit )
+{
+    Vec_Ptr_t * vBase, * vNew;
+    char Flow[100], Design[100], Metric[100], Flow2[100], Design2[100];
+    char * pLine, * pLine2, * pMatch;
+    double Base, New;
+    int i, k, nRegs = 0, fExact;
+    vBase = Cmd_BenchReadResults( pFileBase );
+    vNew  = Cmd_BenchReadResults( pFileNew );
+    if ( vBase == NULL || vNew == NULL )
+    {
+        if ( vBase ) Vec_PtrFreeFree( vBase );
+        if ( vNew )  Vec_PtrFreeFree( vNew );
+        return -1;
+    }
+    Abc_Print( 1, "%-8s %-10s %-8s %12s %12s %9s\n", "Flow", "Design", "Value", "Base", "New", "Change" );
+    Vec_PtrForEachEntry( char *, vBase, pLine, i )
+    {
+        if ( !Cmd_BenchJsonStr( pLine, "flow", Flow, 100 ) || !Cmd_BenchJsonStr( pLine, "design", Design, 100 ) )
+            continue;
+        Cmd_BenchJsonStr( pLine, "metric", Metric, 100 );
+        // find the matching flow
+        pMatch = NULL;
+        Vec_PtrForEachEntry( char *, vNew, pLine2, k )
+            if ( Cmd_BenchJsonStr( pLine2, "flow", Flow2, 100 ) && !strcmp( Flow, Flow2 ) &&
+                 Cmd_BenchJsonStr( pLine2, "design", Design2, 100 ) && !strcmp( Design, Design2 ) )
+            {
+                pMatch = pLine2;
+                break;
+            }
+        if ( pMatch == NULL || Cmd_BenchJsonNum( pMatch, "failed" ) > 0 )
+        {
+            if ( Cmd_BenchJsonNum( pLine, "failed" ) > 0 )
+                continue;
+            Abc_Print( 1, "%-8s %-10s %s   REGRESSION\n", Flow, Design, pMatch ? "failed" : "missing" );
+            nRegs++;
+            continue;
+        }
+        // wall time
+        Base = Cmd_BenchJsonNum( pLine, "wall" );
+        New  = Cmd_BenchJsonNum( pMatch, "wall" );
+        Abc_Print( 1, "%-8s %-10s %-8s %12.3f %12.3f %8.1f%%", Flow, Design, "wall", Base, New, Base > 0 ? 100.0*(New-Base)/Base : 0.0 );
+        if ( New > Base * (1 + TimeLimit/100) && New - Base > 0.05 )
+            Abc_Print( 1, "   REGRESSION" ), nRegs++;
+        Abc_Print( 1, "\n" );
+        // CPU time
+        Base = Cmd_BenchJsonNum( pLine, "time" );
+        New  = Cmd_BenchJsonNum( pMatch, "time" );
+        Abc_Print( 1, "%-8s %-10s %-8s %12.3f %12.3f %8.1f%%\n", "", "", "cpu", Base, New, Base > 0 ? 100.0*(New-Base)/Base : 0.0 );
+        // memory
+        Base = Cmd_BenchJsonNum( pLine, "peak_mb" );
+        New  = Cmd_BenchJsonNum( pMatch, "peak_mb" );
+        Abc_Print( 1, "%-8s %-10s %-8s %12.1f %12.1f %8.1f%%", "", "", "memory", Base, New, Base > 0 ? 100.0*(New-Base)/Base : 0.0 );
+        if ( New > Base * (1 + MemLimit/100) && New - Base > 1.0 )
+            Abc_Print( 1, "   REGRESSION" ), nRegs++;
+        Abc_Print( 1, "\n" );
+        // quality
+        Base = Cmd_BenchJsonNum( pLine, "qor" );
+        New  = Cmd_BenchJsonNum( pMatch, "qor" );
+        fExact = !strcmp( Metric, "status" ) || !strcmp( Metric, "frames" );
+        Abc_Print( 1, "%-8s %-10s %-8s %12.2f %12.2f %8.1f%%", "", "", Metric, Base, New, Base > 0 ? 100.0*(New-Base)/Base : 0.0 );
+        if ( fExact ? New != Base : New > Base * (1 + QorLimit/100) )
+            Abc_Print( 1, "   REGRESSION" ), nRegs++;
+        Abc_Print( 1, "\n" );
+    }
+    Abc_Print( 1, "Found %d regression%s.\n", nRegs, nRegs == 1 ? "" : "s" );
+    Vec_PtrFreeFree( vBase );
+    Vec_PtrFreeFree( vNew );
+    return nRegs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the catalog of flows.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_BenchPrintFlows()
+{
+    Cmd_BenchFlow_t * pFlow;
+    for ( pFlow = s_BenchFlows; pFlow->pName; pFlow++ )
+        Abc_Print( 1, "%-8s %-10s %-8s \"%s\"\n", pFlow->pName, s_BenchDesigns[pFlow->iDesign], s_BenchMetrics[pFlow->Metric], pFlow->pScript );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
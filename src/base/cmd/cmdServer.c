@@ -0,0 +1,475 @@
+/**CFile****************************************************************
+
+  FileName    [cmdServer.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Resident server executing scripts received over a local socket.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: cmdServer.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/mainInt.h"
+#include "cmdInt.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The server keeps the ABC frame (with the libraries and the networks
+// loaded before it was started) and listens on a Unix-domain socket.
+// A client sends a script and closes its side of the connection for
+// writing. The server forks a child, which inherits the frame
+// copy-on-write, executes the script with its standard output and error
+// redirected into the connection, and writes the status line
+// "ABC_STATUS <num>", where <num> is the value returned by the last
+// command (0 on success). If the child crashes, the server writes the
+// line "ABC_STATUS crashed (signal <num>)" instead.
+
+#define CMD_SERVER_STATUS  "ABC_STATUS"
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef _WIN32
+
+int Cmd_RunServer( Abc_Frame_t * pAbc, char * pSockName, int nJobsMax, int nReqsMax, int fVerbose )
+{
+    Abc_Print( -1, "The server mode is not supported on Windows.\n" );
+    return 1;
+}
+int Cmd_RunClient( char * pSockName, char * pScript )
+{
+    Abc_Print( -1, "The server mode is not supported on Windows.\n" );
+    return -1;
+}
+
+#else
+
+static volatile sig_atomic_t s_fServerStop = 0;
+static int s_ServerPipe[2] = { -1, -1 };
+
+// the handlers write into the pipe polled together with the socket, so
+// that a signal arriving before the server starts waiting is not lost
+static void Cmd_ServerWake()              { int Err = errno; if ( write( s_ServerPipe[1], "", 1 ) ) {} errno = Err; }
+static void Cmd_ServerSigStop( int Sig )  { s_fServerStop = 1; Cmd_ServerWake(); }
+static void Cmd_ServerSigChild( int Sig ) { Cmd_ServerWake(); }
+
+/**Function*************************************************************
+
+  Synopsis    [Installs the signal handler without restarting system calls.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_ServerSetHandler( int Sig, void (*pHandler)(int) )
+{
+    struct sigaction Action;
+    memset( &Action, 0, sizeof(Action) );
+    Action.sa_handler = pHandler;
+    sigemptyset( &Action.sa_mask );
+    Action.sa_flags = 0;
+    sigaction( Sig, &Action, NULL );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the buffer into the descriptor.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_ServerWrite( int fd, char * pBuffer, int nBytes )
+{
+    int nDone;
+    while ( nBytes > 0 )
+    {
+        nDone = (int)write( fd, pBuffer, nBytes );
+        if ( nDone < 0 && errno == EINTR )
+            continue;
+        if ( nDone <= 0 )
+            return 0;
+        pBuffer += nDone;
+        nBytes  -= nDone;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the listening socket.]
+
+  Description [Returns -1 if the socket cannot be created. An existing
+  file with the same name is removed only if it is a socket left by a
+  server that is no longer running.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_ServerOpen( char * pSockName )
+{
+    struct sockaddr_un Addr;
+    struct stat Stat;
+    int fd;
+    if ( strlen(pSockName) >= sizeof(Addr.sun_path) )
+    {
+        Abc_Print( -1, "The socket name \"%s\" is too long.\n", pSockName );
+        return -1;
+    }
+    fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+    if ( fd < 0 )
+    {
+        Abc_Print( -1, "Cannot create the socket (%s).\n", strerror(errno) );
+        return -1;
+    }
+    memset( &Addr, 0, sizeof(Addr) );
+    Addr.sun_family = AF_UNIX;
+    strcpy( Addr.sun_path, pSockName );
+    if ( lstat( pSockName, &Stat ) == 0 )
+    {
+        if ( !S_ISSOCK(Stat.st_mode) )
+        {
+            Abc_Print( -1, "File \"%s\" exists and is not a socket.\n", pSockName );
+            close( fd );
+            return -1;
+        }
+        if ( connect( fd, (struct sockaddr *)&Addr, sizeof(Addr) ) == 0 || errno != ECONNREFUSED )
+        {
+            Abc_Print( -1, "Socket \"%s\" is in use by another server.\n", pSockName );
+            close( fd );
+            return -1;
+        }
+        unlink( pSockName );
+    }
+    if ( bind( fd, (struct sockaddr *)&Addr, sizeof(Addr) ) < 0 || listen( fd, 64 ) < 0 )
+    {
+        Abc_Print( -1, "Cannot listen on socket \"%s\" (%s).\n", pSockName, strerror(errno) );
+        close( fd );
+        return -1;
+    }
+    return fd;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Executes the script received over the connection.]
+
+  Description [This procedure runs in the child process and never returns.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_ServerRunJob( Abc_Frame_t * pAbc, int fdConn )
+{
+    Vec_Str_t * vScript = Vec_StrAlloc( 1000 );
+    char Buffer[1000];
+    int nBytes, Status;
+    // read the script until the client stops writing
+    while ( 1 )
+    {
+        nBytes = (int)read( fdConn, Buffer, sizeof(Buffer) );
+        if ( nBytes < 0 && errno == EINTR )
+            continue;
+        if ( nBytes <= 0 )
+            break;
+        Vec_StrPushBuffer( vScript, Buffer, nBytes );
+    }
+    Vec_StrPush( vScript, '\0' );
+    // redirect the output into the connection
+    fflush( stdout );
+    fflush( stderr );
+    dup2( fdConn, 1 );
+    dup2( fdConn, 2 );
+    close( fdConn );
+    setvbuf( stdout, NULL, _IOLBF, 0 );
+    // execute the script
+    Status = Cmd_CommandExecute( pAbc, Vec_StrArray(vScript) );
+    if ( Status < 0 ) // the script ended with "quit"
+        Status = 0;
+    fflush( stderr );
+    fprintf( stdout, "\n%s %d\n", CMD_SERVER_STATUS, Status );
+    fflush( stdout );
+    _exit( 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the terminated children.]
+
+  Description [The array contains pairs (pid, connection). If the child
+  crashed, reports it to the client before closing the connection.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_ServerReap( Vec_Int_t * vJobs, int fBlock, int fVerbose )
+{
+    char Buffer[100];
+    int i, pid, Status;
+    while ( Vec_IntSize(vJobs) > 0 )
+    {
+        pid = (int)waitpid( -1, &Status, fBlock ? 0 : WNOHANG );
+        if ( pid <= 0 )
+            return;
+        for ( i = 0; i < Vec_IntSize(vJobs); i += 2 )
+            if ( Vec_IntEntry(vJobs, i) == pid )
+                break;
+        if ( i == Vec_IntSize(vJobs) )
+            continue;
+        if ( WIFSIGNALED(Status) )
+        {
+            sprintf( Buffer, "\n%s crashed (signal %d)\n", CMD_SERVER_STATUS, WTERMSIG(Status) );
+            Cmd_ServerWrite( Vec_IntEntry(vJobs, i+1), Buffer, strlen(Buffer) );
+        }
+        if ( fVerbose )
+            printf( "Job with pid %d %s.\n", pid, WIFSIGNALED(Status) ? "crashed" : "finished" );
+        close( Vec_IntEntry(vJobs, i+1) );
+        Vec_IntDrop( vJobs, i+1 );
+        Vec_IntDrop( vJobs, i );
+        fBlock = 0;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the server.]
+
+  Description [Accepts connections until interrupted (SIGINT or SIGTERM)
+  or until nReqsMax requests are served (if nReqsMax > 0). At most
+  nJobsMax requests are executed at the same time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_RunServer( Abc_Frame_t * pAbc, char * pSockName, int nJobsMax, int nReqsMax, int fVerbose )
+{
+    Vec_Int_t * vJobs;
+    struct pollfd pFds[2];
+    char Buffer[100];
+    int fdSock, fdConn, pid, i, nReqs = 0;
+    fdSock = Cmd_ServerOpen( pSockName );
+    if ( fdSock < 0 )
+        return 1;
+    if ( pipe( s_ServerPipe ) < 0 )
+    {
+        Abc_Print( -1, "Cannot create the pipe (%s).\n", strerror(errno) );
+        close( fdSock );
+        unlink( pSockName );
+        return 1;
+    }
+    fcntl( s_ServerPipe[0], F_SETFL, O_NONBLOCK );
+    fcntl( s_ServerPipe[1], F_SETFL, O_NONBLOCK );
+    s_fServerStop = 0;
+    Cmd_ServerSetHandler( SIGINT,  Cmd_ServerSigStop );
+    Cmd_ServerSetHandler( SIGTERM, Cmd_ServerSigStop );
+    Cmd_ServerSetHandler( SIGCHLD, Cmd_ServerSigChild );
+    signal( SIGPIPE, SIG_IGN );
+    if ( fVerbose )
+        printf( "Server is listening on \"%s\" (pid %d).\n", pSockName, (int)getpid() );
+    fflush( stdout );
+    vJobs = Vec_IntAlloc( 2 * nJobsMax );
+    while ( !s_fServerStop && (nReqsMax == 0 || nReqs < nReqsMax) )
+    {
+        Cmd_ServerReap( vJobs, Vec_IntSize(vJobs) >= 2 * nJobsMax, fVerbose );
+        if ( Vec_IntSize(vJobs) >= 2 * nJobsMax )
+            continue;
+        // wait for a connection or a signal
+        pFds[0].fd = fdSock;          pFds[0].events = POLLIN;  pFds[0].revents = 0;
+        pFds[1].fd = s_ServerPipe[0]; pFds[1].events = POLLIN;  pFds[1].revents = 0;
+        if ( poll( pFds, 2, -1 ) < 0 && errno != EINTR )
+        {
+            Abc_Print( -1, "Waiting for the connection has failed (%s).\n", strerror(errno) );
+            break;
+        }
+        if ( pFds[1].revents & POLLIN )
+            while ( read( s_ServerPipe[0], Buffer, sizeof(Buffer) ) > 0 );
+        if ( !(pFds[0].revents & POLLIN) )
+            continue;
+        fdConn = accept( fdSock, NULL, NULL );
+        if ( fdConn < 0 )
+        {
+            if ( errno == EINTR || errno == ECONNABORTED )
+                continue;
+            Abc_Print( -1, "Accepting the connection has failed (%s).\n", strerror(errno) );
+            break;
+        }
+        fflush( stdout );
+        fflush( stderr );
+        pid = (int)fork();
+        if ( pid == 0 )
+        {
+            // keep only the connection of this job
+            close( fdSock );
+            close( s_ServerPipe[0] );
+            close( s_ServerPipe[1] );
+            for ( i = 1; i < Vec_IntSize(vJobs); i += 2 )
+                close( Vec_IntEntry(vJobs, i) );
+            signal( SIGINT,  SIG_DFL );
+            signal( SIGTERM, SIG_DFL );
+            signal( SIGCHLD, SIG_DFL );
+            signal( SIGPIPE, SIG_DFL );
+            Cmd_ServerRunJob( pAbc, fdConn );
+        }
+        if ( pid < 0 )
+        {
+            char * pError = "Cannot start the job.\n" CMD_SERVER_STATUS " 1\n";
+            Cmd_ServerWrite( fdConn, pError, strlen(pError) );
+            close( fdConn );
+            continue;
+        }
+        if ( fVerbose )
+            printf( "Job %d started with pid %d.\n", nReqs, pid );
+        Vec_IntPushTwo( vJobs, pid, fdConn );
+        nReqs++;
+    }
+    // stop accepting new requests and wait for the running ones
+    close( fdSock );
+    unlink( pSockName );
+    while ( Vec_IntSize(vJobs) > 0 )
+        Cmd_ServerReap( vJobs, 1, fVerbose );
+    Vec_IntFree( vJobs );
+    signal( SIGINT,  SIG_DFL );
+    signal( SIGTERM, SIG_DFL );
+    signal( SIGCHLD, SIG_DFL );
+    signal( SIGPIPE, SIG_DFL );
+    close( s_ServerPipe[0] );
+    close( s_ServerPipe[1] );
+    s_ServerPipe[0] = s_ServerPipe[1] = -1;
+    if ( fVerbose )
+        printf( "Server has stopped after serving %d requests.\n", nReqs );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sends the script to the server and prints the output.]
+
+  Description [Returns the status reported by the server, or -1 if
+  the job has crashed or the server cannot be reached. Stops reading
+  after the status line, even if the connection is kept open (for
+  example, by a process started by the script).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_RunClient( char * pSockName, char * pScript )
+{
+    struct sockaddr_un Addr;
+    Vec_Str_t * vLine;
+    char Buffer[1000];
+    int fd, i, nBytes, Status = -1, fDone = 0;
+    if ( strlen(pSockName) >= sizeof(Addr.sun_path) )
+    {
+        Abc_Print( -1, "The socket name \"%s\" is too long.\n", pSockName );
+        return -1;
+    }
+    fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+    memset( &Addr, 0, sizeof(Addr) );
+    Addr.sun_family = AF_UNIX;
+    strcpy( Addr.sun_path, pSockName );
+    if ( fd < 0 || connect( fd, (struct sockaddr *)&Addr, sizeof(Addr) ) < 0 )
+    {
+        Abc_Print( -1, "Cannot connect to server \"%s\" (%s).\n", pSockName, strerror(errno) );
+        if ( fd >= 0 )
+            close( fd );
+        return -1;
+    }
+    if ( !Cmd_ServerWrite( fd, pScript, strlen(pScript) ) )
+    {
+        Abc_Print( -1, "Cannot send the script to server \"%s\".\n", pSockName );
+        close( fd );
+        return -1;
+    }
+    shutdown( fd, SHUT_WR );
+    // print the output line by line, except for the status line
+    vLine = Vec_StrAlloc( 1000 );
+    while ( !fDone )
+    {
+        nBytes = (int)read( fd, Buffer, sizeof(Buffer) );
+        if ( nBytes < 0 && errno == EINTR )
+            continue;
+        for ( i = 0; i < nBytes && !fDone; i++ )
+        {
+            Vec_StrPush( vLine, Buffer[i] );
+            if ( Buffer[i] != '\n' )
+                continue;
+            Vec_StrPush( vLine, '\0' );
+            if ( !strncmp(Vec_StrArray(vLine), CMD_SERVER_STATUS " ", strlen(CMD_SERVER_STATUS) + 1) )
+            {
+                char * pStatus = Vec_StrArray(vLine) + strlen(CMD_SERVER_STATUS) + 1;
+                Status = strncmp(pStatus, "crashed", 7) ? atoi(pStatus) : -1;
+                if ( Status == -1 )
+                    Abc_Print( -1, "The job has %s", pStatus );
+                fDone = 1;
+            }
+            else
+                fputs( Vec_StrArray(vLine), stdout );
+            Vec_StrClear( vLine );
+        }
+        if ( nBytes <= 0 )
+            break;
+    }
+    if ( Vec_StrSize(vLine) > 0 )
+    {
+        Vec_StrPush( vLine, '\0' );
+        fputs( Vec_StrArray(vLine), stdout );
+    }
+    fflush( stdout );
+    Vec_StrFree( vLine );
+    close( fd );
+    return Status;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
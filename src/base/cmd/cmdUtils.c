@@ -21,6 +21,7 @@
 #include "base/abc/abc.h"
 #include "base/main/mainInt.h"
 #include "cmdInt.h"
+#include "misc/util/utilProf.h"
 #include <ctype.h>
 
 ABC_NAMESPACE_IMPL_START
@@ -79,6 +80,35 @@ int cmdCheckShellEscape( Abc_Frame_t * pAbc, int argc, char ** argv)
 	}
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Opens the profiler phase for the command.]
+
+  Description [Returns -1 if the profiler is off.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int CmdProfPush( int argc, char ** argv )
+{
+    Vec_Str_t * vLine;
+    int i, iPhase;
+    if ( !Abc_ProfIsOn() )
+        return -1;
+    vLine = Vec_StrAlloc( 100 );
+    for ( i = 0; i < argc; i++ )
+    {
+        if ( i ) Vec_StrPush( vLine, ' ' );
+        Vec_StrAppend( vLine, argv[i] );
+    }
+    Vec_StrPush( vLine, '\0' );
+    iPhase = Abc_ProfPush( argv[0], Vec_StrArray(vLine) );
+    Vec_StrFree( vLine );
+    return iPhase;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Executes one command.]
@@ -100,7 +130,7 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
     int (*pFunc) ( Abc_Frame_t *, int, char ** );
     Abc_Command * pCommand;
     char * value;
-    int fError;
+    int fError, iPhase;
     double clk;
 
     if ( argc == 0 )
@@ -149,10 +179,17 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
 
     // execute the command
     clk = Extra_CpuTimeDouble();
+    iPhase = CmdProfPush( argc, argv );
     pFunc = (int (*)(Abc_Frame_t *, int, char **))pCommand->pFunc;
     fError = (*pFunc)( pAbc, argc, argv );
+    Abc_ProfPop( iPhase );
     pAbc->TimeCommand += Extra_CpuTimeDouble() - clk;
 
+    // compact the fanin/fanout storage after the command changed the network
+    if ( fError == 0 && pCommand->fChange && pAbc->pNtkCur && Abc_FrameIsFlagEnabled( "compact" ) )
+        if ( Abc_NtkFanioIsFragmented( pAbc->pNtkCur ) )
+            Abc_NtkCompactFanio( pAbc->pNtkCur );
+
     // automatic execution of arbitrary command after each command 
     // usually this is a passive command ... 
     if ( fError == 0 && !pAbc->fAutoexac )
@@ -83,6 +83,8 @@ extern Abc_Ntk_t *        Io_ReadBaf( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadBblif( char * pFileName, int fCheck );
 /*=== abcReadBlif.c ===========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlif( char * pFileName, int fCheck );
+/*=== abcReadBlifFast.c =======================================================*/
+extern Abc_Ntk_t *        Io_ReadBlifFast( char * pFileName, int fCheck );
 /*=== abcReadBlifMv.c =========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck );
 /*=== abcReadBench.c ==========================================================*/
@@ -96,6 +98,8 @@ extern Abc_Ntk_t *        Io_ReadEqn( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadPla( char * pFileName, int fZeros, int fBoth, int fCheck );
 /*=== abcReadVerilog.c ========================================================*/
 extern Abc_Ntk_t *        Io_ReadVerilog( char * pFileName, int fCheck );
+/*=== abcReadVerilogFast.c ====================================================*/
+extern Abc_Ntk_t *        Io_ReadVerilogFast( char * pFileName, int fCheck );
 /*=== abcWriteAiger.c =========================================================*/
 extern void               Io_WriteAiger( Abc_Ntk_t * pNtk, char * pFileName, int fWriteSymbols, int fCompact, int fUnique );
 extern void               Io_WriteAigerCex( Abc_Cex_t * pCex, Abc_Ntk_t * pNtk, void * pG, char * pFileName );
@@ -0,0 +1,783 @@
+/**CFile****************************************************************
+
+  FileName    [ioReadBlifFast.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Fast reader of flat BLIF files.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: ioReadBlifFast.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "map/mio/mio.h"
+#include "misc/util/utilNam.h"
+#include "ioAbc.h"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The reader works in two passes over the file, which is memory-mapped
+// when possible. The first pass tokenizes the lines in place (a token
+// is a pair of pointers into the file), interns the signal names, derives
+// the SOPs, and records the objects in flat arrays, so that the numbers of objects,
+// fanins and fanouts are known. The second pass allocates the network with
+// these sizes and creates the objects in the same order as the BLIF-MV
+// reader does, so that the resulting networks are identical. The file is
+// declined (and should be read by the BLIF-MV reader) if it contains
+// hierarchy or any other construct not handled here, or if it has errors.
+
+typedef struct Io_BlifFast_t_ Io_BlifFast_t;
+struct Io_BlifFast_t_
+{
+    // the file
+    char *               pBuffer;      // the contents of the file
+    char *               pLimit;       // the end of the contents
+    char *               pCur;         // the current reading position
+    size_t               nSize;        // the size of the file
+    int                  fMapped;      // the file is memory-mapped
+    Vec_Ptr_t *          vTokens;      // the beginnings and ends of tokens of the current line
+    // the signal names
+    Abc_Nam_t *          pNames;       // the interned names
+    Vec_Int_t *          vFanouts;     // the fanout count of each name
+    Vec_Int_t *          vFlags;       // the flags of each name (1 = driven, 2 = PO)
+    Vec_Ptr_t *          vNets;        // the net of each name
+    // the objects
+    char *               pModel;       // the model name
+    Vec_Int_t *          vPis;         // the PI names
+    Vec_Int_t *          vPos;         // the PO names
+    Vec_Int_t *          vLatches;     // the latch input, output and init value
+    Vec_Int_t *          vNodes;       // the first entry of each node in vFans
+    Vec_Int_t *          vFans;        // the fanin count, the fanin names and the output name
+    Vec_Ptr_t *          vFuncs;       // the SOP or the gate of each node
+    Mem_Flex_t *         pManSop;      // the memory for the SOPs
+    Vec_Str_t *          vSop;         // the SOP under construction
+    int                  nGates;       // the number of .gate lines
+    // the current table
+    int                  nFanins;      // the number of fanins
+    int                  nTableToks;   // the number of tokens
+    int                  Polarity;     // the output value
+    char *               pFirst;       // the first token
+    char *               pFirstEnd;    // the end of the first token
+};
+
+static inline int Io_BlifFastIsStop( char c ) { return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '#' || c == '\\'; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the file.]
+
+  Description [Maps the file into memory or reads it into a buffer if
+  mapping is not available. Compressed files are not handled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastLoad( Io_BlifFast_t * p, char * pFileName )
+{
+    FILE * pFile;
+    int Length = strlen(pFileName);
+    if ( (Length > 3 && !strcmp(pFileName + Length - 3, ".gz")) || (Length > 4 && !strcmp(pFileName + Length - 4, ".bz2")) )
+        return 0;
+#ifndef WIN32
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd < 0 )
+            return 0;
+        if ( fstat( fd, &Stat ) != 0 || Stat.st_size == 0 )
+        {
+            close( fd );
+            return 0;
+        }
+        p->nSize = (size_t)Stat.st_size;
+        p->pBuffer = (char *)mmap( NULL, p->nSize, PROT_READ, MAP_PRIVATE, fd, 0 );
+        close( fd );
+        if ( p->pBuffer == (char *)MAP_FAILED )
+            p->pBuffer = NULL;
+        else
+        {
+#ifdef MADV_SEQUENTIAL
+            madvise( p->pBuffer, p->nSize, MADV_SEQUENTIAL );
+#endif
+            p->fMapped = 1;
+            p->pLimit = p->pBuffer + p->nSize;
+            return 1;
+        }
+    }
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    fseek( pFile, 0, SEEK_END );
+    p->nSize = (size_t)ftell( pFile );
+    rewind( pFile );
+    p->pBuffer = ABC_ALLOC( char, p->nSize + 1 );
+    if ( p->nSize == 0 || fread( p->pBuffer, p->nSize, 1, pFile ) != 1 )
+    {
+        fclose( pFile );
+        return 0;
+    }
+    fclose( pFile );
+    p->pLimit = p->pBuffer + p->nSize;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates and deallocates the reader.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Io_BlifFast_t * Io_BlifFastAlloc()
+{
+    Io_BlifFast_t * p;
+    p = ABC_CALLOC( Io_BlifFast_t, 1 );
+    p->vTokens  = Vec_PtrAlloc( 100 );
+    p->vFanouts = Vec_IntAlloc( 1000 );
+    p->vFlags   = Vec_IntAlloc( 1000 );
+    p->vNets    = Vec_PtrAlloc( 0 );
+    p->vPis     = Vec_IntAlloc( 100 );
+    p->vPos     = Vec_IntAlloc( 100 );
+    p->vLatches = Vec_IntAlloc( 100 );
+    p->vNodes   = Vec_IntAlloc( 1000 );
+    p->vFans    = Vec_IntAlloc( 1000 );
+    p->vFuncs   = Vec_PtrAlloc( 1000 );
+    p->pManSop  = Mem_FlexStart();
+    p->vSop     = Vec_StrAlloc( 1000 );
+    // the 0-th name is not used
+    Vec_IntPush( p->vFanouts, 0 );
+    Vec_IntPush( p->vFlags, 0 );
+    return p;
+}
+static void Io_BlifFastFree( Io_BlifFast_t * p )
+{
+#ifndef WIN32
+    if ( p->fMapped )
+        munmap( p->pBuffer, p->nSize );
+    else
+#endif
+    ABC_FREE( p->pBuffer );
+    if ( p->pNames )
+        Abc_NamStop( p->pNames );
+    Vec_PtrFree( p->vTokens );
+    Vec_IntFree( p->vFanouts );
+    Vec_IntFree( p->vFlags );
+    Vec_PtrFree( p->vNets );
+    Vec_IntFree( p->vPis );
+    Vec_IntFree( p->vPos );
+    Vec_IntFree( p->vLatches );
+    Vec_IntFree( p->vNodes );
+    Vec_IntFree( p->vFans );
+    Vec_PtrFree( p->vFuncs );
+    if ( p->pManSop )
+        Mem_FlexStop( p->pManSop, 0 );
+    Vec_StrFree( p->vSop );
+    ABC_FREE( p->pModel );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the backslash extends the line.]
+
+  Description [This is the case when the backslash is the last
+  character of the line, except for spaces.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Io_BlifFastIsExtender( char * pCur, char * pLimit )
+{
+    for ( pCur++; pCur < pLimit && *pCur != '\n'; pCur++ )
+        if ( *pCur != ' ' && *pCur != '\t' && *pCur != '\r' )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the tokens of the next non-empty line.]
+
+  Description [Skips the comments and unfolds the line extensions.
+  The beginnings and ends of the tokens are stored in p->vTokens.
+  Returns the number of tokens, which is 0 at the end of the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastReadLine( Io_BlifFast_t * p )
+{
+    char * pCur = p->pCur, * pLimit = p->pLimit, * pBeg;
+    Vec_PtrClear( p->vTokens );
+    while ( pCur < pLimit )
+    {
+        if ( *pCur == '\n' )
+        {
+            pCur++;
+            if ( Vec_PtrSize(p->vTokens) )
+                break;
+            continue;
+        }
+        if ( *pCur == ' ' || *pCur == '\t' || *pCur == '\r' )
+        {
+            pCur++;
+            continue;
+        }
+        if ( *pCur == '#' )
+        {
+            while ( pCur < pLimit && *pCur != '\n' )
+                pCur++;
+            continue;
+        }
+        if ( *pCur == '\\' && Io_BlifFastIsExtender(pCur, pLimit) )
+        {
+            while ( pCur < pLimit && *pCur++ != '\n' );
+            continue;
+        }
+        // collect the token
+        for ( pBeg = pCur++; pCur < pLimit; pCur++ )
+            if ( ((unsigned char)*pCur <= '#' || *pCur == '\\') && Io_BlifFastIsStop(*pCur) && (*pCur != '\\' || Io_BlifFastIsExtender(pCur, pLimit)) )
+                break;
+        Vec_PtrPush( p->vTokens, pBeg );
+        Vec_PtrPush( p->vTokens, pCur );
+    }
+    p->pCur = pCur;
+    return Vec_PtrSize(p->vTokens) / 2;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Token helpers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Io_BlifFastTokenIs( char * pBeg, char * pEnd, char * pStr )
+{
+    int Length = strlen(pStr);
+    return pEnd - pBeg == Length && !strncmp( pBeg, pStr, Length );
+}
+static inline int Io_BlifFastTokenIsPrefix( char * pBeg, char * pEnd, char * pStr )
+{
+    int Length = strlen(pStr);
+    return pEnd - pBeg >= Length && !strncmp( pBeg, pStr, Length );
+}
+static inline int Io_BlifFastName( Io_BlifFast_t * p, char * pBeg, char * pEnd )
+{
+    int Id = Abc_NamStrFindOrAddLim( p->pNames, pBeg, pEnd, NULL );
+    if ( Id == Vec_IntSize(p->vFanouts) )
+    {
+        Vec_IntPush( p->vFanouts, 0 );
+        Vec_IntPush( p->vFlags, 0 );
+    }
+    return Id;
+}
+static inline int Io_BlifFastDrive( Io_BlifFast_t * p, int Id )
+{
+    if ( Vec_IntEntry(p->vFlags, Id) & 1 )
+        return 0;
+    *Vec_IntEntryP(p->vFlags, Id) |= 1;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Scans the tokens of the current table.]
+
+  Description [The tokens of a table may be split into lines arbitrarily.
+  The SOP is collected in p->vSop.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastScanTable( Io_BlifFast_t * p, char ** pToks, int nToks )
+{
+    int i;
+    for ( i = 0; i < nToks; i++, p->nTableToks++ )
+    {
+        char * pBeg = pToks[2*i], * pEnd = pToks[2*i+1];
+        if ( p->nTableToks == 0 )
+        {
+            p->pFirst = pBeg;
+            p->pFirstEnd = pEnd;
+            continue;
+        }
+        if ( p->nFanins == 0 )
+            return 0;
+        if ( p->nTableToks == 1 )
+        {
+            if ( p->pFirstEnd - p->pFirst != p->nFanins )
+                return 0;
+            Vec_StrPushBuffer( p->vSop, p->pFirst, p->nFanins );
+            Vec_StrPush( p->vSop, ' ' );
+        }
+        if ( p->nTableToks % 2 == 0 )
+        {
+            if ( pEnd - pBeg != p->nFanins )
+                return 0;
+            Vec_StrPushBuffer( p->vSop, pBeg, p->nFanins );
+            Vec_StrPush( p->vSop, ' ' );
+            continue;
+        }
+        if ( pEnd - pBeg != 1 || (*pBeg != '0' && *pBeg != '1') )
+            return 0;
+        if ( p->Polarity == -1 )
+            p->Polarity = *pBeg;
+        else if ( p->Polarity != *pBeg )
+            return 0;
+        Vec_StrPush( p->vSop, *pBeg );
+        Vec_StrPush( p->vSop, '\n' );
+    }
+    return 1;
+}
+static int Io_BlifFastFinishTable( Io_BlifFast_t * p )
+{
+    char * pSop;
+    if ( p->nTableToks == 0 )
+        pSop = Abc_SopCreateConst0( p->pManSop );
+    else if ( p->nTableToks == 1 )
+    {
+        if ( p->nFanins > 0 || p->pFirstEnd - p->pFirst != 1 || (*p->pFirst != '0' && *p->pFirst != '1') )
+            return 0;
+        pSop = *p->pFirst == '0' ? Abc_SopCreateConst0( p->pManSop ) : Abc_SopCreateConst1( p->pManSop );
+    }
+    else if ( p->nTableToks % 2 == 0 )
+    {
+        pSop = Mem_FlexEntryFetch( p->pManSop, Vec_StrSize(p->vSop) + 1 );
+        memcpy( pSop, Vec_StrArray(p->vSop), Vec_StrSize(p->vSop) );
+        pSop[Vec_StrSize(p->vSop)] = 0;
+    }
+    else
+        return 0;
+    Vec_PtrWriteEntry( p->vFuncs, Vec_PtrSize(p->vFuncs)-1, pSop );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Scans the .names and .gate lines.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastScanNames( Io_BlifFast_t * p, char ** pToks, int nToks )
+{
+    int i, Id;
+    if ( nToks < 2 )
+        return 0;
+    Vec_IntPush( p->vNodes, Vec_IntSize(p->vFans) );
+    Vec_IntPush( p->vFans, nToks - 2 );
+    for ( i = 1; i < nToks - 1; i++ )
+    {
+        Id = Io_BlifFastName( p, pToks[2*i], pToks[2*i+1] );
+        Vec_IntAddToEntry( p->vFanouts, Id, 1 );
+        Vec_IntPush( p->vFans, Id );
+    }
+    Id = Io_BlifFastName( p, pToks[2*i], pToks[2*i+1] );
+    if ( !Io_BlifFastDrive( p, Id ) )
+        return 0;
+    Vec_IntPush( p->vFans, Id );
+    // the table follows this line
+    Vec_PtrPush( p->vFuncs, NULL );
+    Vec_StrClear( p->vSop );
+    p->nFanins    = nToks - 2;
+    p->nTableToks = 0;
+    p->Polarity   = -1;
+    return 1;
+}
+static int Io_BlifFastScanGate( Io_BlifFast_t * p, char ** pToks, int nToks )
+{
+    Mio_Library_t * pGenlib = (Mio_Library_t *)Abc_FrameReadLibGen();
+    Mio_Gate_t * pGate;
+    Mio_Pin_t * pPin;
+    char Buffer[1000], * pFormal;
+    int i, k, Id, Length, nPins;
+    if ( pGenlib == NULL || nToks < 3 || pToks[3] - pToks[2] >= 1000 )
+        return 0;
+    strncpy( Buffer, pToks[2], pToks[3] - pToks[2] );
+    Buffer[pToks[3] - pToks[2]] = 0;
+    pGate = Mio_LibraryReadGateByName( pGenlib, Buffer, NULL );
+    if ( pGate == NULL || Mio_GateReadTwin(pGate) )
+        return 0;
+    nPins = Mio_GateReadPinNum( pGate );
+    if ( nToks - 3 != nPins )
+        return 0;
+    Vec_IntPush( p->vNodes, Vec_IntSize(p->vFans) );
+    Vec_IntPush( p->vFans, nPins );
+    // find the actual names in the order of the formal names, followed by the output
+    for ( i = 0, pPin = Mio_GateReadPins(pGate); i <= nPins; i++, pPin = pPin ? Mio_PinReadNext(pPin) : NULL )
+    {
+        pFormal = i < nPins ? Mio_PinReadName(pPin) : Mio_GateReadOutName(pGate);
+        Length = strlen( pFormal );
+        for ( k = 2; k < nToks; k++ )
+            if ( pToks[2*k+1] - pToks[2*k] > Length + 1 && !strncmp(pToks[2*k], pFormal, Length) && pToks[2*k][Length] == '=' )
+                break;
+        if ( k == nToks )
+            return 0;
+        Id = Io_BlifFastName( p, pToks[2*k] + Length + 1, pToks[2*k+1] );
+        if ( i < nPins )
+            Vec_IntAddToEntry( p->vFanouts, Id, 1 );
+        else if ( !Io_BlifFastDrive( p, Id ) )
+            return 0;
+        Vec_IntPush( p->vFans, Id );
+    }
+    Vec_PtrPush( p->vFuncs, pGate );
+    p->nGates++;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Scans the .latch line.]
+
+  Description [The initial value is the last token, if present.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastScanLatch( Io_BlifFast_t * p, char ** pToks, int nToks )
+{
+    int IdIn, IdOut, Init = 2;
+    if ( nToks < 3 || nToks > 6 )
+        return 0;
+    if ( nToks > 3 )
+    {
+        char * pLast = pToks[2*nToks-2];
+        if ( pToks[2*nToks-1] - pLast != 1 || *pLast < '0' || *pLast > '3' )
+            return 0;
+        Init = *pLast - '0';
+    }
+    IdIn  = Io_BlifFastName( p, pToks[2], pToks[3] );
+    IdOut = Io_BlifFastName( p, pToks[4], pToks[5] );
+    Vec_IntAddToEntry( p->vFanouts, IdIn, 1 );
+    if ( !Io_BlifFastDrive( p, IdOut ) )
+        return 0;
+    Vec_IntPushThree( p->vLatches, IdIn, IdOut, Init );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the first pass over the file.]
+
+  Description [Returns 0 if the file should be read by another reader.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifFastScan( Io_BlifFast_t * p )
+{
+    char ** pToks, * pBeg, * pEnd;
+    int i, Id, nToks, fTable = 0, fModel = 0;
+    p->pNames = Abc_NamStart( (int)Abc_MinWord( p->nSize / 64 + 1000, 1 << 26 ), 8 );
+    p->pCur = p->pBuffer;
+    while ( (nToks = Io_BlifFastReadLine(p)) )
+    {
+        pToks = (char **)Vec_PtrArray( p->vTokens );
+        if ( pToks[0][0] != '.' )
+        {
+            if ( !fTable || !Io_BlifFastScanTable( p, pToks, nToks ) )
+                return 0;
+            continue;
+        }
+        if ( fTable )
+        {
+            if ( !Io_BlifFastFinishTable(p) )
+                return 0;
+            fTable = 0;
+        }
+        pBeg = pToks[0] + 1;
+        pEnd = pToks[1];
+        if ( Io_BlifFastTokenIs(pBeg, pEnd, "names") )
+        {
+            if ( p->nGates || !Io_BlifFastScanNames( p, pToks, nToks ) )
+                return 0;
+            fTable = 1;
+        }
+        else if ( Io_BlifFastTokenIs(pBeg, pEnd, "gate") )
+        {
+            if ( Vec_IntSize(p->vNodes) > p->nGates || !Io_BlifFastScanGate( p, pToks, nToks ) )
+                return 0;
+        }
+        else if ( Io_BlifFastTokenIs(pBeg, pEnd, "inputs") )
+        {
+            for ( i = 1; i < nToks; i++ )
+            {
+                Id = Io_BlifFastName( p, pToks[2*i], pToks[2*i+1] );
+                if ( !Io_BlifFastDrive( p, Id ) )
+                    return 0;
+                Vec_IntPush( p->vPis, Id );
+            }
+        }
+        else if ( Io_BlifFastTokenIs(pBeg, pEnd, "outputs") )
+        {
+            for ( i = 1; i < nToks; i++ )
+            {
+                Id = Io_BlifFastName( p, pToks[2*i], pToks[2*i+1] );
+                if ( Vec_IntEntry(p->vFlags, Id) & 2 )
+                    return 0;
+                *Vec_IntEntryP(p->vFlags, Id) |= 2;
+                Vec_IntAddToEntry( p->vFanouts, Id, 1 );
+                Vec_IntPush( p->vPos, Id );
+            }
+        }
+        else if ( Io_BlifFastTokenIs(pBeg, pEnd, "latch") )
+        {
+            if ( !Io_BlifFastScanLatch( p, pToks, nToks ) )
+                return 0;
+        }
+        else if ( Io_BlifFastTokenIs(pBeg, pEnd, "model") )
+        {
+            if ( fModel++ || nToks != 2 )
+                return 0;
+            p->pModel = ABC_ALLOC( char, pToks[3] - pToks[2] + 1 );
+            strncpy( p->pModel, pToks[2], pToks[3] - pToks[2] );
+            p->pModel[pToks[3] - pToks[2]] = 0;
+        }
+        else if ( Io_BlifFastTokenIs(pBeg, pEnd, "end") )
+        {
+            // only one model is expected
+            while ( (nToks = Io_BlifFastReadLine(p)) )
+                if ( !Io_BlifFastTokenIs((char *)Vec_PtrEntry(p->vTokens, 0), (char *)Vec_PtrEntry(p->vTokens, 1), ".end") )
+                    return 0;
+            break;
+        }
+        // the directives ignored by the BLIF-MV reader
+        else if ( !Io_BlifFastTokenIs(pBeg, pEnd, "attrib") && !Io_BlifFastTokenIs(pBeg, pEnd, "delay") &&
+                  !Io_BlifFastTokenIs(pBeg, pEnd, "no_merge") && !Io_BlifFastTokenIs(pBeg, pEnd, "wd") &&
+                  !Io_BlifFastTokenIsPrefix(pBeg, pEnd, "input_") && !Io_BlifFastTokenIsPrefix(pBeg, pEnd, "output_") )
+            return 0;
+    }
+    if ( fTable )
+    {
+        if ( !Io_BlifFastFinishTable(p) )
+            return 0;
+    }
+    // empty models are read as blackboxes by the BLIF-MV reader
+    return fModel && (Vec_IntSize(p->vNodes) > 0 || Vec_IntSize(p->vLatches) > 0);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Preallocates the fanin or fanout array of the object.]
+
+  Description [Uses the same capacities as Vec_IntPushMem() would
+  reach after adding the given number of entries one by one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Io_BlifFastGrow( Abc_Ntk_t * pNtk, Vec_Int_t * vArray, int nSize )
+{
+    int nCap = 2;
+    if ( nSize <= 2 )
+        return;
+    assert( vArray->nCap == 0 );
+    while ( nCap < nSize )
+        nCap *= 2;
+    vArray->pArray = (int *)Mem_StepEntryFetch( pNtk->pMmStep, nCap * 4 );
+    vArray->nCap   = nCap;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the net with the given name.]
+
+  Description [Creates the net when it is used for the first time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Abc_Obj_t * Io_BlifFastNet( Io_BlifFast_t * p, Abc_Ntk_t * pNtk, int Id )
+{
+    Abc_Obj_t * pNet = (Abc_Obj_t *)Vec_PtrEntry( p->vNets, Id );
+    if ( pNet )
+        return pNet;
+    pNet = Abc_NtkCreateNet( pNtk );
+    Nm_ManStoreIdName( pNtk->pManName, pNet->Id, pNet->Type, Abc_NamStr(p->pNames, Id), NULL );
+    Io_BlifFastGrow( pNtk, &pNet->vFanouts, Vec_IntEntry(p->vFanouts, Id) );
+    Vec_PtrWriteEntry( p->vNets, Id, pNet );
+    return pNet;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the second pass and creates the network.]
+
+  Description [The objects are created in the same order as in
+  the BLIF-MV reader.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Ntk_t * Io_BlifFastBuild( Io_BlifFast_t * p )
+{
+    Abc_Ntk_t * pNtk;
+    Abc_Obj_t * pNet, * pTerm, * pLatch, * pNode;
+    int i, k, Id, Init, iFans, * pFans, nNames, nObjs;
+    nNames = Abc_NamObjNumMax( p->pNames );
+    nObjs  = nNames + Vec_IntSize(p->vPis) + Vec_IntSize(p->vPos) + Vec_IntSize(p->vLatches) + Vec_IntSize(p->vNodes) + 10;
+    // start the network with the precomputed sizes
+    pNtk = Abc_NtkAlloc( ABC_NTK_NETLIST, p->nGates ? ABC_FUNC_MAP : ABC_FUNC_SOP, 1 );
+    if ( !p->nGates )
+    {
+        // the SOPs were derived while scanning the file
+        Mem_FlexStop( (Mem_Flex_t *)pNtk->pManFunc, 0 );
+        pNtk->pManFunc = p->pManSop;
+        p->pManSop = NULL;
+    }
+    pNtk->pName = p->pModel;
+    p->pModel = NULL;
+    Nm_ManFree( pNtk->pManName );
+    pNtk->pManName = Nm_ManCreate( nNames + Vec_IntSize(p->vLatches) / 3 + 200 );
+    Vec_PtrGrow( pNtk->vObjs, nObjs );
+    Vec_PtrGrow( pNtk->vPis,  Vec_IntSize(p->vPis) );
+    Vec_PtrGrow( pNtk->vPos,  Vec_IntSize(p->vPos) );
+    Vec_PtrGrow( pNtk->vCis,  Vec_IntSize(p->vPis) + Vec_IntSize(p->vLatches) / 3 );
+    Vec_PtrGrow( pNtk->vCos,  Vec_IntSize(p->vPos) + Vec_IntSize(p->vLatches) / 3 );
+    Vec_PtrGrow( pNtk->vBoxes, Vec_IntSize(p->vLatches) / 3 );
+    Vec_PtrFill( p->vNets, nNames, NULL );
+    // create the PIs and POs
+    Vec_IntForEachEntry( p->vPis, Id, i )
+    {
+        pNet  = Io_BlifFastNet( p, pNtk, Id );
+        pTerm = Abc_NtkCreatePi( pNtk );
+        Abc_ObjAddFanin( pNet, pTerm );
+    }
+    Vec_IntForEachEntry( p->vPos, Id, i )
+    {
+        pNet  = Io_BlifFastNet( p, pNtk, Id );
+        pTerm = Abc_NtkCreatePo( pNtk );
+        Abc_ObjAddFanin( pTerm, pNet );
+    }
+    // create the latches
+    Vec_IntForEachEntryTriple( p->vLatches, Id, k, Init, i )
+    {
+        pNet   = Io_BlifFastNet( p, pNtk, Id );
+        pTerm  = Abc_NtkCreateBi( pNtk );
+        Abc_ObjAddFanin( pTerm, pNet );
+        pLatch = Abc_NtkCreateLatch( pNtk );
+        Abc_ObjAddFanin( pLatch, pTerm );
+        pTerm  = Abc_NtkCreateBo( pNtk );
+        Abc_ObjAddFanin( pTerm, pLatch );
+        pNet   = Io_BlifFastNet( p, pNtk, k );
+        Abc_ObjAddFanin( pNet, pTerm );
+        Abc_ObjAssignName( pLatch, Abc_NamStr(p->pNames, k), "L" );
+        if ( Init == 0 )
+            Abc_LatchSetInit0( pLatch );
+        else if ( Init == 1 )
+            Abc_LatchSetInit1( pLatch );
+        else
+            Abc_LatchSetInitDc( pLatch );
+    }
+    // create the nodes
+    Vec_IntForEachEntry( p->vNodes, iFans, i )
+    {
+        pFans = Vec_IntEntryP( p->vFans, iFans );
+        pNode = Abc_NtkCreateNode( pNtk );
+        Io_BlifFastGrow( pNtk, &pNode->vFanins, pFans[0] );
+        for ( k = 1; k <= pFans[0]; k++ )
+            Abc_ObjAddFanin( pNode, Io_BlifFastNet(p, pNtk, pFans[k]) );
+        Abc_ObjAddFanin( Io_BlifFastNet(p, pNtk, pFans[k]), pNode );
+        Abc_ObjSetData( pNode, Vec_PtrEntry(p->vFuncs, i) );
+    }
+    Abc_NtkFinalizeRead( pNtk );
+    return pNtk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the flat BLIF file.]
+
+  Description [Returns NULL if the file cannot be read by this reader,
+  for example, because it is hierarchical, uses the directives not
+  supported here, or has errors. Such files should be read by
+  Io_ReadBlifMv(), which also reports the errors.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadBlifFast( char * pFileName, int fCheck )
+{
+    Io_BlifFast_t * p;
+    Abc_Ntk_t * pNtk = NULL;
+    p = Io_BlifFastAlloc();
+    if ( Io_BlifFastLoad( p, pFileName ) && Io_BlifFastScan( p ) )
+        pNtk = Io_BlifFastBuild( p );
+    Io_BlifFastFree( p );
+    if ( pNtk == NULL )
+        return NULL;
+    if ( fCheck && !Abc_NtkCheckRead( pNtk ) )
+    {
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    pNtk->pSpec = Extra_UtilStrsav( pFileName );
+    return pNtk;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
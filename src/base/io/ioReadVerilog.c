@@ -29,6 +29,7 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 //extern Abc_Des_t * Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan );
+extern int glo_fMapped;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -51,6 +52,10 @@ Abc_Ntk_t * Io_ReadVerilog( char * pFileName, int fCheck )
     Abc_Des_t * pDesign;
     int i, RetValue;
 
+    // try the fast reader of flat mapped netlists
+    if ( glo_fMapped && (pNtk = Io_ReadVerilogFast( pFileName, fCheck )) )
+        return pNtk;
+
     // parse the verilog file
     pDesign = Ver_ParseFile( pFileName, NULL, fCheck, 1 );
     if ( pDesign == NULL )
@@ -0,0 +1,1001 @@
+/**CFile****************************************************************
+
+  FileName    [ioReadVerilogFast.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Fast reader of flat gate-level Verilog files.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: ioReadVerilogFast.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "map/mio/mio.h"
+#include "misc/util/utilNam.h"
+#include "ioAbc.h"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The reader handles one flat module composed of signal declarations,
+// instances of the gates of the current genlib library with named pin
+// connections, and the always/initial blocks written for the latches.
+// The module body is split into chunks, which are parsed in parallel.
+// A chunk other than the first one starts after the first semicolon
+// following its nominal beginning; this guess is checked against the
+// place where the previous chunk actually stopped, and the chunk is
+// parsed again from that place if the guess was wrong (for example,
+// when the boundary fell inside an always block or a comment). Parsing
+// produces the records of the statements, in which the names are
+// given by their positions in the file. The network is then built
+// sequentially from the records, in the same order as the Verilog
+// parser (src/base/ver) does it, while the names are resolved using
+// one table of interned strings. The file is declined (and should be
+// read by the Verilog parser) if it contains any construct not handled
+// here, or if it has errors.
+
+#define IO_VER_THR_MAX     64            // the largest number of threads
+#define IO_VER_CHUNK_MIN   (1 << 22)     // the smallest chunk size
+#define IO_VER_CHUNK_MAX   (1 << 30)     // the largest chunk size
+
+// the types of records
+typedef enum {
+    IO_VER_SIG = 1,                      // signal declaration
+    IO_VER_GATE,                         // gate instance
+    IO_VER_LATCH,                        // latch (always block)
+    IO_VER_INIT,                         // latch initial value (initial block)
+    IO_VER_END                           // the end of the module
+} Io_VerRec_t;
+
+// the types of signals (same as Ver_SignalType_t)
+typedef enum {
+    IO_VER_INPUT = 1,
+    IO_VER_OUTPUT,
+    IO_VER_INOUT,
+    IO_VER_REG,
+    IO_VER_WIRE
+} Io_VerSig_t;
+
+typedef struct Io_VerChunk_t_ Io_VerChunk_t;
+struct Io_VerChunk_t_
+{
+    Mio_Library_t *      pLib;         // the current library
+    char *               pBase;        // the nominal beginning of the chunk (the base of name offsets)
+    char *               pStart;       // the place where parsing starts
+    char *               pStop;        // the statements beginning here or later belong to the next chunk
+    char *               pLimit;       // the end of the file
+    char *               pEnd;         // the place where parsing stopped
+    int                  fOk;          // parsing succeeded
+    int                  fEndModule;   // the end of the module is reached
+    int                  nNames;       // the number of declared signals and latches
+    Vec_Int_t *          vRecs;        // the records
+    Vec_Ptr_t *          vGates;       // the gates of the instances
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the file.]
+
+  Description [Maps the file into memory or reads it into a buffer if
+  mapping is not available. Compressed files are not handled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_VerFastLoad( char * pFileName, size_t * pnSize, int * pfMapped )
+{
+    FILE * pFile;
+    char * pBuffer;
+    int Length = strlen(pFileName);
+    *pnSize = 0;
+    *pfMapped = 0;
+    if ( (Length > 3 && !strcmp(pFileName + Length - 3, ".gz")) || (Length > 4 && !strcmp(pFileName + Length - 4, ".bz2")) )
+        return NULL;
+#ifndef WIN32
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd < 0 )
+            return NULL;
+        if ( fstat( fd, &Stat ) != 0 || Stat.st_size == 0 )
+        {
+            close( fd );
+            return NULL;
+        }
+        *pnSize = (size_t)Stat.st_size;
+        pBuffer = (char *)mmap( NULL, *pnSize, PROT_READ, MAP_PRIVATE, fd, 0 );
+        close( fd );
+        if ( pBuffer != (char *)MAP_FAILED )
+        {
+            *pfMapped = 1;
+            return pBuffer;
+        }
+    }
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    *pnSize = (size_t)ftell( pFile );
+    rewind( pFile );
+    pBuffer = ABC_ALLOC( char, *pnSize + 1 );
+    if ( *pnSize == 0 || fread( pBuffer, *pnSize, 1, pFile ) != 1 )
+    {
+        ABC_FREE( pBuffer );
+        fclose( pFile );
+        return NULL;
+    }
+    fclose( pFile );
+    return pBuffer;
+}
+static void Io_VerFastUnload( char * pBuffer, size_t nSize, int fMapped )
+{
+#ifndef WIN32
+    if ( fMapped )
+    {
+        munmap( pBuffer, nSize );
+        return;
+    }
+#endif
+    ABC_FREE( pBuffer );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Skips spaces and comments.]
+
+  Description [Returns the first symbol that is not a space and does not
+  belong to a comment.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline char * Io_VerFastSkip( char * pCur, char * pLimit )
+{
+    while ( pCur < pLimit )
+    {
+        if ( *pCur == ' ' || *pCur == '\t' || *pCur == '\n' || *pCur == '\r' )
+            pCur++;
+        else if ( *pCur == '/' && pCur + 1 < pLimit && pCur[1] == '/' )
+        {
+            while ( pCur < pLimit && *pCur != '\n' )
+                pCur++;
+        }
+        else if ( *pCur == '/' && pCur + 1 < pLimit && pCur[1] == '*' )
+        {
+            for ( pCur += 2; pCur + 1 < pLimit; pCur++ )
+                if ( pCur[0] == '*' && pCur[1] == '/' )
+                    break;
+            pCur += 2;
+        }
+        else
+            break;
+    }
+    return pCur < pLimit ? pCur : pLimit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads one name.]
+
+  Description [Follows Ver_ParseGetName(). The escaped name ends before
+  the first space or new line and does not include the backslash.
+  The other names end before a space or one of the symbols "(),;".
+  Returns the position after the name and the following spaces,
+  or NULL if the name is not found.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Io_VerFastIsStop( char c ) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '(' || c == ')' || c == ',' || c == ';'; }
+
+static inline char * Io_VerFastName( char * pCur, char * pLimit, char ** ppBeg, char ** ppEnd )
+{
+    if ( pCur == pLimit )
+        return NULL;
+    if ( *pCur == '\\' )
+    {
+        *ppBeg = ++pCur;
+        while ( pCur < pLimit && *pCur != ' ' && *pCur != '\n' && *pCur != '\r' )
+            pCur++;
+        *ppEnd = pCur;
+        // the escaped name followed by the bit index is not handled
+        while ( pCur < pLimit && (*pCur == ' ' || *pCur == '\n' || *pCur == '\r') )
+            pCur++;
+        if ( pCur < pLimit && *pCur == '[' )
+            return NULL;
+    }
+    else
+    {
+        *ppBeg = pCur;
+        while ( pCur < pLimit && !Io_VerFastIsStop(*pCur) )
+            pCur++;
+        *ppEnd = pCur;
+    }
+    if ( *ppBeg == *ppEnd )
+        return NULL;
+    return Io_VerFastSkip( pCur, pLimit );
+}
+static inline int Io_VerFastTokenIs( char * pBeg, char * pEnd, char * pStr )
+{
+    int Length = strlen(pStr);
+    return pEnd - pBeg == Length && !strncmp( pBeg, pStr, Length );
+}
+static inline char * Io_VerFastChar( char * pCur, char * pLimit, char c )
+{
+    if ( pCur == pLimit || *pCur != c )
+        return NULL;
+    return Io_VerFastSkip( pCur + 1, pLimit );
+}
+static inline void Io_VerFastPushName( Io_VerChunk_t * p, char * pBeg, char * pEnd )
+{
+    Vec_IntPush( p->vRecs, pBeg - p->pBase );
+    Vec_IntPush( p->vRecs, pEnd - pBeg );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the range of the form [Msb:Lsb].]
+
+  Description [Returns the position after the range or NULL.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_VerFastRange( char * pCur, char * pLimit, int * pnMsb, int * pnLsb )
+{
+    int * pNum = pnMsb;
+    assert( *pCur == '[' );
+    *pnMsb = *pnLsb = 0;
+    for ( pCur++; pCur < pLimit; pCur++ )
+    {
+        if ( *pCur >= '0' && *pCur <= '9' )
+        {
+            if ( *pNum > 100000000 )
+                return NULL;
+            *pNum = 10 * *pNum + (*pCur - '0');
+        }
+        else if ( *pCur == ':' && pNum == pnMsb && pCur[-1] != '[' )
+            pNum = pnLsb;
+        else if ( *pCur == ']' && pNum == pnLsb && pCur[-1] != ':' )
+            return pCur + 1;
+        else
+            return NULL;
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the signal declaration.]
+
+  Description [Follows Ver_ParseSignal().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_VerFastSignal( Io_VerChunk_t * p, char * pCur, int SigType )
+{
+    char * pBeg, * pEnd;
+    int nMsb = -1, nLsb = -1;
+    while ( 1 )
+    {
+        if ( pCur == p->pLimit )
+            return NULL;
+        if ( *pCur == '[' )
+        {
+            if ( nMsb != -1 )
+                return NULL;
+            if ( !(pCur = Io_VerFastRange(pCur, p->pLimit, &nMsb, &nLsb)) )
+                return NULL;
+            // the name may follow the range without a space
+            pCur = Io_VerFastSkip( pCur, p->pLimit );
+            if ( pCur == p->pLimit || *pCur == '\\' || *pCur == '[' )
+                return NULL;
+        }
+        if ( !(pCur = Io_VerFastName(pCur, p->pLimit, &pBeg, &pEnd)) )
+            return NULL;
+        if ( Io_VerFastTokenIs(pBeg, pEnd, "wire") )
+            continue;
+        p->nNames += nMsb == -1 ? 1 : Abc_AbsInt(nMsb - nLsb) + 1;
+        Vec_IntPush( p->vRecs, IO_VER_SIG );
+        Vec_IntPush( p->vRecs, SigType );
+        Vec_IntPush( p->vRecs, nMsb );
+        Vec_IntPush( p->vRecs, nLsb );
+        Io_VerFastPushName( p, pBeg, pEnd );
+        if ( pCur == p->pLimit )
+            return NULL;
+        if ( *pCur == ';' )
+            return pCur + 1;
+        if ( *pCur != ',' )
+            return NULL;
+        pCur = Io_VerFastSkip( pCur + 1, p->pLimit );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the gate instance.]
+
+  Description [Follows Ver_ParseGate(). The gates with two outputs
+  are not handled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_VerFastGate( Io_VerChunk_t * p, char * pCur, Mio_Gate_t * pGate )
+{
+    Mio_Pin_t * pPin;
+    char * pBeg, * pEnd;
+    int iPinNum, iPin, nPins = Mio_GateReadPinNum(pGate);
+    if ( Mio_GateReadTwin(pGate) )
+        return NULL;
+    // skip the instance name
+    if ( !(pCur = Io_VerFastName(pCur, p->pLimit, &pBeg, &pEnd)) )
+        return NULL;
+    if ( !(pCur = Io_VerFastChar(pCur, p->pLimit, '(')) )
+        return NULL;
+    Vec_IntPush( p->vRecs, IO_VER_GATE );
+    iPinNum = Vec_IntSize( p->vRecs );
+    Vec_IntPush( p->vRecs, 0 );
+    Vec_PtrPush( p->vGates, pGate );
+    while ( 1 )
+    {
+        // the formal name
+        if ( !(pCur = Io_VerFastChar(pCur, p->pLimit, '.')) )
+            return NULL;
+        if ( !(pCur = Io_VerFastName(pCur, p->pLimit, &pBeg, &pEnd)) )
+            return NULL;
+        for ( iPin = 0, pPin = Mio_GateReadPins(pGate); pPin; pPin = Mio_PinReadNext(pPin), iPin++ )
+            if ( Io_VerFastTokenIs(pBeg, pEnd, Mio_PinReadName(pPin)) )
+                break;
+        if ( pPin == NULL && !Io_VerFastTokenIs(pBeg, pEnd, Mio_GateReadOutName(pGate)) )
+            return NULL;
+        assert( pPin != NULL || iPin == nPins );
+        // the actual name
+        if ( !(pCur = Io_VerFastChar(pCur, p->pLimit, '(')) )
+            return NULL;
+        if ( !(pCur = Io_VerFastName(pCur, p->pLimit, &pBeg, &pEnd)) )
+            return NULL;
+        if ( !(pCur = Io_VerFastChar(pCur, p->pLimit, ')')) )
+            return NULL;
+        Vec_IntPush( p->vRecs, iPin );
+        Io_VerFastPushName( p, pBeg, pEnd );
+        Vec_IntAddToEntry( p->vRecs, iPinNum, 1 );
+        if ( pCur == p->pLimit )
+            return NULL;
+        if ( *pCur == ')' )
+            break;
+        if ( !(pCur = Io_VerFastChar(pCur, p->pLimit, ',')) )
+            return NULL;
+    }
+    pCur = Io_VerFastSkip( pCur + 1, p->pLimit );
+    if ( pCur == p->pLimit || *pCur != ';' )
+        return NULL;
+    return pCur + 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the always or the initial block.]
+
+  Description [Follows Ver_ParseAlways() and Ver_ParseInitial().
+  The complemented latch inputs are not handled.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_VerFastBlock( Io_VerChunk_t * p, char * pCur, int fInitial )
+{
+    char * pBeg, * pEnd, * pBeg2, * pEnd2;
+    int fStopAfterOne;
+    if ( !(pCur = Io_VerFastName(pCur, p->pLimit, &pBeg, &pEnd)) )
+        return NULL;
+    if ( !fInitial && *pBeg == '@' )
+    {
+        while ( pCur < p->pLimit && *pCur != ')' )
+            pCur++;
+        if ( pCur == p->pLimit )
+            return NULL;
+        pCur = Io_VerFastSkip( pCur + 1, p->pLimit );
+        if ( !(pCur = Io_VerFastName(pCur, p->pLimit, &pBeg, &pEnd)) )
+            return NULL;
+    }
+    fStopAfterOne = !Io_VerFastTokenIs( pBeg, pEnd, "begin" );
+    while ( 1 )
+    {
+        if ( !fStopAfterOne )
+        {
+            if ( !(pCur = Io_VerFastName(pCur, p->pLimit, &pBeg, &pEnd)) )
+                return NULL;
+            if ( Io_VerFastTokenIs(pBeg, pEnd, "end") )
+                return pEnd;
+        }
+        // the assignment sign
+        if ( pCur == p->pLimit || (*pCur != '<' && *pCur != '=') )
+            return NULL;
+        if ( *pCur == '<' && ++pCur == p->pLimit )
+            return NULL;
+        pCur = Io_VerFastSkip( pCur + 1, p->pLimit );
+        // the right-hand side
+        if ( !(pCur = Io_VerFastName(pCur, p->pLimit, &pBeg2, &pEnd2)) )
+            return NULL;
+        if ( pCur == p->pLimit || *pCur != ';' )
+            return NULL;
+        pCur++;
+        if ( fInitial )
+        {
+            int Value = -1;
+            if ( Io_VerFastTokenIs(pBeg2, pEnd2, "0") || Io_VerFastTokenIs(pBeg2, pEnd2, "1\'b0") )
+                Value = 0;
+            else if ( Io_VerFastTokenIs(pBeg2, pEnd2, "1") || Io_VerFastTokenIs(pBeg2, pEnd2, "1\'b1") )
+                Value = 1;
+            else
+                return NULL;
+            Vec_IntPush( p->vRecs, IO_VER_INIT );
+            Io_VerFastPushName( p, pBeg, pEnd );
+            Vec_IntPush( p->vRecs, Value );
+        }
+        else
+        {
+            if ( *pBeg2 == '~' )
+                return NULL;
+            p->nNames++;
+            Vec_IntPush( p->vRecs, IO_VER_LATCH );
+            Io_VerFastPushName( p, pBeg, pEnd );
+            Io_VerFastPushName( p, pBeg2, pEnd2 );
+        }
+        if ( fStopAfterOne )
+            return pCur;
+        pCur = Io_VerFastSkip( pCur, p->pLimit );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the statements of one chunk.]
+
+  Description [Parses the statements beginning before p->pStop.
+  Sets p->pEnd to the beginning of the next statement.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_VerFastParseChunk( Io_VerChunk_t * p )
+{
+    Mio_Gate_t * pGate;
+    char * pCur, * pBeg, * pEnd, Buffer[1000];
+    Vec_IntClear( p->vRecs );
+    Vec_PtrClear( p->vGates );
+    p->fOk = p->fEndModule = p->nNames = 0;
+    pCur = Io_VerFastSkip( p->pStart, p->pLimit );
+    while ( pCur < p->pStop )
+    {
+        if ( !(pCur = Io_VerFastName(pCur, p->pLimit, &pBeg, &pEnd)) )
+            return;
+        if ( Io_VerFastTokenIs(pBeg, pEnd, "input") )
+            pCur = Io_VerFastSignal( p, pCur, IO_VER_INPUT );
+        else if ( Io_VerFastTokenIs(pBeg, pEnd, "output") )
+            pCur = Io_VerFastSignal( p, pCur, IO_VER_OUTPUT );
+        else if ( Io_VerFastTokenIs(pBeg, pEnd, "inout") )
+            pCur = Io_VerFastSignal( p, pCur, IO_VER_INOUT );
+        else if ( Io_VerFastTokenIs(pBeg, pEnd, "reg") )
+            pCur = Io_VerFastSignal( p, pCur, IO_VER_REG );
+        else if ( Io_VerFastTokenIs(pBeg, pEnd, "wire") )
+            pCur = Io_VerFastSignal( p, pCur, IO_VER_WIRE );
+        else if ( Io_VerFastTokenIs(pBeg, pEnd, "always") )
+            pCur = Io_VerFastBlock( p, pCur, 0 );
+        else if ( Io_VerFastTokenIs(pBeg, pEnd, "initial") )
+            pCur = Io_VerFastBlock( p, pCur, 1 );
+        else if ( Io_VerFastTokenIs(pBeg, pEnd, "endmodule") )
+        {
+            Vec_IntPush( p->vRecs, IO_VER_END );
+            p->pEnd = Io_VerFastSkip( pEnd, p->pLimit );
+            p->fOk = p->fEndModule = 1;
+            return;
+        }
+        else
+        {
+            // the primitives and the other statements handled by the Verilog parser are declined
+            if ( pEnd - pBeg >= 1000 )
+                return;
+            memcpy( Buffer, pBeg, pEnd - pBeg );
+            Buffer[pEnd - pBeg] = 0;
+            if ( !strcmp(Buffer, "and") || !strcmp(Buffer, "or") || !strcmp(Buffer, "xor") || !strcmp(Buffer, "buf") ||
+                 !strcmp(Buffer, "nand") || !strcmp(Buffer, "nor") || !strcmp(Buffer, "xnor") || !strcmp(Buffer, "not") ||
+                 !strcmp(Buffer, "dff") || !strcmp(Buffer, "assign") )
+                return;
+            if ( (pGate = Mio_LibraryReadGateByName(p->pLib, Buffer, NULL)) == NULL )
+                return;
+            pCur = Io_VerFastGate( p, pCur, pGate );
+        }
+        if ( pCur == NULL )
+            return;
+        pCur = Io_VerFastSkip( pCur, p->pLimit );
+    }
+    p->pEnd = pCur;
+    p->fOk = 1;
+}
+
+#ifdef ABC_USE_PTHREADS
+static void * Io_VerFastWorkerThread( void * pArg )
+{
+    Io_VerFastParseChunk( (Io_VerChunk_t *)pArg );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the module body.]
+
+  Description [Splits the body into chunks and parses them in parallel.
+  Returns the number of chunks containing the module, or 0 if the file
+  should be declined. The number of allocated chunks is returned in
+  pnChunks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_VerFastParseBody( Io_VerChunk_t * pChunks, int * pnChunks, Mio_Library_t * pLib, char * pBody, char * pLimit )
+{
+    size_t nSize = pLimit - pBody;
+    int i, nProcs = 1, nChunks;
+    *pnChunks = 0;
+#if defined(ABC_USE_PTHREADS) && !defined(WIN32)
+    nProcs = (int)sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+    nChunks = Abc_MinInt( Abc_MaxInt(nProcs, 1), (int)(nSize / IO_VER_CHUNK_MIN) );
+    nChunks = Abc_MaxInt( nChunks, (int)(nSize / IO_VER_CHUNK_MAX) + 1 );
+    nChunks = Abc_MinInt( nChunks, IO_VER_THR_MAX );
+    if ( nSize / nChunks > IO_VER_CHUNK_MAX )
+        return 0;
+    *pnChunks = nChunks;
+    // set the chunk boundaries and guess where the first statements begin
+    for ( i = 0; i < nChunks; i++ )
+    {
+        Io_VerChunk_t * p = pChunks + i;
+        memset( p, 0, sizeof(Io_VerChunk_t) );
+        p->pLib   = pLib;
+        p->pBase  = pBody + nSize / nChunks * i;
+        p->pLimit = pLimit;
+        p->vRecs  = Vec_IntAlloc( 1000 );
+        p->vGates = Vec_PtrAlloc( 100 );
+        p->pStart = p->pBase;
+        if ( i > 0 )
+        {
+            while ( p->pStart < pLimit && *p->pStart != ';' )
+                p->pStart++;
+            if ( p->pStart < pLimit )
+                p->pStart++;
+        }
+        p->pStart = Io_VerFastSkip( p->pStart, pLimit );
+        if ( i > 0 )
+            pChunks[i-1].pStop = p->pBase;
+    }
+    pChunks[nChunks-1].pStop = pLimit;
+#ifdef ABC_USE_PTHREADS
+    if ( nChunks > 1 )
+    {
+        pthread_t WorkerThread[IO_VER_THR_MAX];
+        int status;
+        for ( i = 1; i < nChunks; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Io_VerFastWorkerThread, (void *)(pChunks + i) );  assert( status == 0 );
+        }
+        Io_VerFastParseChunk( pChunks );
+        for ( i = 1; i < nChunks; i++ )
+            pthread_join( WorkerThread[i], NULL );
+    }
+    else
+#endif
+    for ( i = 0; i < nChunks; i++ )
+        Io_VerFastParseChunk( pChunks + i );
+    // parse again the chunks whose beginnings were guessed incorrectly
+    for ( i = 1; i < nChunks; i++ )
+    {
+        Io_VerChunk_t * p = pChunks + i, * pPrev = pChunks + i - 1;
+        if ( !pPrev->fOk )
+            return 0;
+        if ( pPrev->fEndModule )
+        {
+            // the other modules are not handled
+            if ( pPrev->pEnd != pLimit )
+                return 0;
+            return i;
+        }
+        if ( p->pStart == pPrev->pEnd )
+            continue;
+        p->pStart = pPrev->pEnd;
+        if ( p->pStart < p->pStop )
+            Io_VerFastParseChunk( p );
+        else
+        {
+            // the previous chunk has parsed all statements of this one
+            Vec_IntClear( p->vRecs );
+            Vec_PtrClear( p->vGates );
+            p->pEnd = p->pStart;
+            p->fOk = 1;
+            p->fEndModule = p->nNames = 0;
+        }
+    }
+    if ( !pChunks[nChunks-1].fOk || !pChunks[nChunks-1].fEndModule || pChunks[nChunks-1].pEnd != pLimit )
+        return 0;
+    return nChunks;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the module header.]
+
+  Description [Returns the model name and the beginning of the body.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_VerFastParseHeader( char * pCur, char * pLimit, char ** ppName )
+{
+    char * pBeg, * pEnd;
+    pCur = Io_VerFastSkip( pCur, pLimit );
+    if ( !(pCur = Io_VerFastName(pCur, pLimit, &pBeg, &pEnd)) || !Io_VerFastTokenIs(pBeg, pEnd, "module") )
+        return NULL;
+    if ( !(pCur = Io_VerFastName(pCur, pLimit, &pBeg, &pEnd)) )
+        return NULL;
+    *ppName = ABC_ALLOC( char, pEnd - pBeg + 1 );
+    memcpy( *ppName, pBeg, pEnd - pBeg );
+    (*ppName)[pEnd - pBeg] = 0;
+    if ( !(pCur = Io_VerFastChar(pCur, pLimit, '(')) )
+        return NULL;
+    // skip the port names
+    while ( 1 )
+    {
+        if ( !(pCur = Io_VerFastName(pCur, pLimit, &pBeg, &pEnd)) || pCur == pLimit )
+            return NULL;
+        if ( *pCur == ')' )
+            break;
+        if ( !(pCur = Io_VerFastChar(pCur, pLimit, ',')) )
+            return NULL;
+    }
+    pCur = Io_VerFastSkip( pCur + 1, pLimit );
+    return Io_VerFastChar( pCur, pLimit, ';' );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the net with the given name.]
+
+  Description [Creates the net if fCreate is set and the net does not
+  exist. Otherwise, follows Ver_ParseFindNet() in handling the constants.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Obj_t * Io_VerFastNet( Abc_Ntk_t * pNtk, Abc_Nam_t * pNames, Vec_Ptr_t * vNets, char * pBeg, char * pEnd, int fCreate )
+{
+    Abc_Obj_t * pNet;
+    int Id = Abc_NamStrFindOrAddLim( pNames, pBeg, pEnd, NULL );
+    pNet = Id < Vec_PtrSize(vNets) ? (Abc_Obj_t *)Vec_PtrEntry( vNets, Id ) : NULL;
+    if ( pNet )
+        return pNet;
+    if ( !fCreate )
+    {
+        char * pConst0 = "1\'b0", * pConst1 = "1\'b1";
+        if ( Io_VerFastTokenIs(pBeg, pEnd, pConst0) || Io_VerFastTokenIs(pBeg, pEnd, "1\'bx") )
+            return Io_VerFastNet( pNtk, pNames, vNets, pConst0, pConst0 + 4, 1 );
+        if ( Io_VerFastTokenIs(pBeg, pEnd, pConst1) )
+            return Io_VerFastNet( pNtk, pNames, vNets, pConst1, pConst1 + 4, 1 );
+        return NULL;
+    }
+    pNet = Abc_NtkCreateNet( pNtk );
+    Nm_ManStoreIdName( pNtk->pManName, pNet->Id, pNet->Type, Abc_NamStr(pNames, Id), NULL );
+    Vec_PtrSetEntry( vNets, Id, pNet );
+    return pNet;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the network from the records.]
+
+  Description [The objects are created in the same order as in
+  the Verilog parser.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Ntk_t * Io_VerFastBuild( Io_VerChunk_t * pChunks, int nChunks, Mio_Library_t * pLib, char * pName )
+{
+    Abc_Ntk_t * pNtk;
+    Abc_Nam_t * pNames;
+    Abc_Obj_t * pNet, * pNetLI, * pTerm, * pNode;
+    Mio_Gate_t * pGate;
+    Vec_Ptr_t * vNets;
+    Vec_Int_t * vPerm;
+    char Buffer[1000], * pBeg, * pEnd;
+    int i, k, b, iGate, Type, SigType, nMsb, nLsb, Limit, Bit, nFanins, nPins, iPin;
+    word uSeen;
+    int nNames = 0, nRecs = 0, fStatements = 0, fOk = 0;
+    for ( i = 0; i < nChunks; i++ )
+    {
+        nNames += pChunks[i].nNames;
+        nRecs  += Vec_IntSize( pChunks[i].vRecs );
+    }
+    pNtk = Abc_NtkAlloc( ABC_NTK_NETLIST, ABC_FUNC_BLACKBOX, 1 );
+    pNtk->pName = pName;
+    Nm_ManFree( pNtk->pManName );
+    pNtk->pManName = Nm_ManCreate( nNames + 200 );
+    pNames = Abc_NamStart( nNames + 1000, 10 );
+    vNets  = Vec_PtrStart( nNames + 1000 );
+    vPerm  = Vec_IntAlloc( 100 );
+    Vec_PtrGrow( pNtk->vObjs, nNames + nRecs / 4 );
+    for ( i = 0; i < nChunks; i++ )
+    {
+        Io_VerChunk_t * p = pChunks + i;
+        int * pRecs = Vec_IntArray( p->vRecs );
+        for ( k = iGate = 0; k < Vec_IntSize(p->vRecs); )
+        {
+            Type = pRecs[k++];
+            if ( Type == IO_VER_SIG )
+            {
+                SigType = pRecs[k++];
+                nMsb    = pRecs[k++];
+                nLsb    = pRecs[k++];
+                pBeg    = p->pBase + pRecs[k++];
+                pEnd    = pBeg + pRecs[k++];
+                // the declarations of inputs, outputs, and registers should precede the other statements
+                if ( fStatements && SigType != IO_VER_WIRE )
+                    goto finish;
+                Limit = nMsb == -1 ? 1 : Abc_AbsInt(nMsb - nLsb) + 1;
+                if ( Limit > 1 && pEnd - pBeg > 900 )
+                    goto finish;
+                for ( b = 0, Bit = nLsb; b < Limit; b++, Bit = nMsb > nLsb ? Bit + 1 : Bit - 1 )
+                {
+                    if ( Limit > 1 )
+                    {
+                        memcpy( Buffer, pBeg, pEnd - pBeg );
+                        sprintf( Buffer + (pEnd - pBeg), "[%d]", Bit );
+                        pNet = Io_VerFastNet( pNtk, pNames, vNets, Buffer, Buffer + strlen(Buffer), 1 );
+                    }
+                    else
+                        pNet = Io_VerFastNet( pNtk, pNames, vNets, pBeg, pEnd, 1 );
+                    if ( SigType == IO_VER_INPUT || SigType == IO_VER_INOUT )
+                    {
+                        if ( Abc_ObjFaninNum(pNet) > 0 )
+                            goto finish;
+                        pTerm = Abc_NtkCreatePi( pNtk );
+                        Abc_ObjAddFanin( pNet, pTerm );
+                    }
+                    if ( SigType == IO_VER_OUTPUT || SigType == IO_VER_INOUT )
+                    {
+                        pTerm = Abc_NtkCreatePo( pNtk );
+                        Abc_ObjAddFanin( pTerm, pNet );
+                    }
+                }
+            }
+            else if ( Type == IO_VER_GATE )
+            {
+                fStatements = 1;
+                pGate   = (Mio_Gate_t *)Vec_PtrEntry( p->vGates, iGate++ );
+                nFanins = Mio_GateReadPinNum( pGate );
+                nPins   = pRecs[k++];
+                pNode   = Abc_NtkCreateNode( pNtk );
+                pNode->pData = pGate;
+                Vec_IntClear( vPerm );
+                uSeen = 0;
+                for ( b = 0; b < nPins; b++ )
+                {
+                    iPin = pRecs[k++];
+                    pBeg = p->pBase + pRecs[k++];
+                    pEnd = pBeg + pRecs[k++];
+                    // each formal pin should be connected once
+                    if ( iPin >= 64 || ((uSeen >> iPin) & 1) )
+                        goto finish;
+                    uSeen |= (word)1 << iPin;
+                    if ( !(pNet = Io_VerFastNet(pNtk, pNames, vNets, pBeg, pEnd, 0)) )
+                        goto finish;
+                    if ( iPin < nFanins )
+                    {
+                        Vec_IntPush( vPerm, iPin );
+                        Abc_ObjAddFanin( pNode, pNet );
+                    }
+                    else if ( Abc_ObjFaninNum(pNet) == 0 )
+                        Abc_ObjAddFanin( pNet, pNode );
+                    else
+                        goto finish;
+                }
+                if ( !(Abc_ObjFaninNum(pNode) == nFanins && Abc_ObjFanoutNum(pNode) == 1) )
+                    goto finish;
+                // permute the fanins according to the order of pins in the gate
+                for ( b = 0; b < nFanins; b++ )
+                    if ( Vec_IntEntry(vPerm, b) != b )
+                        break;
+                if ( b < nFanins )
+                {
+                    for ( b = 0; b < nFanins; b++ )
+                        Vec_IntPush( vPerm, Abc_ObjFaninId(pNode, b) );
+                    for ( b = 0; b < nFanins; b++ )
+                        Vec_IntWriteEntry( &pNode->vFanins, Vec_IntEntry(vPerm, b), Vec_IntEntry(vPerm, b+nFanins) );
+                }
+            }
+            else if ( Type == IO_VER_LATCH )
+            {
+                fStatements = 1;
+                pBeg = p->pBase + pRecs[k++];
+                pEnd = pBeg + pRecs[k++];
+                pNet = Io_VerFastNet( pNtk, pNames, vNets, pBeg, pEnd, 0 );
+                pBeg = p->pBase + pRecs[k++];
+                pEnd = pBeg + pRecs[k++];
+                pNetLI = Io_VerFastNet( pNtk, pNames, vNets, pBeg, pEnd, 0 );
+                if ( pNet == NULL || pNetLI == NULL || Abc_ObjFaninNum(pNet) > 0 )
+                    goto finish;
+                // same as Ver_ParseCreateLatch()
+                pTerm = Abc_NtkCreateBi( pNtk );
+                Abc_ObjAddFanin( pTerm, pNetLI );
+                pNode = Abc_NtkCreateLatch( pNtk );
+                Abc_ObjAddFanin( pNode, pTerm );
+                pTerm = Abc_NtkCreateBo( pNtk );
+                Abc_ObjAddFanin( pTerm, pNode );
+                Abc_ObjAddFanin( pNet, pTerm );
+                Abc_ObjAssignName( pNode, Abc_ObjName(pNet), "L" );
+                Abc_LatchSetInitDc( pNode );
+            }
+            else if ( Type == IO_VER_INIT )
+            {
+                fStatements = 1;
+                pBeg = p->pBase + pRecs[k++];
+                pEnd = pBeg + pRecs[k++];
+                pNet = Io_VerFastNet( pNtk, pNames, vNets, pBeg, pEnd, 0 );
+                if ( pNet == NULL || Abc_ObjFaninNum(pNet) == 0 || !Abc_ObjIsLatch(Abc_ObjFanin0(Abc_ObjFanin0(pNet))) )
+                    goto finish;
+                pNode = Abc_ObjFanin0(Abc_ObjFanin0(pNet));
+                if ( pRecs[k++] )
+                    Abc_LatchSetInit1( pNode );
+                else
+                    Abc_LatchSetInit0( pNode );
+            }
+            else if ( Type == IO_VER_END )
+            {
+                assert( k == Vec_IntSize(p->vRecs) );
+                fOk = 1;
+            }
+            else assert( 0 );
+        }
+    }
+    // the module without gates and latches is a blackbox, which is not handled
+    if ( fOk && (Abc_NtkNodeNum(pNtk) > 0 || Abc_NtkBoxNum(pNtk) > 0) )
+    {
+        pNtk->ntkFunc  = ABC_FUNC_MAP;
+        pNtk->pManFunc = pLib;
+        Abc_NtkFinalizeRead( pNtk );
+    }
+    else
+        fOk = 0;
+finish:
+    Abc_NamStop( pNames );
+    Vec_PtrFree( vNets );
+    Vec_IntFree( vPerm );
+    if ( fOk )
+        return pNtk;
+    Abc_NtkDelete( pNtk );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the flat gate-level Verilog file.]
+
+  Description [Returns NULL if the file cannot be read by this reader,
+  for example, because it is hierarchical, uses the constructs not
+  supported here, or has errors. Such files should be read by
+  Ver_ParseFile(), which also reports the errors.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadVerilogFast( char * pFileName, int fCheck )
+{
+    Io_VerChunk_t pChunks[IO_VER_THR_MAX];
+    Mio_Library_t * pLib = (Mio_Library_t *)Abc_FrameReadLibGen();
+    Abc_Ntk_t * pNtk = NULL;
+    char * pBuffer, * pBody, * pName = NULL;
+    int i, fMapped, nUsed = 0, nChunks = 0;
+    size_t nSize;
+    if ( pLib == NULL )
+        return NULL;
+    pBuffer = Io_VerFastLoad( pFileName, &nSize, &fMapped );
+    if ( pBuffer == NULL )
+        return NULL;
+    pBody = Io_VerFastParseHeader( pBuffer, pBuffer + nSize, &pName );
+    if ( pBody )
+        nUsed = Io_VerFastParseBody( pChunks, &nChunks, pLib, pBody, pBuffer + nSize );
+    if ( nUsed )
+    {
+        pNtk = Io_VerFastBuild( pChunks, nUsed, pLib, pName );
+        pName = NULL;
+    }
+    for ( i = 0; i < nChunks; i++ )
+    {
+        Vec_IntFree( pChunks[i].vRecs );
+        Vec_PtrFree( pChunks[i].vGates );
+    }
+    Io_VerFastUnload( pBuffer, nSize, fMapped );
+    ABC_FREE( pName );
+    if ( pNtk == NULL )
+        return NULL;
+    if ( fCheck && !Abc_NtkCheckRead( pNtk ) )
+    {
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    pNtk->pSpec = Extra_UtilStrsav( pFileName );
+    return pNtk;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -133,8 +133,13 @@ Abc_Ntk_t * Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck
     }
     // read the new netlist
     if ( FileType == IO_FILE_BLIF )
+    {
 //        pNtk = Io_ReadBlif( pFileName, fCheck );
-        pNtk = Io_ReadBlifMv( pFileName, 0, fCheck );
+        // flat files are read by the fast reader, the rest by the BLIF-MV reader
+        pNtk = Io_ReadBlifFast( pFileName, fCheck );
+        if ( pNtk == NULL )
+            pNtk = Io_ReadBlifMv( pFileName, 0, fCheck );
+    }
     else if ( Io_ReadFileType(pFileName) == IO_FILE_BLIFMV )
         pNtk = Io_ReadBlifMv( pFileName, 1, fCheck );
     else if ( FileType == IO_FILE_BENCH )
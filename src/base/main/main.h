@@ -71,6 +71,9 @@ ABC_NAMESPACE_HEADER_START
 /*=== main.c ===========================================================*/
 extern ABC_DLL void            Abc_Start();
 extern ABC_DLL void            Abc_Stop();
+extern ABC_DLL Abc_Frame_t *   Abc_SessionStart();
+extern ABC_DLL void            Abc_SessionStop( Abc_Frame_t * pAbc );
+extern ABC_DLL int             Abc_SessionExecute( Abc_Frame_t * pAbc, const char * pCommand );
 
 /*=== mainFrame.c ===========================================================*/
 extern ABC_DLL Abc_Ntk_t *     Abc_FrameReadNtk( Abc_Frame_t * p );
@@ -94,6 +97,8 @@ extern ABC_DLL void            Abc_FrameDeleteAllNetworks( Abc_Frame_t * p );
 extern ABC_DLL void			   Abc_FrameSetGlobalFrame( Abc_Frame_t * p );
 extern ABC_DLL Abc_Frame_t *   Abc_FrameGetGlobalFrame();
 extern ABC_DLL Abc_Frame_t *   Abc_FrameReadGlobalFrame();
+extern ABC_DLL Abc_Frame_t *   Abc_FrameSetThreadFrame( Abc_Frame_t * p );
+extern ABC_DLL int             Abc_FrameIsLast( Abc_Frame_t * p );
 
 extern ABC_DLL Vec_Ptr_t *     Abc_FrameReadStore();                  
 extern ABC_DLL int             Abc_FrameReadStoreSize();              
@@ -134,6 +134,7 @@ void Abc_FrameInit( Abc_Frame_t * pAbc )
 void Abc_FrameEnd( Abc_Frame_t * pAbc )
 {
     Abc_FrameInitializer_t* p;
+    Abc_FrameSetEnding( pAbc );
     for( p = s_InitializerEnd ; p ; p = p->prev )
     	if ( p->destroy )
     		p->destroy(pAbc);
@@ -74,6 +74,8 @@ struct Abc_Frame_t_
     int             fAutoexac;     // marks the autoexec mode
     int             fBatchMode;    // batch mode flag
     int             fBridgeMode;   // bridge mode flag
+    int             fEnding;       // the frame is being ended
+    int             fLastFrame;    // the frame was the last one when it started ending
     // output streams
     FILE *          Out;
     FILE *          Err;
@@ -105,7 +107,8 @@ struct Abc_Frame_t_
     // new code
     Gia_Man_t *     pGia;          // alternative current network as a light-weight AIG
     Gia_Man_t *     pGia2;         // copy of the above
-    Gia_Man_t *     pGiaBest;      // copy of the above
+    Gia_Snap_t *    pGiaBest;      // snapshot of the best mapped AIG
+    Vec_Ptr_t *     vGiaSnaps;     // stack of AIG snapshots (the last one is the most recent)
     int             nBestLuts;     // best LUT count
     int             nBestEdges;    // best edge count
     int             nBestLevels;   // best level count
@@ -171,6 +174,7 @@ extern ABC_DLL void            Abc_FrameEnd( Abc_Frame_t * pAbc );
 extern ABC_DLL void            Abc_FrameAddInitializer( Abc_FrameInitializer_t* p );
 /*=== mvFrame.c =====================================================*/
 extern ABC_DLL Abc_Frame_t *   Abc_FrameAllocate();
+extern ABC_DLL void            Abc_FrameSetEnding( Abc_Frame_t * p );
 extern ABC_DLL void            Abc_FrameDeallocate( Abc_Frame_t * p );
 /*=== mvUtils.c =====================================================*/
 extern ABC_DLL char *          Abc_UtilsGetVersion( Abc_Frame_t * pAbc );
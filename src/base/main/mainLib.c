@@ -83,6 +83,78 @@ void Abc_Stop()
     Abc_FrameDeallocate( pAbc );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts an independent session.]
+
+  Description [A session is a frame with its own networks, libraries,
+  flags and command table. Any number of sessions can coexist with each 
+  other and with the process-wide frame started by Abc_Start(). Different 
+  threads can execute commands in different sessions at the same time; 
+  the same session should not be used by two threads simultaneously.
+  A few engines still keep process-wide data shared by all sessions 
+  and should not be used by two sessions at the same time: the AIG 
+  recorder (rec_start3), the networks saved by fraig_store, the NPN 
+  table (npnload, npnsave), the canonical AIG manager, and the library 
+  data of the GIA rewriter (&rwr, &shrink).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Frame_t * Abc_SessionStart()
+{
+    Abc_Frame_t * pAbc, * pPrev;
+    pAbc  = Abc_FrameAllocate();
+    pPrev = Abc_FrameSetThreadFrame( pAbc );
+    Abc_FrameInit( pAbc );
+    Abc_FrameSetThreadFrame( pPrev );
+    return pAbc;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the session.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SessionStop( Abc_Frame_t * pAbc )
+{
+    Abc_Frame_t * pPrev;
+    pPrev = Abc_FrameSetThreadFrame( pAbc );
+    Abc_FrameEnd( pAbc );
+    Abc_FrameDeallocate( pAbc );
+    Abc_FrameSetThreadFrame( pPrev == pAbc ? NULL : pPrev );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Executes the command in the session.]
+
+  Description [The session is current in the calling thread while the
+  command runs. Returns the value returned by the command.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_SessionExecute( Abc_Frame_t * pAbc, const char * pCommand )
+{
+    Abc_Frame_t * pPrev;
+    int Status;
+    pPrev  = Abc_FrameSetThreadFrame( pAbc );
+    Status = Cmd_CommandExecute( pAbc, pCommand );
+    Abc_FrameSetThreadFrame( pPrev );
+    return Status;
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
@@ -52,6 +52,7 @@ struct Gia_ParLlb_t_
     int         nPartValue;    // partitioning value
     int         fBackward;     // enable backward reachability
     int         fReorder;      // enable dynamic variable reordering
+    int         nProcs;        // the number of threads for image computation
     int         fIndConstr;    // extract inductive constraints
     int         fUsePivots;    // use internal pivot variables
     int         fCluster;      // use partition clustering
@@ -57,6 +57,7 @@ void Llb_ManSetDefaultParams( Gia_ParLlb_t * p )
     p->nPartValue    =        5;  // partitioning value
     p->fBackward     =        0;  // forward by default
     p->fReorder      =        1;
+    p->nProcs        =        1;
     p->fIndConstr    =        0;
     p->fUsePivots    =        0;
     p->fCluster      =        0;
@@ -21,6 +21,17 @@
 #include "llbInt.h"
 #include "base/abc/abc.h"
 #include "aig/gia/giaAig.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
  
@@ -49,6 +60,9 @@ struct Llb_Mnx_t_
     Vec_Int_t *     vOrder;         // for each object ID, its BDD variable number or -1
     Vec_Int_t *     vVars2Q;        // 1 if variable is quantifiable; 0 othervise
 
+    // parallel image computation
+    void *          pPar;           // worker threads and their BDD managers
+
     abctime         timeImage;
     abctime         timeRemap;
     abctime         timeReo;
@@ -656,6 +670,350 @@ Vec_Ptr_t * Llb_Nonlin4DeriveCex( Llb_Mnx_t * p, int fBackward, int fVerbose )
 }
 
 
+#ifndef ABC_USE_PTHREADS
+
+void       Llb_Nonlin4ParStart( Llb_Mnx_t * p )                      {}
+void       Llb_Nonlin4ParStop( Llb_Mnx_t * p )                       {}
+DdNode *   Llb_Nonlin4ImagePar( Llb_Mnx_t * p, DdNode * bCurrent )   { return NULL; }
+
+#else // pthreads are used
+
+#define PAR_THR_MAX 100
+
+typedef struct Llb_ParThData_t_
+{
+    DdManager *      dd;             // BDD manager of this thread
+    Vec_Ptr_t *      vRoots;         // partitions transferred into this manager
+    Vec_Int_t *      vVars2Q;        // variables to quantify (shared, read-only)
+    DdNode *         bCurrent;       // the piece of the from-states
+    DdNode *         bImage;         // the image of this piece
+    int              iThread;        // thread number
+    int              fWorking;       // the thread is busy
+    abctime          clkUsed;        // runtime of this thread
+} Llb_ParThData_t;
+
+typedef struct Llb_MnxPar_t_
+{
+    int              nProcs;         // the number of threads
+    Llb_ParThData_t  ThData[PAR_THR_MAX];
+    pthread_t        WorkerThread[PAR_THR_MAX];
+} Llb_MnxPar_t;
+
+// dynamic reordering in CUDD keeps its state in static variables
+static pthread_mutex_t s_MutexReo = PTHREAD_MUTEX_INITIALIZER;
+static ABC_THREAD_LOCAL int s_fMutexReoLocked = 0; // the calling thread holds the mutex
+
+/**Function*************************************************************
+
+  Synopsis    [Serializes dynamic reordering in the worker managers.]
+
+  Description [These are CUDD hooks called before and after reordering.
+  Cudd_ReduceHeap() skips the post-reordering hook when reordering fails, 
+  so the worker also calls Llb_Nonlin4ParReoRelease() after each image.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Llb_Nonlin4ParReoStart( DdManager * dd, const char * pStr, void * pData )
+{
+    if ( !s_fMutexReoLocked )
+        pthread_mutex_lock( &s_MutexReo );
+    s_fMutexReoLocked = 1;
+    return 1;
+}
+void Llb_Nonlin4ParReoRelease()
+{
+    if ( s_fMutexReoLocked )
+        pthread_mutex_unlock( &s_MutexReo );
+    s_fMutexReoLocked = 0;
+}
+int Llb_Nonlin4ParReoStop( DdManager * dd, const char * pStr, void * pData )
+{
+    Llb_Nonlin4ParReoRelease();
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the variable whose both cofactors are non-empty.]
+
+  Description [Returns -1 if the function is a cube.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Llb_Nonlin4SplitVar( DdManager * dd, DdNode * bFunc )
+{
+    DdNode * bZero = Cudd_ReadLogicZero( dd ), * bThen, * bElse;
+    while ( !Cudd_IsConstant(bFunc) )
+    {
+        bThen = Cudd_NotCond( Cudd_T(Cudd_Regular(bFunc)), Cudd_IsComplement(bFunc) );
+        bElse = Cudd_NotCond( Cudd_E(Cudd_Regular(bFunc)), Cudd_IsComplement(bFunc) );
+        if ( bThen != bZero && bElse != bZero )
+            return Cudd_NodeReadIndex( bFunc );
+        bFunc = bThen == bZero ? bElse : bThen;
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the set of states into disjoint pieces.]
+
+  Description [Iteratively cofactors the largest piece until the given 
+  number of pieces is reached or all pieces are cubes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Llb_Nonlin4SplitStates( DdManager * dd, DdNode * bStates, int nParts )
+{
+    Vec_Ptr_t * vParts = Vec_PtrAlloc( nParts );
+    DdNode * bPart, * bVar, * bCof0, * bCof1;
+    int i, iVar, iVarBest, iBest, Size, SizeBest;
+    Cudd_Ref( bStates );
+    Vec_PtrPush( vParts, bStates );
+    while ( Vec_PtrSize(vParts) < nParts )
+    {
+        // find the largest piece that can still be split
+        iBest = iVarBest = -1; SizeBest = 0;
+        Vec_PtrForEachEntry( DdNode *, vParts, bPart, i )
+        {
+            Size = Cudd_DagSize( bPart );
+            if ( SizeBest >= Size || (iVar = Llb_Nonlin4SplitVar(dd, bPart)) == -1 )
+                continue;
+            SizeBest = Size, iBest = i, iVarBest = iVar;
+        }
+        if ( iBest == -1 )
+            break;
+        bPart = (DdNode *)Vec_PtrEntry( vParts, iBest );
+        bVar  = Cudd_bddIthVar( dd, iVarBest );
+        bCof0 = Cudd_bddAnd( dd, bPart, Cudd_Not(bVar) );  
+        if ( bCof0 == NULL )
+            break;
+        Cudd_Ref( bCof0 );
+        bCof1 = Cudd_bddAnd( dd, bPart, bVar );
+        if ( bCof1 == NULL )
+        {
+            Cudd_RecursiveDeref( dd, bCof0 );
+            break;
+        }
+        Cudd_Ref( bCof1 );
+        assert( bCof0 != Cudd_ReadLogicZero(dd) && bCof1 != Cudd_ReadLogicZero(dd) );
+        Cudd_RecursiveDeref( dd, bPart );
+        Vec_PtrWriteEntry( vParts, iBest, bCof0 );
+        Vec_PtrPush( vParts, bCof1 );
+    }
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread computing the image of one piece.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Llb_Nonlin4WorkerThread( void * pArg )
+{
+    Llb_ParThData_t * pThData = (Llb_ParThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    abctime clk;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->bCurrent == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        clk = Abc_Clock();
+        pThData->bImage = Llb_Nonlin4Image( pThData->dd, pThData->vRoots, pThData->bCurrent, pThData->vVars2Q );
+        if ( pThData->bImage )
+            Cudd_Ref( pThData->bImage );
+        Llb_Nonlin4ParReoRelease();
+        pThData->clkUsed += Abc_Clock() - clk;
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the worker threads.]
+
+  Description [Each worker owns a BDD manager with the same variables
+  as the main manager and a copy of the transition relation partitions.
+  Workers reorder their managers independently, one at a time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4ParStart( Llb_Mnx_t * p )
+{
+    Llb_MnxPar_t * pPar;
+    Llb_ParThData_t * pThData;
+    DdNode * bFunc, * bTemp;
+    int i, k, status;
+    assert( p->pPar == NULL );
+    if ( p->pPars->nProcs < 2 )
+        return;
+    pPar = ABC_CALLOC( Llb_MnxPar_t, 1 );
+    pPar->nProcs = Abc_MinInt( p->pPars->nProcs, PAR_THR_MAX );
+    for ( i = 0; i < pPar->nProcs; i++ )
+    {
+        pThData = pPar->ThData + i;
+        pThData->dd = Cudd_Init( Cudd_ReadSize(p->dd), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        Cudd_ShuffleHeap( pThData->dd, p->dd->invperm );
+        Cudd_AddHook( pThData->dd, Llb_Nonlin4ParReoStart, CUDD_PRE_REORDERING_HOOK );
+        Cudd_AddHook( pThData->dd, Llb_Nonlin4ParReoStop, CUDD_POST_REORDERING_HOOK );
+        Cudd_AutodynEnable( pThData->dd, CUDD_REORDER_SYMM_SIFT );
+        Cudd_SetMaxGrowth( pThData->dd, 1.05 );
+        pThData->vRoots = Vec_PtrAlloc( Vec_PtrSize(p->vRoots) );
+        Vec_PtrForEachEntry( DdNode *, p->vRoots, bFunc, k )
+        {
+            bTemp = Cudd_bddTransfer( p->dd, pThData->dd, bFunc );  Cudd_Ref( bTemp );
+            Vec_PtrPush( pThData->vRoots, bTemp );
+        }
+        pThData->vVars2Q  = p->vVars2Q;
+        pThData->iThread  = i;
+        pThData->fWorking = 0;
+        status = pthread_create( pPar->WorkerThread + i, NULL, Llb_Nonlin4WorkerThread, (void *)pThData );  assert( status == 0 );
+    }
+    p->pPar = pPar;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the worker threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4ParStop( Llb_Mnx_t * p )
+{
+    Llb_MnxPar_t * pPar = (Llb_MnxPar_t *)p->pPar;
+    Llb_ParThData_t * pThData;
+    DdNode * bTemp;
+    int i, k, status;
+    if ( pPar == NULL )
+        return;
+    for ( i = 0; i < pPar->nProcs; i++ )
+    {
+        pThData = pPar->ThData + i;
+        assert( pThData->fWorking == 0 && pThData->bCurrent == NULL );
+        pThData->fWorking = 1;
+        status = pthread_join( pPar->WorkerThread[i], NULL );  assert( status == 0 );
+        if ( p->pPars->fVerbose )
+            Abc_Print( 1, "Thread %2d :  ", i ), Abc_PrintTime( 1, "Image time", pThData->clkUsed );
+        Vec_PtrForEachEntry( DdNode *, pThData->vRoots, bTemp, k )
+            Cudd_RecursiveDeref( pThData->dd, bTemp );
+        Vec_PtrFree( pThData->vRoots );
+        Extra_StopManager( pThData->dd );
+    }
+    ABC_FREE( pPar );
+    p->pPar = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image by splitting the from-states.]
+
+  Description [The from-states are split into disjoint pieces, whose 
+  images are computed concurrently in the worker managers and OR-ed 
+  together in the main manager. Returns the image (not referenced) 
+  or NULL if the image of some piece could not be computed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_Nonlin4ImagePar( Llb_Mnx_t * p, DdNode * bCurrent )
+{
+    Llb_MnxPar_t * pPar = (Llb_MnxPar_t *)p->pPar;
+    Llb_ParThData_t * pThData;
+    Vec_Ptr_t * vPieces;
+    DdNode * bPiece, * bImage, * bRes, * bTemp;
+    int i, nPieces;
+    assert( pPar != NULL );
+    vPieces = Llb_Nonlin4SplitStates( p->dd, bCurrent, pPar->nProcs );
+    nPieces = Vec_PtrSize( vPieces );
+    // move the pieces into the worker managers while all workers are idle
+    Vec_PtrForEachEntry( DdNode *, vPieces, bPiece, i )
+    {
+        pThData = pPar->ThData + i;
+        pThData->bCurrent = Cudd_bddTransfer( p->dd, pThData->dd, bPiece );  Cudd_Ref( pThData->bCurrent );
+        pThData->bImage   = NULL;
+        Cudd_RecursiveDeref( p->dd, bPiece );
+    }
+    Vec_PtrFree( vPieces );
+    // start the workers and wait till they finish
+    for ( i = 0; i < nPieces; i++ )
+        pPar->ThData[i].fWorking = 1;
+    for ( i = 0; i < nPieces; i++ )
+    {
+        volatile int * pPlace = &pPar->ThData[i].fWorking;
+        while ( *pPlace );
+    }
+    // collect the images in the main manager
+    bRes = Cudd_ReadLogicZero( p->dd );  Cudd_Ref( bRes );
+    for ( i = 0; i < nPieces; i++ )
+    {
+        pThData = pPar->ThData + i;
+        Cudd_RecursiveDeref( pThData->dd, pThData->bCurrent );
+        pThData->bCurrent = NULL;
+        if ( pThData->bImage == NULL )
+        {
+            // the image is incomplete without this piece
+            if ( bRes )
+                Cudd_RecursiveDeref( p->dd, bRes );
+            bRes = NULL;
+            continue;
+        }
+        bImage = bRes ? Cudd_bddTransfer( pThData->dd, p->dd, pThData->bImage ) : NULL;
+        Cudd_RecursiveDeref( pThData->dd, pThData->bImage );
+        pThData->bImage = NULL;
+        if ( bImage == NULL )
+        {
+            if ( bRes )
+                Cudd_RecursiveDeref( p->dd, bRes );
+            bRes = NULL;
+            continue;
+        }
+        Cudd_Ref( bImage );
+        bRes = Cudd_bddOr( p->dd, bTemp = bRes, bImage );
+        if ( bRes ) 
+            Cudd_Ref( bRes );
+        Cudd_RecursiveDeref( p->dd, bTemp );
+        Cudd_RecursiveDeref( p->dd, bImage );
+    }
+    if ( bRes )
+        Cudd_Deref( bRes );
+    return bRes;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Perform reachability with hints.]
@@ -770,7 +1128,10 @@ int Llb_Nonlin4Reachability( Llb_Mnx_t * p )
 
         // compute the next states
         clkTemp = Abc_Clock();
-        p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
+        if ( p->pPar )
+            p->bNext = Llb_Nonlin4ImagePar( p, p->bCurrent );
+        else
+            p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
         if ( p->bNext == NULL )
         {
             if ( !p->pPars->fSilent )
@@ -973,6 +1334,7 @@ Llb_Mnx_t * Llb_MnxStart( Aig_Man_t * pAig, Gia_ParLlb_t * pPars )
 
     if ( pPars->fReorder )
         Llb_Nonlin4Reorder( p->dd, 0, 1 );
+    Llb_Nonlin4ParStart( p );
     return p;
 }
  
@@ -991,6 +1353,7 @@ void Llb_MnxStop( Llb_Mnx_t * p )
 {
     DdNode * bTemp;
     int i;
+    Llb_Nonlin4ParStop( p );
     if ( p->pPars->fVerbose ) 
     {
         p->timeReo = Cudd_ReadReorderingTime(p->dd);
@@ -79,6 +79,8 @@ struct Mem_Step_t_
     int             nLargeChunksAlloc;  // the maximum number of large memory chunks
     int             nLargeChunks;       // the current number of large memory chunks
     void **         pLargeChunks;       // the allocated large memory chunks
+    ABC_INT64_T     nLargeMemoryUsed;   // memory used in the large chunks
+    ABC_INT64_T     nLargeMemoryAlloc;  // memory allocated in the large chunks
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -550,6 +552,8 @@ char * Mem_StepEntryFetch( Mem_Step_t * p, int nBytes )
             p->pLargeChunks = (void **)ABC_REALLOC( char *, p->pLargeChunks, p->nLargeChunksAlloc ); 
         }
         p->pLargeChunks[ p->nLargeChunks++ ] = ABC_ALLOC( char, nBytes );
+        p->nLargeMemoryUsed  += nBytes;
+        p->nLargeMemoryAlloc += nBytes;
         return (char *)p->pLargeChunks[ p->nLargeChunks - 1 ];
     }
     return Mem_FixedEntryFetch( p->pMap[nBytes] );
@@ -574,6 +578,7 @@ void Mem_StepEntryRecycle( Mem_Step_t * p, char * pEntry, int nBytes )
     if ( nBytes > p->nMapSize )
     {
 //        ABC_FREE( pEntry );
+        p->nLargeMemoryUsed -= nBytes;
         return;
     }
     Mem_FixedEntryRecycle( p->pMap[nBytes], pEntry );
@@ -598,6 +603,36 @@ int Mem_StepReadMemUsage( Mem_Step_t * p )
     return nMemTotal;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the memory allocated and the memory in use.]
+
+  Description [Includes the large chunks. The difference is the memory
+  that is not in use: the recycled entries and the large chunks left
+  after recycling (which are not released until the manager is stopped).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+ABC_INT64_T Mem_StepReadMemAlloc( Mem_Step_t * p )
+{
+    ABC_INT64_T nMemTotal = p->nLargeMemoryAlloc;
+    int i;
+    for ( i = 0; i < p->nMems; i++ )
+        nMemTotal += p->pMems[i]->nMemoryAlloc;
+    return nMemTotal;
+}
+ABC_INT64_T Mem_StepReadMemUsed( Mem_Step_t * p )
+{
+    ABC_INT64_T nMemTotal = p->nLargeMemoryUsed;
+    int i;
+    for ( i = 0; i < p->nMems; i++ )
+        nMemTotal += (ABC_INT64_T)p->pMems[i]->nEntrySize * p->pMems[i]->nEntriesUsed;
+    return nMemTotal;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
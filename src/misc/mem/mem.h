@@ -59,6 +59,8 @@ extern void          Mem_StepStop( Mem_Step_t * p, int fVerbose );
 extern char *        Mem_StepEntryFetch( Mem_Step_t * p, int nBytes );
 extern void          Mem_StepEntryRecycle( Mem_Step_t * p, char * pEntry, int nBytes );
 extern int           Mem_StepReadMemUsage( Mem_Step_t * p );
+extern ABC_INT64_T   Mem_StepReadMemAlloc( Mem_Step_t * p );
+extern ABC_INT64_T   Mem_StepReadMemUsed( Mem_Step_t * p );
 
 
 
@@ -41,6 +41,17 @@
     which will help select one of several IDs. If the type is -1, and 
     there is more than one object with the given name, any object with 
     the given name is returned.
+
+    The names are interned in a string pool and are referred to by 32-bit
+    handles. The pool is shared by the name managers of the networks
+    derived from each other by duplication, so copying a name between
+    them copies the handle. Dummy names (such as "pi007") are stored as 
+    a prefix and a number; their strings are created when requested.
+    The returned names remain valid as long as the manager exists.
+    A pool that has accumulated many more names than a manager uses is
+    not shared with the new manager; the names are copied instead.
+    The pool is not thread-safe, so the networks sharing it should be
+    used by one thread at a time.
 */
 
 ////////////////////////////////////////////////////////////////////////
@@ -75,6 +86,8 @@ extern Nm_Man_t *   Nm_ManCreate( int nSize );
 extern void         Nm_ManFree( Nm_Man_t * p );
 extern int          Nm_ManNumEntries( Nm_Man_t * p );
 extern char *       Nm_ManStoreIdName( Nm_Man_t * p, int ObjId, int Type, char * pName, char * pSuffix );
+extern int          Nm_ManStoreIdNameDummy( Nm_Man_t * p, int ObjId, int Type, char * pPrefix, int Num, int nDigits );
+extern int          Nm_ManCopyIdName( Nm_Man_t * p, int ObjId, int Type, Nm_Man_t * pOld, int ObjIdOld );
 extern void         Nm_ManDeleteIdName( Nm_Man_t * p, int ObjId );
 extern char *       Nm_ManCreateUniqueName( Nm_Man_t * p, int ObjId );
 extern char *       Nm_ManFindNameById( Nm_Man_t * p, int ObjId );
@@ -35,7 +35,7 @@ ABC_NAMESPACE_IMPL_START
 
   Synopsis    [Allocates the name manager.]
 
-  Description []
+  Description [The tables are sized for the given number of names.]
                
   SideEffects []
 
@@ -45,20 +45,12 @@ ABC_NAMESPACE_IMPL_START
 Nm_Man_t * Nm_ManCreate( int nSize )
 {
     Nm_Man_t * p;
-    // allocate the table
-    p = ABC_ALLOC( Nm_Man_t, 1 );
-    memset( p, 0, sizeof(Nm_Man_t) );
-    // set the parameters
-    p->nSizeFactor   = 2; // determined the limit on the grow of data before the table resizes
-    p->nGrowthFactor = 3; // determined how much the table grows after resizing
-    // allocate and clean the bins
-    p->nBins = Abc_PrimeCudd(nSize);
-    p->pBinsI2N = ABC_ALLOC( Nm_Entry_t *, p->nBins );
-    p->pBinsN2I = ABC_ALLOC( Nm_Entry_t *, p->nBins );
-    memset( p->pBinsI2N, 0, sizeof(Nm_Entry_t *) * p->nBins );
-    memset( p->pBinsN2I, 0, sizeof(Nm_Entry_t *) * p->nBins );
-    // start the memory manager
-    p->pMem = Extra_MmFlexStart();
+    p = ABC_CALLOC( Nm_Man_t, 1 );
+    p->pPool = Nm_PoolStart( nSize );
+    p->vLazy = Vec_IntAlloc( 0 );
+    // entry 0 is not used
+    p->nEntriesUsed = 1;
+    Nm_ManTableReserve( p, nSize );
     return p;
 }
 
@@ -75,7 +67,9 @@ Nm_Man_t * Nm_ManCreate( int nSize )
 ***********************************************************************/
 void Nm_ManFree( Nm_Man_t * p )
 {
-    Extra_MmFlexStop( p->pMem );
+    Nm_PoolDeref( p->pPool );
+    Vec_IntFree( p->vLazy );
+    ABC_FREE( p->pEntries );
     ABC_FREE( p->pBinsI2N );
     ABC_FREE( p->pBinsN2I );
     ABC_FREE( p );
@@ -111,27 +105,97 @@ int Nm_ManNumEntries( Nm_Man_t * p )
 ***********************************************************************/
 char * Nm_ManStoreIdName( Nm_Man_t * p, int ObjId, int Type, char * pName, char * pSuffix )
 {
-    Nm_Entry_t * pEntry;
-    int RetValue, nEntrySize;
+    int RetValue, Name;
     // check if the object with this ID is already stored
-    if ( (pEntry = Nm_ManTableLookupId(p, ObjId)) )
+    if ( Nm_ManTableLookupId(p, ObjId) )
     {
         printf( "Nm_ManStoreIdName(): Entry with the same ID already exists.\n" );
         return NULL;
     }
-    // create a new entry
-    nEntrySize = sizeof(Nm_Entry_t) + strlen(pName) + (pSuffix?strlen(pSuffix):0) + 1;
-//    nEntrySize = (nEntrySize / 4 + ((nEntrySize % 4) > 0)) * 4;
-    nEntrySize = (nEntrySize / sizeof(char*) + ((nEntrySize % sizeof(char*)) > 0)) * sizeof(char*); // added by Saurabh on Sep 3, 2009
-    pEntry = (Nm_Entry_t *)Extra_MmFlexEntryFetch( p->pMem, nEntrySize );
-    pEntry->pNextI2N = pEntry->pNextN2I = pEntry->pNameSake = NULL;
-    pEntry->ObjId = ObjId;
-    pEntry->Type = Type;
-    sprintf( pEntry->Name, "%s%s", pName, pSuffix? pSuffix : "" );
+    // find the name in the pool
+    Name = Nm_PoolFindOrAdd( p->pPool, pName, pSuffix );
+    // add the entry to the hash table
+    RetValue = Nm_ManTableAdd( p, ObjId, Type, Name );
+    assert( RetValue == 1 );
+    return Nm_PoolStr( p->pPool, Name );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a new entry with the dummy name.]
+
+  Description [The name is the prefix followed by the number printed 
+  with the given number of digits. The string of the name is created
+  only when it is requested. Returns 0 if the entry with the given 
+  object ID already exists in the name manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Nm_ManStoreIdNameDummy( Nm_Man_t * p, int ObjId, int Type, char * pPrefix, int Num, int nDigits )
+{
+    int RetValue, iDummy;
+    // check if the object with this ID is already stored
+    if ( Nm_ManTableLookupId(p, ObjId) )
+    {
+        printf( "Nm_ManStoreIdNameDummy(): Entry with the same ID already exists.\n" );
+        return 0;
+    }
+    iDummy = Nm_PoolAddDummy( p->pPool, pPrefix, Num, nDigits );
+    // add the entry to the hash table
+    RetValue = Nm_ManTableAdd( p, ObjId, Type, -iDummy-1 );
+    assert( RetValue == 1 );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the name of the object from another manager.]
+
+  Description [If the managers share the string pool, only the handle
+  of the name is copied (dummy names remain unmaterialized). An empty
+  manager starts sharing the pool of the manager it copies from, so 
+  the networks derived by duplication share the name strings. Because
+  the pool never shrinks, it is not shared if it holds many more names 
+  than the old manager uses; the strings are copied instead, and the 
+  old pool is freed with the last manager using it. Returns 
+  1 if the name is copied, 0 if the object has no name, and -1 if the 
+  entry with the given object ID already exists in the new manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Nm_ManCopyIdName( Nm_Man_t * p, int ObjId, int Type, Nm_Man_t * pOld, int ObjIdOld )
+{
+    Nm_Entry_t * pEntry;
+    int RetValue, Name;
+    if ( (pEntry = Nm_ManTableLookupId(pOld, ObjIdOld)) == NULL )
+        return 0;
+    // check if the object with this ID is already stored
+    if ( Nm_ManTableLookupId(p, ObjId) )
+    {
+        printf( "Nm_ManCopyIdName(): Entry with the same ID already exists.\n" );
+        return -1;
+    }
+    // share the pool if the manager is empty and the pool is not bloated
+    if ( p->pPool != pOld->pPool && p->nEntriesUsed == 1 && Nm_PoolSize(pOld->pPool) <= NM_POOL_SLACK * (pOld->nEntries + 1000) )
+    {
+        Nm_PoolDeref( p->pPool );
+        p->pPool = pOld->pPool;
+        Nm_PoolRef( p->pPool );
+    }
+    if ( p->pPool == pOld->pPool )
+        Name = pEntry->Name;
+    else
+        Name = Nm_PoolFindOrAdd( p->pPool, Nm_PoolStr(pOld->pPool, Nm_ManEntryName(pOld, pEntry)), NULL );
     // add the entry to the hash table
-    RetValue = Nm_ManTableAdd( p, pEntry );
+    RetValue = Nm_ManTableAdd( p, ObjId, Type, Name );
     assert( RetValue == 1 );
-    return pEntry->Name;
+    return 1;
 }
 
 /**Function*************************************************************
@@ -178,7 +242,7 @@ char * Nm_ManCreateUniqueName( Nm_Man_t * p, int ObjId )
     Nm_Entry_t * pEntry;
     int i;
     if ( (pEntry = Nm_ManTableLookupId(p, ObjId)) )
-        return pEntry->Name;
+        return Nm_PoolStr( p->pPool, Nm_ManEntryName(p, pEntry) );
     sprintf( NameStr, "n%d", ObjId );
     for ( i = 1; Nm_ManTableLookupName(p, NameStr, -1); i++ )
         sprintf( NameStr, "n%d_%d", ObjId, i );
@@ -200,7 +264,7 @@ char * Nm_ManFindNameById( Nm_Man_t * p, int ObjId )
 {
     Nm_Entry_t * pEntry;
     if ( (pEntry = Nm_ManTableLookupId(p, ObjId)) )
-        return pEntry->Name;
+        return Nm_PoolStr( p->pPool, Nm_ManEntryName(p, pEntry) );
     return NULL;
 }
 
@@ -263,9 +327,9 @@ Vec_Int_t * Nm_ManReturnNameIds( Nm_Man_t * p )
     Vec_Int_t * vNameIds;
     int i;
     vNameIds = Vec_IntAlloc( p->nEntries );
-    for ( i = 0; i < p->nBins; i++ )
-        if ( p->pBinsI2N[i] )
-            Vec_IntPush( vNameIds, p->pBinsI2N[i]->ObjId );
+    for ( i = 1; i < p->nEntriesUsed; i++ )
+        if ( p->pEntries[i].ObjId >= 0 )
+            Vec_IntPush( vNameIds, p->pEntries[i].ObjId );
     return vNameIds;
 }
 
@@ -34,6 +34,8 @@
 ///                         PARAMETERS                               ///
 ////////////////////////////////////////////////////////////////////////
 
+// a manager stops sharing the pool that holds more than this many names per live entry
+#define NM_POOL_SLACK  4
 
 
 ABC_NAMESPACE_HEADER_START
@@ -43,39 +45,67 @@ ABC_NAMESPACE_HEADER_START
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
 
+typedef struct Nm_Pool_t_ Nm_Pool_t;
+struct Nm_Pool_t_
+{
+    int              nRefs;         // the number of name managers sharing the pool
+    int *            pBins;         // mapping strings into handles
+    int              nBins;         // the number of bins (a power of 2)
+    Vec_Ptr_t *      vStrs;         // mapping handles into strings (handle 0 is not used)
+    Vec_Int_t *      vNexts;        // the next handle in the same bin
+    Vec_Int_t *      vDummies;      // dummy names (prefix handle, number, digits, name handle)
+    Extra_MmFlex_t * pMem;          // memory manager for the strings
+};
+
 typedef struct Nm_Entry_t_ Nm_Entry_t;
 struct Nm_Entry_t_
 {
-    unsigned         Type;          // object type
-    unsigned         ObjId;         // object ID
-    Nm_Entry_t *     pNextI2N;      // the next entry in the ID hash table
-    Nm_Entry_t *     pNextN2I;      // the next entry in the name hash table
-    Nm_Entry_t *     pNameSake;     // the next entry with the same name
-    char             Name[0];       // name of the object
+    int              ObjId;         // object ID (-1 if the entry is deleted)
+    int              Type;          // object type
+    int              Name;          // name handle (> 0) or dummy name (< 0)
+    int              NextI2N;       // the next entry in the ID hash table
+    int              NextN2I;       // the next entry in the name hash table
+    int              NameSake;      // the next entry with the same name
 };
 
 struct Nm_Man_t_
 {
-    Nm_Entry_t **    pBinsI2N;      // mapping IDs into names
-    Nm_Entry_t **    pBinsN2I;      // mapping names into IDs 
-    int              nBins;         // the number of bins in tables
-    int              nEntries;      // the number of entries
-    int              nSizeFactor;   // determined how much larger the table should be
-    int              nGrowthFactor; // determined how much the table grows after resizing
-    Extra_MmFlex_t * pMem;          // memory manager for entries (and names)
+    Nm_Pool_t *      pPool;         // string pool (may be shared with other managers)
+    Nm_Entry_t *     pEntries;      // entries (entry 0 is not used)
+    int              nEntriesAlloc; // the number of allocated entries
+    int              nEntriesUsed;  // the number of used entries
+    int *            pBinsI2N;      // mapping IDs into entries
+    int *            pBinsN2I;      // mapping name handles into entries
+    int              nBins;         // the number of bins in tables (a power of 2)
+    int              nEntries;      // the number of live entries
+    Vec_Int_t *      vLazy;         // entries with dummy names not yet added to the name table
 };
 
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
 
+static inline char *       Nm_PoolStr( Nm_Pool_t * p, int h )          { return (char *)Vec_PtrEntry( p->vStrs, h );   }
+static inline Nm_Entry_t * Nm_ManEntry( Nm_Man_t * p, int i )          { return i ? p->pEntries + i : NULL;            }
+
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
 /*=== nmTable.c ==========================================================*/
-extern int              Nm_ManTableAdd( Nm_Man_t * p, Nm_Entry_t * pEntry );
+extern Nm_Pool_t *      Nm_PoolStart( int nSize );
+extern void             Nm_PoolRef( Nm_Pool_t * p );
+extern void             Nm_PoolDeref( Nm_Pool_t * p );
+extern int              Nm_PoolFind( Nm_Pool_t * p, char * pName );
+extern int              Nm_PoolFindOrAdd( Nm_Pool_t * p, char * pName, char * pSuffix );
+extern int              Nm_PoolAddDummy( Nm_Pool_t * p, char * pPrefix, int Num, int nDigits );
+extern int              Nm_PoolSize( Nm_Pool_t * p );
+extern int              Nm_PoolDummyName( Nm_Pool_t * p, int iDummy );
+extern int              Nm_ManEntryName( Nm_Man_t * p, Nm_Entry_t * pEntry );
+extern void             Nm_ManTableReserve( Nm_Man_t * p, int nEntries );
+extern int              Nm_ManTableAdd( Nm_Man_t * p, int ObjId, int Type, int Name );
 extern int              Nm_ManTableDelete( Nm_Man_t * p, int ObjId );
+extern void             Nm_ManTableFlush( Nm_Man_t * p );
 extern Nm_Entry_t *     Nm_ManTableLookupId( Nm_Man_t * p, int ObjId );
 extern Nm_Entry_t *     Nm_ManTableLookupName( Nm_Man_t * p, char * pName, int Type );
 
@@ -28,30 +28,45 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 // hashing for integers
-static unsigned Nm_HashNumber( int Num, int TableSize ) 
+static inline unsigned Nm_HashNumber( int Num, int nBins ) 
 {
-    unsigned Key = 0;
-    Key ^= ( Num        & 0xFF) * 7937;
-    Key ^= ((Num >>  8) & 0xFF) * 2971;
-    Key ^= ((Num >> 16) & 0xFF) * 911;
-    Key ^= ((Num >> 24) & 0xFF) * 353;
-    return Key % TableSize;
+    unsigned Key = (unsigned)Num * 0x9E3779B1;
+    return (Key ^ (Key >> 16)) & (nBins - 1);
 }
 
-// hashing for strings
-static unsigned Nm_HashString( char * pName, int TableSize ) 
+// hashing for strings (the name is followed by the optional suffix)
+static inline unsigned Nm_HashString( char * pName, char * pSuffix, int nBins ) 
 {
-    static int s_Primes[10] = { 
-        1291, 1699, 2357, 4177, 5147, 
-        5647, 6343, 7103, 7873, 8147
-    };
-    unsigned i, Key = 0;
-    for ( i = 0; pName[i] != '\0'; i++ )
-        Key ^= s_Primes[i%10]*pName[i]*pName[i];
-    return Key % TableSize;
+    unsigned Key = 2166136261u;
+    for ( ; *pName; pName++ )
+        Key = (Key ^ (unsigned char)*pName) * 16777619u;
+    if ( pSuffix )
+        for ( ; *pSuffix; pSuffix++ )
+            Key = (Key ^ (unsigned char)*pSuffix) * 16777619u;
+    return (Key ^ (Key >> 15)) & (nBins - 1);
 }
 
-static void Nm_ManResize( Nm_Man_t * p );
+// comparing the stored string with the name followed by the suffix
+static inline int Nm_StringEqual( char * pStr, char * pName, char * pSuffix )
+{
+    for ( ; *pName; pName++, pStr++ )
+        if ( *pStr != *pName )
+            return 0;
+    if ( pSuffix )
+        for ( ; *pSuffix; pSuffix++, pStr++ )
+            if ( *pStr != *pSuffix )
+                return 0;
+    return *pStr == 0;
+}
+
+static inline int Nm_BinsNum( int nSize ) 
+{
+    int nBins;
+    for ( nBins = 64; nBins < nSize; nBins *= 2 );
+    return nBins;
+}
+
+static void Nm_ManResize( Nm_Man_t * p, int nBinsNew );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -59,7 +74,56 @@ static void Nm_ManResize( Nm_Man_t * p );
 
 /**Function*************************************************************
 
-  Synopsis    [Adds an entry to two hash tables.]
+  Synopsis    [Starts the string pool.]
+
+  Description [The pool interns the strings: each string is stored once
+  and is identified by a 32-bit handle. The strings never move in memory
+  and are not released until the pool is stopped. The pool is reference
+  counted, so that the name managers of the networks derived from each
+  other can share it and copy the handles instead of the strings.
+  The pool is not locked: the managers sharing it should be used by one
+  thread at a time, because even looking up a dummy name may add its 
+  string to the pool.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Nm_Pool_t * Nm_PoolStart( int nSize )
+{
+    Nm_Pool_t * p;
+    p = ABC_CALLOC( Nm_Pool_t, 1 );
+    p->nRefs    = 1;
+    p->nBins    = Nm_BinsNum( nSize );
+    p->pBins    = ABC_CALLOC( int, p->nBins );
+    p->vStrs    = Vec_PtrAlloc( nSize + 1 );
+    p->vNexts   = Vec_IntAlloc( nSize + 1 );
+    p->vDummies = Vec_IntAlloc( 0 );
+    p->pMem     = Extra_MmFlexStart();
+    Vec_PtrPush( p->vStrs, NULL );
+    Vec_IntPush( p->vNexts, 0 );
+    return p;
+}
+void Nm_PoolRef( Nm_Pool_t * p )
+{
+    p->nRefs++;
+}
+void Nm_PoolDeref( Nm_Pool_t * p )
+{
+    if ( --p->nRefs > 0 )
+        return;
+    Extra_MmFlexStop( p->pMem );
+    Vec_PtrFree( p->vStrs );
+    Vec_IntFree( p->vNexts );
+    Vec_IntFree( p->vDummies );
+    ABC_FREE( p->pBins );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resizes the hash table of the pool.]
 
   Description []
                
@@ -68,36 +132,255 @@ static void Nm_ManResize( Nm_Man_t * p );
   SeeAlso     []
 
 ***********************************************************************/
-int Nm_ManTableAdd( Nm_Man_t * p, Nm_Entry_t * pEntry )
+static void Nm_PoolResize( Nm_Pool_t * p )
 {
-    Nm_Entry_t ** ppSpot, * pOther;
-    // resize the tables if needed
-    if ( p->nEntries > p->nBins * p->nSizeFactor )
-        Nm_ManResize( p );
-    // add the entry to the table Id->Name
-    assert( Nm_ManTableLookupId(p, pEntry->ObjId) == NULL );
-    ppSpot = p->pBinsI2N + Nm_HashNumber(pEntry->ObjId, p->nBins);
-    pEntry->pNextI2N = *ppSpot;
-    *ppSpot = pEntry;
+    int h, Key;
+    ABC_FREE( p->pBins );
+    p->nBins *= 2;
+    p->pBins = ABC_CALLOC( int, p->nBins );
+    for ( h = 1; h < Vec_PtrSize(p->vStrs); h++ )
+    {
+        Key = Nm_HashString( Nm_PoolStr(p, h), NULL, p->nBins );
+        Vec_IntWriteEntry( p->vNexts, h, p->pBins[Key] );
+        p->pBins[Key] = h;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the handle of the string or 0 if it is not stored.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Nm_PoolFind( Nm_Pool_t * p, char * pName )
+{
+    int h;
+    for ( h = p->pBins[Nm_HashString(pName, NULL, p->nBins)]; h; h = Vec_IntEntry(p->vNexts, h) )
+        if ( !strcmp(Nm_PoolStr(p, h), pName) )
+            return h;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the handle of the string, which is added if needed.]
+
+  Description [The string is the name followed by the optional suffix.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Nm_PoolFindOrAdd( Nm_Pool_t * p, char * pName, char * pSuffix )
+{
+    char * pStr;
+    int h, Key, nName, nSuffix;
+    Key = Nm_HashString( pName, pSuffix, p->nBins );
+    for ( h = p->pBins[Key]; h; h = Vec_IntEntry(p->vNexts, h) )
+        if ( Nm_StringEqual(Nm_PoolStr(p, h), pName, pSuffix) )
+            return h;
+    nName   = strlen(pName);
+    nSuffix = pSuffix ? strlen(pSuffix) : 0;
+    pStr = Extra_MmFlexEntryFetch( p->pMem, nName + nSuffix + 1 );
+    memcpy( pStr, pName, nName );
+    if ( nSuffix )
+        memcpy( pStr + nName, pSuffix, nSuffix );
+    pStr[nName + nSuffix] = 0;
+    h = Vec_PtrSize( p->vStrs );
+    Vec_PtrPush( p->vStrs, pStr );
+    Vec_IntPush( p->vNexts, p->pBins[Key] );
+    p->pBins[Key] = h;
+    if ( h > 2 * p->nBins )
+        Nm_PoolResize( p );
+    return h;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the dummy name composed of the prefix and the number.]
+
+  Description [The string is created only when the name is requested.
+  Returns the number of the dummy name.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Nm_PoolAddDummy( Nm_Pool_t * p, char * pPrefix, int Num, int nDigits )
+{
+    assert( Num >= 0 && nDigits < 50 );
+    Vec_IntPush( p->vDummies, Nm_PoolFindOrAdd(p, pPrefix, NULL) );
+    Vec_IntPush( p->vDummies, Num );
+    Vec_IntPush( p->vDummies, nDigits );
+    Vec_IntPush( p->vDummies, 0 );
+    return Vec_IntSize(p->vDummies) / 4 - 1;
+}
+int Nm_PoolSize( Nm_Pool_t * p )
+{
+    return Vec_PtrSize(p->vStrs) + Vec_IntSize(p->vDummies) / 4;
+}
+int Nm_PoolDummyName( Nm_Pool_t * p, int iDummy )
+{
+    int * pDummy = Vec_IntEntryP( p->vDummies, 4 * iDummy );
+    if ( pDummy[3] == 0 )
+    {
+        char Buffer[100];
+        sprintf( Buffer, "%0*d", pDummy[2], pDummy[1] );
+        pDummy[3] = Nm_PoolFindOrAdd( p, Nm_PoolStr(p, pDummy[0]), Buffer );
+    }
+    return pDummy[3];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name handle of the entry.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Nm_ManEntryName( Nm_Man_t * p, Nm_Entry_t * pEntry )
+{
+    return pEntry->Name > 0 ? pEntry->Name : Nm_PoolDummyName( p->pPool, -pEntry->Name-1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes sure the tables can hold the given number of entries.]
+
+  Description [The hash tables are always allocated, even if no entries
+  are expected.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nm_ManTableReserve( Nm_Man_t * p, int nEntries )
+{
+    if ( p->nEntriesAlloc < nEntries + 1 )
+    {
+        p->nEntriesAlloc = nEntries + 1;
+        p->pEntries = ABC_REALLOC( Nm_Entry_t, p->pEntries, p->nEntriesAlloc );
+    }
+    if ( p->nBins == 0 || p->nBins < nEntries )
+        Nm_ManResize( p, Nm_BinsNum(nEntries) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the entry to the name hash table.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Nm_ManTableAddName( Nm_Man_t * p, int iEntry )
+{
+    Nm_Entry_t * pEntry = Nm_ManEntry( p, iEntry ), * pOther;
+    int * piSpot = p->pBinsN2I + Nm_HashNumber( pEntry->Name, p->nBins );
+    for ( pOther = Nm_ManEntry(p, *piSpot); pOther; pOther = Nm_ManEntry(p, pOther->NextN2I) )
+        if ( pOther->Name == pEntry->Name )
+            break;
     // check if an entry with the same name already exists
-    if ( (pOther = Nm_ManTableLookupName(p, pEntry->Name, -1)) )
+    if ( pOther )
     {
         // entry with the same name already exists - add it to the ring
-        pEntry->pNameSake = pOther->pNameSake? pOther->pNameSake : pOther;
-        pOther->pNameSake = pEntry;
+        pEntry->NameSake = pOther->NameSake? pOther->NameSake : pOther - p->pEntries;
+        pOther->NameSake = iEntry;
     }
     else
     {
         // entry with the same name does not exist - add it to the table
-        ppSpot = p->pBinsN2I + Nm_HashString(pEntry->Name, p->nBins);
-        pEntry->pNextN2I = *ppSpot;
-        *ppSpot = pEntry;
+        pEntry->NextN2I = *piSpot;
+        *piSpot = iEntry;
     }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds an entry to two hash tables.]
+
+  Description [The entries with dummy names are added to the name table
+  only when the name table is used.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Nm_ManTableAdd( Nm_Man_t * p, int ObjId, int Type, int Name )
+{
+    Nm_Entry_t * pEntry;
+    int iEntry, * piSpot;
+    assert( ObjId >= 0 && Name != 0 );
+    // keep the order of entries with the same name
+    if ( Name > 0 && Vec_IntSize(p->vLazy) )
+        Nm_ManTableFlush( p );
+    // resize the tables if needed
+    if ( p->nEntriesUsed == p->nEntriesAlloc )
+        Nm_ManTableReserve( p, 2 * p->nEntriesAlloc );
+    if ( p->nEntries > p->nBins )
+        Nm_ManResize( p, 2 * p->nBins );
+    // add the entry to the table Id->Name
+    assert( Nm_ManTableLookupId(p, ObjId) == NULL );
+    iEntry = p->nEntriesUsed++;
+    pEntry = Nm_ManEntry( p, iEntry );
+    pEntry->ObjId    = ObjId;
+    pEntry->Type     = Type;
+    pEntry->Name     = Name;
+    pEntry->NextN2I  = pEntry->NameSake = 0;
+    piSpot = p->pBinsI2N + Nm_HashNumber( ObjId, p->nBins );
+    pEntry->NextI2N  = *piSpot;
+    *piSpot = iEntry;
+    // add the entry to the table Name->Id
+    if ( Name < 0 )
+        Vec_IntPush( p->vLazy, iEntry );
+    else
+        Nm_ManTableAddName( p, iEntry );
     // report successfully added entry
     p->nEntries++;
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds the entries with dummy names to the name table.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nm_ManTableFlush( Nm_Man_t * p )
+{
+    Nm_Entry_t * pEntry;
+    int iEntry, i;
+    Vec_IntForEachEntry( p->vLazy, iEntry, i )
+    {
+        pEntry = Nm_ManEntry( p, iEntry );
+        assert( pEntry->ObjId >= 0 && pEntry->Name < 0 );
+        pEntry->Name = Nm_PoolDummyName( p->pPool, -pEntry->Name-1 );
+        Nm_ManTableAddName( p, iEntry );
+    }
+    Vec_IntClear( p->vLazy );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Deletes the entry from two hash tables.]
@@ -111,48 +394,49 @@ int Nm_ManTableAdd( Nm_Man_t * p, Nm_Entry_t * pEntry )
 ***********************************************************************/
 int Nm_ManTableDelete( Nm_Man_t * p, int ObjId )
 {
-    Nm_Entry_t ** ppSpot, * pEntry, * pPrev;
-    int fRemoved;
-    p->nEntries--;
+    Nm_Entry_t * pEntry, * pPrev;
+    int * piSpot, iEntry, fRemoved;
     // remove the entry from the table Id->Name
     assert( Nm_ManTableLookupId(p, ObjId) != NULL );
-    ppSpot = p->pBinsI2N + Nm_HashNumber(ObjId, p->nBins);
-    while ( (*ppSpot)->ObjId != (unsigned)ObjId )
-        ppSpot = &(*ppSpot)->pNextI2N;
-    pEntry = *ppSpot; 
-    *ppSpot = (*ppSpot)->pNextI2N;
+    piSpot = p->pBinsI2N + Nm_HashNumber( ObjId, p->nBins );
+    while ( Nm_ManEntry(p, *piSpot)->ObjId != ObjId )
+        piSpot = &Nm_ManEntry(p, *piSpot)->NextI2N;
+    iEntry = *piSpot;
+    pEntry = Nm_ManEntry( p, iEntry );
+    *piSpot = pEntry->NextI2N;
+    p->nEntries--;
+    // make sure the entry is in the table Name->Id
+    if ( pEntry->Name < 0 )
+        Nm_ManTableFlush( p );
+    pEntry->ObjId = -1;
     // remove the entry from the table Name->Id
-    ppSpot = p->pBinsN2I + Nm_HashString(pEntry->Name, p->nBins);
-    while ( *ppSpot && *ppSpot != pEntry )
-        ppSpot = &(*ppSpot)->pNextN2I;
+    piSpot = p->pBinsN2I + Nm_HashNumber( pEntry->Name, p->nBins );
+    while ( *piSpot && *piSpot != iEntry )
+        piSpot = &Nm_ManEntry(p, *piSpot)->NextN2I;
     // remember if we found this one in the list
-    fRemoved = (*ppSpot != NULL);
-    if ( *ppSpot )
-    {
-        assert( *ppSpot == pEntry );
-        *ppSpot = (*ppSpot)->pNextN2I;
-    }
+    fRemoved = (*piSpot != 0);
+    if ( *piSpot )
+        *piSpot = pEntry->NextN2I;
     // quit if this entry has no namesakes
-    if ( pEntry->pNameSake == NULL )
+    if ( pEntry->NameSake == 0 )
     {
         assert( fRemoved );
         return 1;
     }
     // remove entry from the ring of namesakes
-    assert( pEntry->pNameSake != pEntry );
-    for ( pPrev = pEntry; pPrev->pNameSake != pEntry; pPrev = pPrev->pNameSake );
-    assert( !strcmp(pPrev->Name, pEntry->Name) );
-    assert( pPrev->pNameSake == pEntry );
-    if ( pEntry->pNameSake == pPrev ) // two entries in the ring
-        pPrev->pNameSake = NULL;
+    assert( pEntry->NameSake != iEntry );
+    for ( pPrev = pEntry; pPrev->NameSake != iEntry; pPrev = Nm_ManEntry(p, pPrev->NameSake) );
+    assert( pPrev->Name == pEntry->Name );
+    if ( pEntry->NameSake == pPrev - p->pEntries ) // two entries in the ring
+        pPrev->NameSake = 0;
     else
-        pPrev->pNameSake = pEntry->pNameSake;
+        pPrev->NameSake = pEntry->NameSake;
     // reinsert the ring back if we removed its connection with the list in the table
     if ( fRemoved )
     {
-        assert( pPrev->pNextN2I == NULL );
-        pPrev->pNextN2I = *ppSpot;
-        *ppSpot = pPrev;
+        assert( pPrev->NextN2I == 0 );
+        pPrev->NextN2I = *piSpot;
+        *piSpot = pPrev - p->pEntries;
     }
     return 1;
 }
@@ -171,8 +455,8 @@ int Nm_ManTableDelete( Nm_Man_t * p, int ObjId )
 Nm_Entry_t * Nm_ManTableLookupId( Nm_Man_t * p, int ObjId )
 {
     Nm_Entry_t * pEntry;
-    for ( pEntry = p->pBinsI2N[ Nm_HashNumber(ObjId, p->nBins) ]; pEntry; pEntry = pEntry->pNextI2N )
-        if ( pEntry->ObjId == (unsigned)ObjId )
+    for ( pEntry = Nm_ManEntry(p, p->pBinsI2N[Nm_HashNumber(ObjId, p->nBins)]); pEntry; pEntry = Nm_ManEntry(p, pEntry->NextI2N) )
+        if ( pEntry->ObjId == ObjId )
             return pEntry;
     return NULL;
 }
@@ -191,18 +475,23 @@ Nm_Entry_t * Nm_ManTableLookupId( Nm_Man_t * p, int ObjId )
 Nm_Entry_t * Nm_ManTableLookupName( Nm_Man_t * p, char * pName, int Type )
 {
     Nm_Entry_t * pEntry, * pTemp;
-    for ( pEntry = p->pBinsN2I[ Nm_HashString(pName, p->nBins) ]; pEntry; pEntry = pEntry->pNextN2I )
+    int Name;
+    if ( Vec_IntSize(p->vLazy) )
+        Nm_ManTableFlush( p );
+    if ( (Name = Nm_PoolFind(p->pPool, pName)) == 0 )
+        return NULL;
+    for ( pEntry = Nm_ManEntry(p, p->pBinsN2I[Nm_HashNumber(Name, p->nBins)]); pEntry; pEntry = Nm_ManEntry(p, pEntry->NextN2I) )
     {
+        if ( pEntry->Name != Name )
+            continue;
         // check the entry itself
-        if ( !strcmp(pEntry->Name, pName) && (Type == -1 || pEntry->Type == (unsigned)Type) )
+        if ( Type == -1 || pEntry->Type == Type )
             return pEntry;
-        // if there is no namesakes, continue
-        if ( pEntry->pNameSake == NULL )
-            continue;
         // check the list of namesakes
-        for ( pTemp = pEntry->pNameSake; pTemp != pEntry; pTemp = pTemp->pNameSake )
-            if ( !strcmp(pTemp->Name, pName) && (Type == -1 || pTemp->Type == (unsigned)Type) )
+        for ( pTemp = Nm_ManEntry(p, pEntry->NameSake); pTemp && pTemp != pEntry; pTemp = Nm_ManEntry(p, pTemp->NameSake) )
+            if ( pTemp->Type == Type )
                 return pTemp;
+        return NULL;
     }
     return NULL;
 }
@@ -226,7 +515,7 @@ void Nm_ManProfile( Nm_Man_t * p )
     for ( e = 0; e < p->nBins; e++ )
     {
         Counter = 0;
-        for ( pEntry = p->pBinsI2N[e]; pEntry; pEntry = pEntry->pNextI2N )
+        for ( pEntry = Nm_ManEntry(p, p->pBinsI2N[e]); pEntry; pEntry = Nm_ManEntry(p, pEntry->NextI2N) )
             Counter++;
         printf( "%d ", Counter );
     }
@@ -235,7 +524,7 @@ void Nm_ManProfile( Nm_Man_t * p )
     for ( e = 0; e < p->nBins; e++ )
     {
         Counter = 0;
-        for ( pEntry = p->pBinsN2I[e]; pEntry; pEntry = pEntry->pNextN2I )
+        for ( pEntry = Nm_ManEntry(p, p->pBinsN2I[e]); pEntry; pEntry = Nm_ManEntry(p, pEntry->NextN2I) )
             Counter++;
         printf( "%d ", Counter );
     }
@@ -253,43 +542,38 @@ void Nm_ManProfile( Nm_Man_t * p )
   SeeAlso     []
 
 ***********************************************************************/
-void Nm_ManResize( Nm_Man_t * p )
+void Nm_ManResize( Nm_Man_t * p, int nBinsNew )
 {
-    Nm_Entry_t ** pBinsNewI2N, ** pBinsNewN2I, * pEntry, * pEntry2, ** ppSpot;
-    int nBinsNew, Counter, e;
-    abctime clk;
-
-clk = Abc_Clock();
-    // get the new table size
-    nBinsNew = Abc_PrimeCudd( p->nGrowthFactor * p->nBins ); 
+    int * pBinsNewI2N, * pBinsNewN2I, * piSpot;
+    Nm_Entry_t * pEntry;
+    int iEntry, iNext, Counter, e;
+    assert( (nBinsNew & (nBinsNew - 1)) == 0 );
     // allocate a new array
-    pBinsNewI2N = ABC_ALLOC( Nm_Entry_t *, nBinsNew );
-    pBinsNewN2I = ABC_ALLOC( Nm_Entry_t *, nBinsNew );
-    memset( pBinsNewI2N, 0, sizeof(Nm_Entry_t *) * nBinsNew );
-    memset( pBinsNewN2I, 0, sizeof(Nm_Entry_t *) * nBinsNew );
+    pBinsNewI2N = ABC_CALLOC( int, nBinsNew );
+    pBinsNewN2I = ABC_CALLOC( int, nBinsNew );
     // rehash entries in Id->Name table
     Counter = 0;
     for ( e = 0; e < p->nBins; e++ )
-        for ( pEntry = p->pBinsI2N[e], pEntry2 = pEntry? pEntry->pNextI2N : NULL; 
-              pEntry; pEntry = pEntry2, pEntry2 = pEntry? pEntry->pNextI2N : NULL )
-            {
-                ppSpot = pBinsNewI2N + Nm_HashNumber(pEntry->ObjId, nBinsNew);
-                pEntry->pNextI2N = *ppSpot;
-                *ppSpot = pEntry;
-                Counter++;
-            }
+        for ( iEntry = p->pBinsI2N[e]; iEntry; iEntry = iNext )
+        {
+            pEntry = Nm_ManEntry( p, iEntry );
+            iNext = pEntry->NextI2N;
+            piSpot = pBinsNewI2N + Nm_HashNumber( pEntry->ObjId, nBinsNew );
+            pEntry->NextI2N = *piSpot;
+            *piSpot = iEntry;
+            Counter++;
+        }
     // rehash entries in Name->Id table
     for ( e = 0; e < p->nBins; e++ )
-        for ( pEntry = p->pBinsN2I[e], pEntry2 = pEntry? pEntry->pNextN2I : NULL; 
-              pEntry; pEntry = pEntry2, pEntry2 = pEntry? pEntry->pNextN2I : NULL )
-            {
-                ppSpot = pBinsNewN2I + Nm_HashString(pEntry->Name, nBinsNew);
-                pEntry->pNextN2I = *ppSpot;
-                *ppSpot = pEntry;
-            }
+        for ( iEntry = p->pBinsN2I[e]; iEntry; iEntry = iNext )
+        {
+            pEntry = Nm_ManEntry( p, iEntry );
+            iNext = pEntry->NextN2I;
+            piSpot = pBinsNewN2I + Nm_HashNumber( pEntry->Name, nBinsNew );
+            pEntry->NextN2I = *piSpot;
+            *piSpot = iEntry;
+        }
     assert( Counter == p->nEntries );
-//    printf( "Increasing the structural table size from %6d to %6d. ", p->nBins, nBinsNew );
-//    ABC_PRT( "Time", Abc_Clock() - clk );
     // replace the table and the parameters
     ABC_FREE( p->pBinsI2N );
     ABC_FREE( p->pBinsN2I );
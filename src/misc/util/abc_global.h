@@ -69,6 +69,17 @@
 #endif
 #endif
 
+// thread-local storage class (used for the per-thread state, such as the current frame)
+#if !defined(ABC_THREAD_LOCAL)
+#if defined(_MSC_VER)
+#define ABC_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define ABC_THREAD_LOCAL __thread
+#else
+#define ABC_THREAD_LOCAL
+#endif
+#endif
+
 /*
 #ifdef __cplusplus
 #error "C++ code"
@@ -0,0 +1,565 @@
+/**CFile****************************************************************
+
+  FileName    [utilProf.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Lightweight hierarchical profiler.]
+
+  Synopsis    [Scoped phases, counters, and their export.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilProf.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "abc_global.h"
+#include "misc/vec/vec.h"
+#include "utilProf.h"
+
+#ifndef _WIN32
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The profiler records phases (named time intervals, which may be nested)
+// and counters (named 64-bit sums). The command dispatcher opens a phase
+// for each command, while the engines may open their own phases inside and
+// update the counters. When the profiler is off, each call returns after
+// checking one static pointer. Phases are recorded only for the thread that
+// started the profiler, so the calls made by the worker threads (such as
+// those of dc2 -P) are ignored. Counters are updated from any thread without
+// locking and are kept in a fixed array indexed by Abc_ProfCounter_t.
+
+typedef struct Abc_ProfPhase_t_ Abc_ProfPhase_t;
+struct Abc_ProfPhase_t_
+{
+    char *           pName;          // the phase name
+    char *           pNote;          // additional info (such as the command line)
+    int              iParent;        // the enclosing phase (or -1)
+    int              Level;          // the nesting level
+    int              iSample;        // the counter snapshot taken at the end (or -1)
+    ABC_INT64_T      WallBeg;        // wall time at the start (microseconds)
+    ABC_INT64_T      WallEnd;        // wall time at the end (or -1 if still open)
+    abctime          CpuBeg;         // CPU time at the start
+    abctime          CpuEnd;         // CPU time at the end
+    ABC_INT64_T      RssBeg;         // peak resident set size at the start (KB)
+    ABC_INT64_T      RssEnd;         // peak resident set size at the end (KB)
+};
+
+typedef struct Abc_Prof_t_ Abc_Prof_t;
+struct Abc_Prof_t_
+{
+    int              fOn;            // recording is enabled
+    ABC_INT64_T      WallStart;      // the time when the profiler was started
+    Vec_Ptr_t *      vPhases;        // recorded phases
+    Vec_Int_t *      vStack;         // phases currently open
+    Vec_Wrd_t *      vSamples;       // counter snapshots (the number of counters followed by the values)
+#ifdef ABC_USE_PTHREADS
+    pthread_t        Owner;          // the thread recording the phases
+#endif
+};
+
+static Abc_Prof_t *  s_pProf = NULL;
+static ABC_INT64_T   s_ProfCounts[ABC_PROF_COUNTER_NUM];
+static const char *  s_ProfCountNames[ABC_PROF_COUNTER_NUM] = {
+    "sat_calls", "sat_conflicts", "cec_sim_rounds", "dar_nodes_tried", "dar_cut_pairs", "dar_cut_time_us"
+};
+
+#ifdef ABC_USE_PTHREADS
+static inline int Abc_ProfIsOwner() { return pthread_equal( s_pProf->Owner, pthread_self() ); }
+#else
+static inline int Abc_ProfIsOwner() { return 1; }
+#endif
+
+static inline Abc_ProfPhase_t * Abc_ProfPhase( int i ) { return (Abc_ProfPhase_t *)Vec_PtrEntry( s_pProf->vPhases, i ); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns wall time in microseconds.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static ABC_INT64_T Abc_ProfWallTime()
+{
+#ifndef _WIN32
+    struct timeval tv;
+    gettimeofday( &tv, NULL );
+    return (ABC_INT64_T)tv.tv_sec * 1000000 + tv.tv_usec;
+#else
+    return (ABC_INT64_T)clock() * 1000000 / CLOCKS_PER_SEC;
+#endif
+}
+static inline ABC_INT64_T Abc_ProfClock2Us( abctime Clk )
+{
+    return (ABC_INT64_T)((double)Clk * 1000000 / CLOCKS_PER_SEC);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the peak resident set size of the process in KB.]
+
+  Description [Returns 0 if this information is not available.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+ABC_INT64_T Abc_ProfPeakRss()
+{
+#ifndef _WIN32
+    struct rusage Usage;
+    if ( getrusage( RUSAGE_SELF, &Usage ) )
+        return 0;
+#if defined(__APPLE__) && defined(__MACH__)
+    return (ABC_INT64_T)Usage.ru_maxrss / 1024;
+#else
+    return (ABC_INT64_T)Usage.ru_maxrss;
+#endif
+#else
+    return 0;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts, stops, and clears the profiler.]
+
+  Description [Stopping disables recording but keeps the data, which can
+  still be printed or written into a file. The profiler should be started,
+  cleared, printed and written by the same thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_ProfStart()
+{
+    if ( s_pProf == NULL )
+    {
+        s_pProf = ABC_CALLOC( Abc_Prof_t, 1 );
+        s_pProf->WallStart   = Abc_ProfWallTime();
+        s_pProf->vPhases     = Vec_PtrAlloc( 100 );
+        s_pProf->vStack      = Vec_IntAlloc( 10 );
+        s_pProf->vSamples    = Vec_WrdAlloc( 100 );
+        memset( s_ProfCounts, 0, sizeof(s_ProfCounts) );
+    }
+#ifdef ABC_USE_PTHREADS
+    s_pProf->Owner = pthread_self();
+#endif
+    s_pProf->fOn = 1;
+}
+void Abc_ProfStop()
+{
+    if ( s_pProf )
+        s_pProf->fOn = 0;
+}
+int Abc_ProfIsOn()
+{
+    return s_pProf != NULL && s_pProf->fOn;
+}
+void Abc_ProfClear()
+{
+    Abc_ProfPhase_t * pPhase;
+    int i, fOn;
+    if ( s_pProf == NULL )
+        return;
+    fOn = s_pProf->fOn;
+    Vec_PtrForEachEntry( Abc_ProfPhase_t *, s_pProf->vPhases, pPhase, i )
+    {
+        ABC_FREE( pPhase->pName );
+        ABC_FREE( pPhase->pNote );
+        ABC_FREE( pPhase );
+    }
+    Vec_PtrFree( s_pProf->vPhases );
+    Vec_IntFree( s_pProf->vStack );
+    Vec_WrdFree( s_pProf->vSamples );
+    ABC_FREE( s_pProf );
+    if ( fOn )
+        Abc_ProfStart();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Opens a new phase nested in the current one.]
+
+  Description [Returns the phase handle to be passed to Abc_ProfPop(),
+  or -1 if the profiler is off or if called by another thread.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_ProfPush( const char * pName, const char * pNote )
+{
+    Abc_ProfPhase_t * pPhase;
+    int iPhase;
+    if ( s_pProf == NULL || !s_pProf->fOn || !Abc_ProfIsOwner() )
+        return -1;
+    pPhase = ABC_CALLOC( Abc_ProfPhase_t, 1 );
+    pPhase->pName   = Abc_UtilStrsav( (char *)pName );
+    pPhase->pNote   = Abc_UtilStrsav( (char *)pNote );
+    pPhase->iParent = Vec_IntSize(s_pProf->vStack) ? Vec_IntEntryLast(s_pProf->vStack) : -1;
+    pPhase->Level   = Vec_IntSize(s_pProf->vStack);
+    pPhase->iSample = -1;
+    pPhase->WallBeg = Abc_ProfWallTime() - s_pProf->WallStart;
+    pPhase->WallEnd = -1;
+    pPhase->CpuBeg  = Abc_Clock();
+    pPhase->RssBeg  = Abc_ProfPeakRss();
+    iPhase = Vec_PtrSize( s_pProf->vPhases );
+    Vec_PtrPush( s_pProf->vPhases, pPhase );
+    Vec_IntPush( s_pProf->vStack, iPhase );
+    return iPhase;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Closes the phase together with the phases left open inside.]
+
+  Description [Does nothing if the phase was already closed or cleared.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_ProfPop( int iPhase )
+{
+    Abc_ProfPhase_t * pPhase;
+    int i, Entry;
+    if ( iPhase < 0 || s_pProf == NULL || !Abc_ProfIsOwner() )
+        return;
+    if ( Vec_IntFind(s_pProf->vStack, iPhase) == -1 )
+        return;
+    while ( Vec_IntSize(s_pProf->vStack) > 0 )
+    {
+        Entry  = Vec_IntPop( s_pProf->vStack );
+        pPhase = Abc_ProfPhase( Entry );
+        pPhase->WallEnd = Abc_ProfWallTime() - s_pProf->WallStart;
+        pPhase->CpuEnd  = Abc_Clock();
+        pPhase->RssEnd  = Abc_ProfPeakRss();
+        // save the counters at the end of the phase
+        pPhase->iSample = Vec_WrdSize( s_pProf->vSamples );
+        Vec_WrdPush( s_pProf->vSamples, ABC_PROF_COUNTER_NUM );
+        for ( i = 0; i < ABC_PROF_COUNTER_NUM; i++ )
+            Vec_WrdPush( s_pProf->vSamples, (word)s_ProfCounts[i] );
+        if ( Entry == iPhase )
+            break;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the value to the counter.]
+
+  Description [Can be called by any thread. The addition is atomic when
+  compiled with GCC or Clang; otherwise, concurrent updates may be lost.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_ProfCount( Abc_ProfCounter_t Counter, ABC_INT64_T Value )
+{
+    if ( s_pProf == NULL || !s_pProf->fOn )
+        return;
+    assert( Counter >= 0 && Counter < ABC_PROF_COUNTER_NUM );
+#if defined(__GNUC__)
+    __sync_fetch_and_add( s_ProfCounts + Counter, Value );
+#else
+    s_ProfCounts[Counter] += Value;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the duration of the phase.]
+
+  Description [The phases still open are measured up to now.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline ABC_INT64_T Abc_ProfPhaseWall( Abc_ProfPhase_t * pPhase )
+{
+    ABC_INT64_T WallEnd = pPhase->WallEnd >= 0 ? pPhase->WallEnd : Abc_ProfWallTime() - s_pProf->WallStart;
+    return WallEnd - pPhase->WallBeg;
+}
+static inline ABC_INT64_T Abc_ProfPhaseCpu( Abc_ProfPhase_t * pPhase )
+{
+    return Abc_ProfClock2Us( (pPhase->WallEnd >= 0 ? pPhase->CpuEnd : Abc_Clock()) - pPhase->CpuBeg );
+}
+static inline ABC_INT64_T Abc_ProfPhaseRss( Abc_ProfPhase_t * pPhase )
+{
+    return pPhase->WallEnd >= 0 ? pPhase->RssEnd : Abc_ProfPeakRss();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the summary of the phases grouped by their paths.]
+
+  Description [The path of a phase is the list of names of the enclosing
+  phases. The paths are printed in the alphabetic order, so that nested
+  phases follow their parents.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_ProfComparePaths( char ** pp1, char ** pp2 )
+{
+    return strcmp( *pp1, *pp2 );
+}
+void Abc_ProfPrint( FILE * pFile )
+{
+    Abc_ProfPhase_t * pPhase;
+    Vec_Ptr_t * vPaths, * vUnique;
+    Vec_Int_t * vCalls, * vLevels;
+    Vec_Wrd_t * vWall, * vCpu, * vRss, * vGrowth;
+    char * pPath, * pParent;
+    int i, k;
+    if ( s_pProf == NULL || Vec_PtrSize(s_pProf->vPhases) == 0 )
+    {
+        fprintf( pFile, "The profiler has no data.\n" );
+        return;
+    }
+    // derive the path of each phase
+    vPaths = Vec_PtrAlloc( Vec_PtrSize(s_pProf->vPhases) );
+    Vec_PtrForEachEntry( Abc_ProfPhase_t *, s_pProf->vPhases, pPhase, i )
+    {
+        if ( pPhase->iParent == -1 )
+            pPath = Abc_UtilStrsav( pPhase->pName );
+        else
+        {
+            pParent = (char *)Vec_PtrEntry( vPaths, pPhase->iParent );
+            pPath = ABC_ALLOC( char, strlen(pParent) + strlen(pPhase->pName) + 2 );
+            sprintf( pPath, "%s/%s", pParent, pPhase->pName );
+        }
+        Vec_PtrPush( vPaths, pPath );
+    }
+    // collect unique paths
+    vUnique = Vec_PtrDup( vPaths );
+    qsort( (void *)Vec_PtrArray(vUnique), (size_t)Vec_PtrSize(vUnique), sizeof(char *),
+        (int (*)(const void *, const void *)) Abc_ProfComparePaths );
+    k = 0;
+    Vec_PtrForEachEntry( char *, vUnique, pPath, i )
+        if ( k == 0 || strcmp((char *)Vec_PtrEntry(vUnique, k-1), pPath) )
+            Vec_PtrWriteEntry( vUnique, k++, pPath );
+    Vec_PtrShrink( vUnique, k );
+    // accumulate the data
+    vCalls  = Vec_IntStart( k );
+    vLevels = Vec_IntStart( k );
+    vWall   = Vec_WrdStart( k );
+    vCpu    = Vec_WrdStart( k );
+    vRss    = Vec_WrdStart( k );
+    vGrowth = Vec_WrdStart( k );
+    Vec_PtrForEachEntry( Abc_ProfPhase_t *, s_pProf->vPhases, pPhase, i )
+    {
+        char ** ppPath = (char **)bsearch( (void *)Vec_PtrEntryP(vPaths, i), (void *)Vec_PtrArray(vUnique), (size_t)Vec_PtrSize(vUnique),
+            sizeof(char *), (int (*)(const void *, const void *)) Abc_ProfComparePaths );
+        k = ppPath - (char **)Vec_PtrArray(vUnique);
+        Vec_IntAddToEntry( vCalls, k, 1 );
+        Vec_IntWriteEntry( vLevels, k, pPhase->Level );
+        Vec_WrdAddToEntry( vWall, k, Abc_ProfPhaseWall(pPhase) );
+        Vec_WrdAddToEntry( vCpu, k, Abc_ProfPhaseCpu(pPhase) );
+        Vec_WrdWriteEntry( vRss, k, Abc_MaxWord(Vec_WrdEntry(vRss, k), Abc_ProfPhaseRss(pPhase)) );
+        Vec_WrdAddToEntry( vGrowth, k, Abc_ProfPhaseRss(pPhase) - pPhase->RssBeg );
+    }
+    // print the table
+    fprintf( pFile, "%-40s %8s %12s %12s %12s %12s\n", "Phase", "Calls", "Wall, sec", "CPU, sec", "PeakRSS, MB", "Growth, MB" );
+    Vec_PtrForEachEntry( char *, vUnique, pPath, i )
+    {
+        char * pName = strrchr( pPath, '/' ) ? strrchr( pPath, '/' ) + 1 : pPath;
+        int nSpaces = 2 * Vec_IntEntry(vLevels, i);
+        fprintf( pFile, "%*s%-*s %8d %12.2f %12.2f %12.2f %12.2f\n", nSpaces, "", Abc_MaxInt(1, 40 - nSpaces), pName,
+            Vec_IntEntry(vCalls, i), 1.0e-6 * Vec_WrdEntry(vWall, i), 1.0e-6 * Vec_WrdEntry(vCpu, i),
+            Vec_WrdEntry(vRss, i) / 1024.0, Vec_WrdEntry(vGrowth, i) / 1024.0 );
+    }
+    for ( i = 0; i < ABC_PROF_COUNTER_NUM; i++ )
+        if ( s_ProfCounts[i] )
+            fprintf( pFile, "Counter %-32s %20.0f\n", s_ProfCountNames[i], (double)s_ProfCounts[i] );
+    Vec_PtrFree( vUnique );
+    Vec_PtrFreeFree( vPaths );
+    Vec_IntFree( vCalls );
+    Vec_IntFree( vLevels );
+    Vec_WrdFree( vWall );
+    Vec_WrdFree( vCpu );
+    Vec_WrdFree( vRss );
+    Vec_WrdFree( vGrowth );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the string as a JSON string literal.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_ProfWriteString( FILE * pFile, char * pStr )
+{
+    fputc( '\"', pFile );
+    for ( ; pStr && *pStr; pStr++ )
+    {
+        if ( *pStr == '\"' || *pStr == '\\' )
+            fprintf( pFile, "\\%c", *pStr );
+        else if ( (unsigned char)*pStr < 0x20 )
+            fprintf( pFile, "\\u%04x", (unsigned char)*pStr );
+        else
+            fputc( *pStr, pFile );
+    }
+    fputc( '\"', pFile );
+}
+static void Abc_ProfWriteCounters( FILE * pFile, int iSample, ABC_INT64_T Rss )
+{
+    int i, nCounts = iSample >= 0 ? (int)Vec_WrdEntry(s_pProf->vSamples, iSample) : 0;
+    fprintf( pFile, "{" );
+    for ( i = 0; i < nCounts; i++ )
+    {
+        Abc_ProfWriteString( pFile, (char *)s_ProfCountNames[i] );
+        fprintf( pFile, ": %.0f, ", (double)Vec_WrdEntry(s_pProf->vSamples, iSample + 1 + i) );
+    }
+    fprintf( pFile, "\"peak_rss_kb\": %.0f}", (double)Rss );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the phases and the counters in JSON.]
+
+  Description [Times are in microseconds, memory is in KB.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_ProfDumpJson( char * pFileName )
+{
+    Abc_ProfPhase_t * pPhase;
+    FILE * pFile;
+    int i, nCounts = 0;
+    if ( s_pProf == NULL )
+        return 0;
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+        return 0;
+    fprintf( pFile, "{\n  \"phases\": [\n" );
+    Vec_PtrForEachEntry( Abc_ProfPhase_t *, s_pProf->vPhases, pPhase, i )
+    {
+        fprintf( pFile, "    {\"id\": %d, \"name\": ", i );
+        Abc_ProfWriteString( pFile, pPhase->pName );
+        fprintf( pFile, ", \"note\": " );
+        Abc_ProfWriteString( pFile, pPhase->pNote );
+        fprintf( pFile, ", \"parent\": %d, \"level\": %d, \"start_us\": %.0f, \"wall_us\": %.0f, \"cpu_us\": %.0f, \"peak_rss_kb_start\": %.0f, \"peak_rss_kb\": %.0f}%s\n",
+            pPhase->iParent, pPhase->Level, (double)pPhase->WallBeg, (double)Abc_ProfPhaseWall(pPhase), (double)Abc_ProfPhaseCpu(pPhase),
+            (double)pPhase->RssBeg, (double)Abc_ProfPhaseRss(pPhase), i < Vec_PtrSize(s_pProf->vPhases) - 1 ? "," : "" );
+    }
+    fprintf( pFile, "  ],\n  \"counters\": {" );
+    for ( i = 0; i < ABC_PROF_COUNTER_NUM; i++ )
+    {
+        if ( s_ProfCounts[i] == 0 )
+            continue;
+        fprintf( pFile, "%s\n    ", nCounts++ ? "," : "" );
+        Abc_ProfWriteString( pFile, (char *)s_ProfCountNames[i] );
+        fprintf( pFile, ": %.0f", (double)s_ProfCounts[i] );
+    }
+    fprintf( pFile, "\n  }\n}\n" );
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the phases in Chrome trace event format.]
+
+  Description [The file can be loaded into chrome://tracing or Perfetto.
+  Each phase becomes a complete event; the counters and the peak memory
+  at the end of each phase become counter events.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_ProfDumpTrace( char * pFileName )
+{
+    Abc_ProfPhase_t * pPhase;
+    FILE * pFile;
+    int i;
+    if ( s_pProf == NULL )
+        return 0;
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+        return 0;
+    fprintf( pFile, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n" );
+    fprintf( pFile, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 1, \"args\": {\"name\": \"abc\"}}" );
+    Vec_PtrForEachEntry( Abc_ProfPhase_t *, s_pProf->vPhases, pPhase, i )
+    {
+        fprintf( pFile, ",\n{\"name\": " );
+        Abc_ProfWriteString( pFile, pPhase->pName );
+        fprintf( pFile, ", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": %.0f, \"dur\": %.0f, \"args\": {\"note\": ",
+            pPhase->Level ? "phase" : "command", (double)pPhase->WallBeg, (double)Abc_ProfPhaseWall(pPhase) );
+        Abc_ProfWriteString( pFile, pPhase->pNote );
+        fprintf( pFile, ", \"cpu_us\": %.0f, \"peak_rss_kb\": %.0f}}", (double)Abc_ProfPhaseCpu(pPhase), (double)Abc_ProfPhaseRss(pPhase) );
+        if ( pPhase->WallEnd < 0 )
+            continue;
+        fprintf( pFile, ",\n{\"name\": \"counters\", \"ph\": \"C\", \"pid\": 1, \"tid\": 1, \"ts\": %.0f, \"args\": ", (double)pPhase->WallEnd );
+        Abc_ProfWriteCounters( pFile, pPhase->iSample, pPhase->RssEnd );
+        fprintf( pFile, "}" );
+    }
+    fprintf( pFile, "\n]}\n" );
+    fclose( pFile );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,80 @@
+/**CFile****************************************************************
+
+  FileName    [utilProf.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Lightweight hierarchical profiler.]
+
+  Synopsis    [External declarations.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: utilProf.h,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilProf_h
+#define ABC__misc__util__utilProf_h
+
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+// counters recorded by the profiler (the names are in utilProf.c)
+typedef enum { 
+    ABC_PROF_SAT_CALLS = 0,          // SAT solver calls
+    ABC_PROF_SAT_CONFLICTS,          // SAT solver conflicts
+    ABC_PROF_CEC_SIM_ROUNDS,         // simulation rounds in CEC
+    ABC_PROF_DAR_NODES_TRIED,        // nodes tried by rewriting
+    ABC_PROF_DAR_CUT_PAIRS,          // cuts computed by rewriting
+    ABC_PROF_DAR_CUT_TIME_US,        // cut computation time in rewriting
+    ABC_PROF_COUNTER_NUM             // the number of counters
+} Abc_ProfCounter_t;
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilProf.c ==========================================================*/
+extern void            Abc_ProfStart();
+extern void            Abc_ProfStop();
+extern void            Abc_ProfClear();
+extern int             Abc_ProfIsOn();
+extern int             Abc_ProfPush( const char * pName, const char * pNote );
+extern void            Abc_ProfPop( int iPhase );
+extern void            Abc_ProfCount( Abc_ProfCounter_t Counter, ABC_INT64_T Value );
+extern void            Abc_ProfPrint( FILE * pFile );
+extern int             Abc_ProfDumpJson( char * pFileName );
+extern int             Abc_ProfDumpTrace( char * pFileName );
+extern ABC_INT64_T     Abc_ProfPeakRss();
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
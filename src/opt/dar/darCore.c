@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "darInt.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -86,8 +87,7 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     abctime clk = 0, clkStart;
     int Counter = 0;
     int nMffcSize;//, nMffcGains[MAX_VAL+1][MAX_VAL+1] = {{0}};
-    // prepare the library
-    Dar_LibPrepare( pPars->nSubgMax ); 
+    int iPhase = Abc_ProfPush( "dar_rewrite", NULL );
     // create rewriting manager
     p = Dar_ManStart( pAig, pPars );
     if ( pPars->fPower )
@@ -216,6 +216,9 @@ p->timeTotal = Abc_Clock() - clkStart;
 p->timeOther = p->timeTotal - p->timeCuts - p->timeEval;
 
 //    Bar_ProgressStop( pProgress );
+    Abc_ProfCount( ABC_PROF_DAR_NODES_TRIED, p->nNodesTried );
+    Abc_ProfCount( ABC_PROF_DAR_CUT_PAIRS, p->nCutsAll );
+    Abc_ProfCount( ABC_PROF_DAR_CUT_TIME_US, (ABC_INT64_T)(1.0e6 * p->timeCuts / CLOCKS_PER_SEC) );
     Dar_ManCutsFree( p );
     // put the nodes into the DFS order and reassign their IDs
 //    Aig_NtkReassignIds( p );
@@ -236,6 +239,7 @@ p->timeOther = p->timeTotal - p->timeCuts - p->timeEval;
     // stop the rewriting manager
     Dar_ManStop( p );
     Aig_ManCheckPhase( pAig );
+    Abc_ProfPop( iPhase );
     // check
     if ( !Aig_ManCheck( pAig ) )
     {
@@ -80,6 +80,10 @@ struct Dar_Man_t_
     int              GainBest;       // the best gain
     int              LevelBest;      // the level of node with the best gain
     int              ClassBest;      // the equivalence class of the best replacement
+    // library data used by this manager
+    void *           pLibPrep;       // the prepared library (owned by the library)
+    int *            pLibNums;       // temporary numbers of library objects
+    void *           pLibDatas;      // data of library objects
     // function statistics
     int              nTotalSubgs;    // the total number of subgraphs tried
     int              ClassTimes[222];// the runtimes for each class
@@ -151,9 +155,14 @@ extern Aig_Obj_t *     Dar_LibBuildBest( Dar_Man_t * p );
 extern Dar_Man_t *     Dar_ManStart( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 extern void            Dar_ManStop( Dar_Man_t * p );
 extern void            Dar_ManPrintStats( Dar_Man_t * p );
+/*=== darPar.c ============================================================*/
+extern void            Dar_ManChoiceSnapshotsPar( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fLightSynth, Aig_Man_t ** ppAig1, Aig_Man_t ** ppAig2 );
 /*=== darPrec.c ============================================================*/
 extern char **         Dar_Permutations( int n );
 extern void            Dar_Truth4VarNPN( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap );
+/*=== darScript.c ============================================================*/
+extern Aig_Man_t *     Dar_NewCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, int fVerbose );
+extern Aig_Man_t *     Dar_NewCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fLightSynth, int fVerbose );
 
 
 
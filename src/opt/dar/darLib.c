@@ -22,6 +22,14 @@
 #include "aig/gia/gia.h"
 #include "dar.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -32,6 +40,7 @@ ABC_NAMESPACE_IMPL_START
 typedef struct Dar_Lib_t_            Dar_Lib_t;
 typedef struct Dar_LibObj_t_         Dar_LibObj_t;
 typedef struct Dar_LibDat_t_         Dar_LibDat_t;
+typedef struct Dar_LibPrep_t_        Dar_LibPrep_t;
 
 struct Dar_LibObj_t_ // library object (2 words)
 {
@@ -56,6 +65,22 @@ struct Dar_LibDat_t_ // library object data
     unsigned char    nLats[3];      // the number of latches on the input/output stem
 };
 
+struct Dar_LibPrep_t_ // library prepared for the given number of subgraphs (read-only once created)
+{
+    int              nSubgraphs;     // the number of subgraphs used in each class
+    int              nNodes0Max;     // the largest number of nodes in a class
+    // nodes by class
+    int              nNodes0[222];   // the number of nodes by class
+    int *            pNodes0[222];   // the nodes for each class
+    int *            pNodes0Mem;     // memory for nodes pointers
+    int              nNodes0Total;   // the total number of nodes
+    // structures by class
+    int              nSubgr0[222];   // the number of subgraphs by class
+    int *            pSubgr0[222];   // the subgraphs for each class
+    int *            pSubgr0Mem;     // memory for subgraph pointers
+    int              nSubgr0Total;   // the total number of subgraph
+};
+
 struct Dar_Lib_t_ // library 
 {
     // objects
@@ -81,20 +106,10 @@ struct Dar_Lib_t_ // library
     int *            pNodes[222];   // the nodes for each class
     int *            pNodesMem;     // memory for nodes pointers
     int              nNodesTotal;   // the total number of nodes
-    // prepared library
-    int              nSubgraphs;
-    int              nNodes0Max;
-    // nodes by class
-    int              nNodes0[222];   // the number of nodes by class
-    int *            pNodes0[222];   // the nodes for each class
-    int *            pNodes0Mem;     // memory for nodes pointers
-    int              nNodes0Total;   // the total number of nodes
-    // structures by class
-    int              nSubgr0[222];   // the number of subgraphs by class
-    int *            pSubgr0[222];   // the subgraphs for each class
-    int *            pSubgr0Mem;     // memory for subgraph pointers
-    int              nSubgr0Total;   // the total number of subgraph
-    // object data
+    // prepared libraries
+    Vec_Ptr_t *      vPreps;        // prepared libraries by the number of subgraphs
+    Dar_LibPrep_t *  pPrep;         // the last prepared library (used by the GIA rewriter)
+    // object data (used by the GIA rewriter)
     Dar_LibDat_t *   pDatas;
     int              nDatas;
     // information about NPN classes
@@ -105,11 +120,29 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
+static void        Dar_LibPrepStop( Dar_LibPrep_t * pPrep );
+
 static Dar_Lib_t * s_DarLib = NULL;
+static int         s_DarLibRefs = 0; // the number of users (one per frame)
+
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_DarLibMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Dar_LibLock()   { pthread_mutex_lock( &s_DarLibMutex );   }
+static inline void Dar_LibUnlock() { pthread_mutex_unlock( &s_DarLibMutex ); }
+#else
+static inline void Dar_LibLock()   {}
+static inline void Dar_LibUnlock() {}
+#endif
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
 
+// object numbers and data used during AIG rewriting belong to the rewriting manager
+static inline int            Dar_LibObjNum( Dar_Man_t * p, Dar_LibObj_t * pObj )             { return p->pLibNums[pObj - s_DarLib->pObjs];                     }
+static inline void           Dar_LibObjSetNum( Dar_Man_t * p, Dar_LibObj_t * pObj, int Num ) { p->pLibNums[pObj - s_DarLib->pObjs] = Num;                      }
+static inline Dar_LibDat_t * Dar_LibDat( Dar_Man_t * p, int i )                              { return (Dar_LibDat_t *)p->pLibDatas + i;                        }
+static inline Dar_LibDat_t * Dar_LibObjDat( Dar_Man_t * p, Dar_LibObj_t * pObj )             { return (Dar_LibDat_t *)p->pLibDatas + Dar_LibObjNum(p, pObj);   }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -141,6 +174,7 @@ Dar_Lib_t * Dar_LibAlloc( int nObjs )
     Dar_Truth4VarNPN( &p->puCanons, &p->pPhases, &p->pPerms, &p->pMap );
     // start the elementary objects
     p->iObj = 4;
+    p->vPreps = Vec_PtrAlloc( 16 );
     for ( i = 0; i < 4; i++ )
     {
         p->pObjs[i].fTerm = 1;
@@ -163,12 +197,16 @@ Dar_Lib_t * Dar_LibAlloc( int nObjs )
 ***********************************************************************/
 void Dar_LibFree( Dar_Lib_t * p )
 {
+    Dar_LibPrep_t * pPrep;
+    int i;
+    Vec_PtrForEachEntry( Dar_LibPrep_t *, p->vPreps, pPrep, i )
+        if ( pPrep )
+            Dar_LibPrepStop( pPrep );
+    Vec_PtrFree( p->vPreps );
     ABC_FREE( p->pObjs );
     ABC_FREE( p->pDatas );
     ABC_FREE( p->pNodesMem );
-    ABC_FREE( p->pNodes0Mem );
     ABC_FREE( p->pSubgrMem );
-    ABC_FREE( p->pSubgr0Mem );
     ABC_FREE( p->pPriosMem );
     ABC_FREE( p->pPlaceMem );
     ABC_FREE( p->pScoreMem );
@@ -300,12 +338,10 @@ void Dar_LibSetup( Dar_Lib_t * p, Vec_Int_t * vOuts, Vec_Int_t * vPrios )
     }
     // allocate memory for the roots of each class
     p->pSubgrMem = ABC_ALLOC( int, Vec_IntSize(vOuts) );
-    p->pSubgr0Mem = ABC_ALLOC( int, Vec_IntSize(vOuts) );
     p->nSubgrTotal = 0;
     for ( i = 0; i < 222; i++ )
     {
         p->pSubgr[i] = p->pSubgrMem + p->nSubgrTotal;
-        p->pSubgr0[i] = p->pSubgr0Mem + p->nSubgrTotal;
         p->nSubgrTotal += p->nSubgr[i];
         p->nSubgr[i] = 0;
     }
@@ -391,12 +427,10 @@ void Dar_LibSetup( Dar_Lib_t * p, Vec_Int_t * vOuts, Vec_Int_t * vPrios )
         p->nNodesTotal += p->nNodes[i];
     // allocate memory for the nodes of each class
     p->pNodesMem = ABC_ALLOC( int, p->nNodesTotal );
-    p->pNodes0Mem = ABC_ALLOC( int, p->nNodesTotal );
     p->nNodesTotal = 0;
     for ( i = 0; i < 222; i++ )
     {
         p->pNodes[i] = p->pNodesMem + p->nNodesTotal;
-        p->pNodes0[i] = p->pNodes0Mem + p->nNodesTotal;
         p->nNodesTotal += p->nNodes[i];
         p->nNodes[i] = 0;
     }
@@ -451,36 +485,45 @@ void Dar_LibCreateData( Dar_Lib_t * p, int nDatas )
   SeeAlso     []
 
 ***********************************************************************/
-void Dar_LibSetup0_rec( Dar_Lib_t * p, Dar_LibObj_t * pObj, int Class, int fCollect )
+void Dar_LibSetup0_rec( Dar_Lib_t * p, Dar_LibPrep_t * pPrep, int * pMarks, Dar_LibObj_t * pObj, int Class, int fCollect )
 {
-    if ( pObj->fTerm || (int)pObj->Num == Class )
+    int Id = pObj - p->pObjs;
+    if ( pObj->fTerm || pMarks[Id] == Class )
         return;
-    pObj->Num = Class;
-    Dar_LibSetup0_rec( p, Dar_LibObj(p, pObj->Fan0), Class, fCollect );
-    Dar_LibSetup0_rec( p, Dar_LibObj(p, pObj->Fan1), Class, fCollect );
+    pMarks[Id] = Class;
+    Dar_LibSetup0_rec( p, pPrep, pMarks, Dar_LibObj(p, pObj->Fan0), Class, fCollect );
+    Dar_LibSetup0_rec( p, pPrep, pMarks, Dar_LibObj(p, pObj->Fan1), Class, fCollect );
     if ( fCollect )
-        p->pNodes0[Class][ p->nNodes0[Class]++ ] = pObj-p->pObjs;
+        pPrep->pNodes0[Class][ pPrep->nNodes0[Class]++ ] = Id;
     else
-        p->nNodes0[Class]++;
+        pPrep->nNodes0[Class]++;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Starts the library.]
+  Synopsis    [Prepares the library for the given number of subgraphs.]
 
-  Description []
+  Description [Only reads the library. The traversal marks are kept 
+  in a local array rather than in the library objects.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Dar_LibPrepare( int nSubgraphs )
+Dar_LibPrep_t * Dar_LibPrepStart( Dar_Lib_t * p, int nSubgraphs )
 {
-    Dar_Lib_t * p = s_DarLib;
-    int i, k, nNodes0Total;
-    if ( p->nSubgraphs == nSubgraphs )
-        return;
+    Dar_LibPrep_t * pPrep;
+    int * pMarks;
+    int i, k, nTotal, nNodes0Total;
+    pPrep = ABC_CALLOC( Dar_LibPrep_t, 1 );
+    pPrep->nSubgraphs = nSubgraphs;
+    pPrep->pSubgr0Mem = ABC_ALLOC( int, p->nSubgrTotal );
+    pPrep->pNodes0Mem = ABC_ALLOC( int, p->nNodesTotal );
+    for ( nTotal = i = 0; i < 222; nTotal += p->nSubgr[i++] )
+        pPrep->pSubgr0[i] = pPrep->pSubgr0Mem + nTotal;
+    for ( nTotal = i = 0; i < 222; nTotal += p->nNodes[i++] )
+        pPrep->pNodes0[i] = pPrep->pNodes0Mem + nTotal;
 
     // favor special classes:
     //  1 : F = (!d*!c*!b*!a)
@@ -489,60 +532,110 @@ void Dar_LibPrepare( int nSubgraphs )
     // 20 : F = (!d*!(c*b*a))
 
     // set the subgraph counters 
-    p->nSubgr0Total = 0;
+    pPrep->nSubgr0Total = 0;
     for ( i = 0; i < 222; i++ )
     {
 //        if ( i == 1 || i == 4 || i == 12 || i == 20 ) // special classes 
         if ( i == 1 ) // special classes 
-            p->nSubgr0[i] = p->nSubgr[i];
+            pPrep->nSubgr0[i] = p->nSubgr[i];
         else
-            p->nSubgr0[i] = Abc_MinInt( p->nSubgr[i], nSubgraphs );
-        p->nSubgr0Total += p->nSubgr0[i];
-        for ( k = 0; k < p->nSubgr0[i]; k++ )
-            p->pSubgr0[i][k] = p->pSubgr[i][ p->pPrios[i][k] ];
+            pPrep->nSubgr0[i] = Abc_MinInt( p->nSubgr[i], nSubgraphs );
+        pPrep->nSubgr0Total += pPrep->nSubgr0[i];
+        for ( k = 0; k < pPrep->nSubgr0[i]; k++ )
+            pPrep->pSubgr0[i][k] = p->pSubgr[i][ p->pPrios[i][k] ];
     }
 
     // count the number of nodes
-    // clean node counters
-    for ( i = 0; i < 222; i++ )
-        p->nNodes0[i] = 0;
     // create traversal IDs
-    for ( i = 0; i < p->iObj; i++ )
-        Dar_LibObj(p, i)->Num = 0xff;
+    pMarks = ABC_FALLOC( int, p->iObj );
     // count nodes in each class
     // count the total number of nodes and the largest class
-    p->nNodes0Total = 0;
-    p->nNodes0Max = 0;
+    pPrep->nNodes0Total = 0;
+    pPrep->nNodes0Max = 0;
     for ( i = 0; i < 222; i++ )
     {
-        for ( k = 0; k < p->nSubgr0[i]; k++ )
-            Dar_LibSetup0_rec( p, Dar_LibObj(p, p->pSubgr0[i][k]), i, 0 );
-        p->nNodes0Total += p->nNodes0[i];
-        p->nNodes0Max = Abc_MaxInt( p->nNodes0Max, p->nNodes0[i] );
+        for ( k = 0; k < pPrep->nSubgr0[i]; k++ )
+            Dar_LibSetup0_rec( p, pPrep, pMarks, Dar_LibObj(p, pPrep->pSubgr0[i][k]), i, 0 );
+        pPrep->nNodes0Total += pPrep->nNodes0[i];
+        pPrep->nNodes0Max = Abc_MaxInt( pPrep->nNodes0Max, pPrep->nNodes0[i] );
     }
 
     // clean node counters
     for ( i = 0; i < 222; i++ )
-        p->nNodes0[i] = 0;
+        pPrep->nNodes0[i] = 0;
     // create traversal IDs
     for ( i = 0; i < p->iObj; i++ )
-        Dar_LibObj(p, i)->Num = 0xff;
+        pMarks[i] = -1;
     // add the nodes to storage
     nNodes0Total = 0;
     for ( i = 0; i < 222; i++ )
     {
-        for ( k = 0; k < p->nSubgr0[i]; k++ )
-            Dar_LibSetup0_rec( p, Dar_LibObj(p, p->pSubgr0[i][k]), i, 1 );
-         nNodes0Total += p->nNodes0[i];
+        for ( k = 0; k < pPrep->nSubgr0[i]; k++ )
+            Dar_LibSetup0_rec( p, pPrep, pMarks, Dar_LibObj(p, pPrep->pSubgr0[i][k]), i, 1 );
+         nNodes0Total += pPrep->nNodes0[i];
     }
-    assert( nNodes0Total == p->nNodes0Total );
-     // prepare the number of the PI nodes
-    for ( i = 0; i < 4; i++ )
-        Dar_LibObj(p, i)->Num = i;
+    assert( nNodes0Total == pPrep->nNodes0Total );
+    ABC_FREE( pMarks );
+    return pPrep;
+}
+static void Dar_LibPrepStop( Dar_LibPrep_t * pPrep )
+{
+    ABC_FREE( pPrep->pNodes0Mem );
+    ABC_FREE( pPrep->pSubgr0Mem );
+    ABC_FREE( pPrep );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the library prepared for the given number of subgraphs.]
+
+  Description [The prepared libraries are created on demand under the 
+  library lock and are not changed afterwards, so the returned one can 
+  be read by any number of rewriting managers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dar_LibPrep_t * Dar_LibPrepRead( int nSubgraphs )
+{
+    Dar_LibPrep_t * pPrep;
+    assert( s_DarLib != NULL && nSubgraphs >= 0 );
+    Dar_LibLock();
+    Vec_PtrFillExtra( s_DarLib->vPreps, nSubgraphs + 1, NULL );
+    pPrep = (Dar_LibPrep_t *)Vec_PtrEntry( s_DarLib->vPreps, nSubgraphs );
+    if ( pPrep == NULL )
+    {
+        pPrep = Dar_LibPrepStart( s_DarLib, nSubgraphs );
+        Vec_PtrWriteEntry( s_DarLib->vPreps, nSubgraphs, pPrep );
+    }
+    Dar_LibUnlock();
+    return pPrep;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the library.]
+
+  Description [Makes the prepared library current for the GIA rewriter, 
+  which uses the shared object data and is not reentrant. The AIG 
+  rewriter reads the prepared library of its own manager.]
+               
+  SideEffects []
+
+  SeeAlso     []
 
-    // realloc the datas
-    Dar_LibCreateData( p, p->nNodes0Max + 32 ); 
+***********************************************************************/
+void Dar_LibPrepare( int nSubgraphs )
+{
+    Dar_LibPrep_t * pPrep = Dar_LibPrepRead( nSubgraphs );
+    Dar_LibLock();
+    s_DarLib->pPrep = pPrep;
     // allocated more because Dar_LibBuildBest() sometimes requires more entries
+    if ( s_DarLib->nDatas < pPrep->nNodes0Max + 32 )
+        Dar_LibCreateData( s_DarLib, pPrep->nNodes0Max + 32 ); 
+    Dar_LibUnlock();
 }
 
 /**Function*************************************************************
@@ -583,7 +676,8 @@ Dar_Lib_t * Dar_LibRead()
 
   Synopsis    [Starts the library.]
 
-  Description []
+  Description [The library is shared by all frames and is only read 
+  after it is started. Each call should be matched by Dar_LibStop().]
                
   SideEffects []
 
@@ -593,10 +687,13 @@ Dar_Lib_t * Dar_LibRead()
 void Dar_LibStart()
 {
 //    abctime clk = Abc_Clock();
-    if ( s_DarLib != NULL )
-        return;
-    assert( s_DarLib == NULL );
-    s_DarLib = Dar_LibRead();
+    Dar_LibLock();
+    if ( s_DarLibRefs++ == 0 )
+    {
+        assert( s_DarLib == NULL );
+        s_DarLib = Dar_LibRead();
+    }
+    Dar_LibUnlock();
 //    printf( "The 4-input library started with %d nodes and %d subgraphs. ", s_DarLib->nObjs - 4, s_DarLib->nSubgrTotal );
 //    ABC_PRT( "Time", Abc_Clock() - clk );
 }
@@ -614,16 +711,22 @@ void Dar_LibStart()
 ***********************************************************************/
 void Dar_LibStop()
 {
-    assert( s_DarLib != NULL );
-    Dar_LibFree( s_DarLib );
-    s_DarLib = NULL;
+    Dar_LibLock();
+    assert( s_DarLib != NULL && s_DarLibRefs > 0 );
+    if ( --s_DarLibRefs == 0 )
+    {
+        Dar_LibFree( s_DarLib );
+        s_DarLib = NULL;
+    }
+    Dar_LibUnlock();
 }
 
 /**Function*************************************************************
 
   Synopsis    [Updates the score of the class and adjusts the priority of this class.]
 
-  Description []
+  Description [Only used when training the priorities. The libraries 
+  prepared before the update keep the old priorities.]
                
   SideEffects []
 
@@ -636,6 +739,7 @@ void Dar_LibIncrementScore( int Class, int Out, int Gain )
     int * pPlace = s_DarLib->pPlace[Class];  // pPlace[Out] = i
     int * pScore = s_DarLib->pScore[Class];  // score of Out
     int Out2;
+    Dar_LibLock();
     assert( Class >= 0 && Class < 222 );
     assert( Out >= 0 && Out < s_DarLib->nSubgr[Class] );
     assert( pPlace[pPrios[Out]] == Out );
@@ -652,6 +756,7 @@ void Dar_LibIncrementScore( int Class, int Out, int Gain )
         pPrios[pPlace[Out]] = Out;
         pPrios[pPlace[Out2]] = Out2;
     }
+    Dar_LibUnlock();
 }
 
 /**Function*************************************************************
@@ -723,13 +828,13 @@ int Dar_LibCutMatch( Dar_Man_t * p, Dar_Cut_t * pCut )
             return 0;
         }
         pFanin = Aig_NotCond(pFanin, ((uPhase >> i) & 1) );
-        s_DarLib->pDatas[i].pFunc = pFanin;
-        s_DarLib->pDatas[i].Level = Aig_Regular(pFanin)->Level;
+        Dar_LibDat(p, i)->pFunc = pFanin;
+        Dar_LibDat(p, i)->Level = Aig_Regular(pFanin)->Level;
         // copy the propability of node being one
         if ( p->pPars->fPower )
         {
             float Prob = Abc_Int2Float( Vec_IntEntry( p->pAig->vProbs, Aig_ObjId(Aig_Regular(pFanin)) ) );
-            s_DarLib->pDatas[i].dProb = Aig_IsComplement(pFanin)? 1.0-Prob : Prob;
+            Dar_LibDat(p, i)->dProb = Aig_IsComplement(pFanin)? 1.0-Prob : Prob;
         }
     }
     p->nCutsGood++;
@@ -749,17 +854,17 @@ int Dar_LibCutMatch( Dar_Man_t * p, Dar_Cut_t * pCut )
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_LibCutMarkMffc( Aig_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * pPower )
+int Dar_LibCutMarkMffc( Dar_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * pPower )
 {
     int i, nNodes;
     // mark the cut leaves
     for ( i = 0; i < nLeaves; i++ )
-        Aig_Regular(s_DarLib->pDatas[i].pFunc)->nRefs++;
+        Aig_Regular(Dar_LibDat(p, i)->pFunc)->nRefs++;
     // label MFFC with current ID
-    nNodes = Aig_NodeMffcLabel( p, pRoot, pPower );
+    nNodes = Aig_NodeMffcLabel( p->pAig, pRoot, pPower );
     // unmark the cut leaves
     for ( i = 0; i < nLeaves; i++ )
-        Aig_Regular(s_DarLib->pDatas[i].pFunc)->nRefs--;
+        Aig_Regular(Dar_LibDat(p, i)->pFunc)->nRefs--;
     return nNodes;
 }
 
@@ -805,26 +910,27 @@ void Dar_LibObjPrint_rec( Dar_LibObj_t * pObj )
 ***********************************************************************/
 void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
 {
+    Dar_LibPrep_t * pPrep = (Dar_LibPrep_t *)p->pLibPrep;
     Dar_LibObj_t * pObj;
     Dar_LibDat_t * pData, * pData0, * pData1;
     Aig_Obj_t * pFanin0, * pFanin1;
     int i;
-    for ( i = 0; i < s_DarLib->nNodes0[Class]; i++ )
+    for ( i = 0; i < pPrep->nNodes0[Class]; i++ )
     {
         // get one class node, assign its temporary number and set its data
-        pObj = Dar_LibObj(s_DarLib, s_DarLib->pNodes0[Class][i]);
-        pObj->Num = 4 + i;
-        assert( (int)pObj->Num < s_DarLib->nNodes0Max + 4 );
-        pData = s_DarLib->pDatas + pObj->Num;
+        pObj = Dar_LibObj(s_DarLib, pPrep->pNodes0[Class][i]);
+        Dar_LibObjSetNum( p, pObj, 4 + i );
+        assert( Dar_LibObjNum(p, pObj) < pPrep->nNodes0Max + 4 );
+        pData = Dar_LibObjDat(p, pObj);
         pData->fMffc = 0;
         pData->pFunc = NULL;
         pData->TravId = 0xFFFF;
 
         // explore the fanins
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan0)->Num < s_DarLib->nNodes0Max + 4 );
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan1)->Num < s_DarLib->nNodes0Max + 4 );
-        pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        assert( Dar_LibObjNum(p, Dar_LibObj(s_DarLib, pObj->Fan0)) < pPrep->nNodes0Max + 4 );
+        assert( Dar_LibObjNum(p, Dar_LibObj(s_DarLib, pObj->Fan1)) < pPrep->nNodes0Max + 4 );
+        pData0 = Dar_LibObjDat(p, Dar_LibObj(s_DarLib, pObj->Fan0));
+        pData1 = Dar_LibObjDat(p, Dar_LibObj(s_DarLib, pObj->Fan1));
         pData->Level = 1 + Abc_MaxInt(pData0->Level, pData1->Level);
         if ( pData0->pFunc == NULL || pData1->pFunc == NULL )
             continue;
@@ -860,14 +966,14 @@ void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required, float * pPower )
+int Dar_LibEval_rec( Dar_Man_t * p, Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required, float * pPower )
 {
     Dar_LibDat_t * pData;
     float Power0, Power1;
     int Area;
     if ( pPower )
         *pPower = (float)0.0;
-    pData = s_DarLib->pDatas + pObj->Num;
+    pData = Dar_LibObjDat(p, pObj);
     if ( pData->TravId == Out )
         return 0;
     pData->TravId = Out;
@@ -877,7 +983,7 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
             *pPower = pData->dProb;
         return 0;
     }
-    assert( pObj->Num > 3 );
+    assert( Dar_LibObjNum(p, pObj) > 3 );
     if ( pData->Level > Required )
         return 0xff;
     if ( pData->pFunc && !pData->fMffc )
@@ -888,16 +994,16 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
     }
     // this is a new node - get a bound on the area of its branches
     nNodesSaved--;
-    Area = Dar_LibEval_rec( Dar_LibObj(s_DarLib, pObj->Fan0), Out, nNodesSaved, Required+1, pPower? &Power0 : NULL );
+    Area = Dar_LibEval_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0), Out, nNodesSaved, Required+1, pPower? &Power0 : NULL );
     if ( Area > nNodesSaved )
         return 0xff;
-    Area += Dar_LibEval_rec( Dar_LibObj(s_DarLib, pObj->Fan1), Out, nNodesSaved, Required+1, pPower? &Power1 : NULL );
+    Area += Dar_LibEval_rec( p, Dar_LibObj(s_DarLib, pObj->Fan1), Out, nNodesSaved, Required+1, pPower? &Power1 : NULL );
     if ( Area > nNodesSaved )
         return 0xff;
     if ( pPower )
     {
-        Dar_LibDat_t * pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        Dar_LibDat_t * pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        Dar_LibDat_t * pData0 = Dar_LibObjDat(p, Dar_LibObj(s_DarLib, pObj->Fan0));
+        Dar_LibDat_t * pData1 = Dar_LibObjDat(p, Dar_LibObj(s_DarLib, pObj->Fan1));
         pData->dProb = (pObj->fCompl0? 1.0 - pData0->dProb : pData0->dProb)*
                        (pObj->fCompl1? 1.0 - pData1->dProb : pData1->dProb);
         *pPower = Power0 + 2.0 * pData0->dProb * (1.0 - pData0->dProb) +
@@ -906,6 +1012,33 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
     return Area + 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Allocates the library data of the rewriting manager.]
+
+  Description [The shared library and the prepared libraries are only 
+  read during rewriting, which allows several managers to rewrite 
+  different AIGs at the same time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_LibDataStart( Dar_Man_t * p )
+{
+    Dar_LibPrep_t * pPrep;
+    int i;
+    assert( p->pLibNums == NULL && p->pLibDatas == NULL );
+    pPrep = Dar_LibPrepRead( p->pPars->nSubgMax );
+    p->pLibPrep  = pPrep;
+    p->pLibNums  = ABC_CALLOC( int, s_DarLib->nObjs );
+    for ( i = 0; i < 4; i++ )
+        p->pLibNums[i] = i;
+    // allocated more because Dar_LibBuildBest() sometimes requires more entries
+    p->pLibDatas = ABC_CALLOC( Dar_LibDat_t, pPrep->nNodes0Max + 32 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Evaluates one cut.]
@@ -921,28 +1054,32 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
 {
     int fTraining = 0;
     float PowerSaved, PowerAdded;
+    Dar_LibPrep_t * pPrep;
     Dar_LibObj_t * pObj;
     int Out, k, Class, nNodesSaved, nNodesAdded, nNodesGained;
     abctime clk = Abc_Clock();
     if ( pCut->nLeaves != 4 )
         return;
+    if ( p->pLibNums == NULL )
+        Dar_LibDataStart( p );
+    pPrep = (Dar_LibPrep_t *)p->pLibPrep;
     // check if the cut exits and assigns leaves and their levels
     if ( !Dar_LibCutMatch(p, pCut) )
         return;
     // mark MFFC of the node
-    nNodesSaved = Dar_LibCutMarkMffc( p->pAig, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
+    nNodesSaved = Dar_LibCutMarkMffc( p, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
     // evaluate the cut
     Class = s_DarLib->pMap[pCut->uTruth];
     Dar_LibEvalAssignNums( p, Class, pRoot );
     // profile outputs by their savings
-    p->nTotalSubgs += s_DarLib->nSubgr0[Class];
-    p->ClassSubgs[Class] += s_DarLib->nSubgr0[Class];
-    for ( Out = 0; Out < s_DarLib->nSubgr0[Class]; Out++ )
+    p->nTotalSubgs += pPrep->nSubgr0[Class];
+    p->ClassSubgs[Class] += pPrep->nSubgr0[Class];
+    for ( Out = 0; Out < pPrep->nSubgr0[Class]; Out++ )
     {
-        pObj = Dar_LibObj(s_DarLib, s_DarLib->pSubgr0[Class][Out]);
-        if ( Aig_Regular(s_DarLib->pDatas[pObj->Num].pFunc) == pRoot )
+        pObj = Dar_LibObj(s_DarLib, pPrep->pSubgr0[Class][Out]);
+        if ( Aig_Regular(Dar_LibObjDat(p, pObj)->pFunc) == pRoot )
             continue;
-        nNodesAdded = Dar_LibEval_rec( pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required, p->pPars->fPower? &PowerAdded : NULL );
+        nNodesAdded = Dar_LibEval_rec( p, pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required, p->pPars->fPower? &PowerAdded : NULL );
         nNodesGained = nNodesSaved - nNodesAdded;
         if ( p->pPars->fPower && PowerSaved < PowerAdded )
             continue;
@@ -951,15 +1088,15 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
         if ( nNodesGained < 0 || (nNodesGained == 0 && !p->pPars->fUseZeros) )
             continue;
         if ( nNodesGained <  p->GainBest || 
-            (nNodesGained == p->GainBest && s_DarLib->pDatas[pObj->Num].Level >= p->LevelBest) )
+            (nNodesGained == p->GainBest && Dar_LibObjDat(p, pObj)->Level >= p->LevelBest) )
             continue;
         // remember this possibility
         Vec_PtrClear( p->vLeavesBest );
         for ( k = 0; k < (int)pCut->nLeaves; k++ )
-            Vec_PtrPush( p->vLeavesBest, s_DarLib->pDatas[k].pFunc );
-        p->OutBest    = s_DarLib->pSubgr0[Class][Out];
+            Vec_PtrPush( p->vLeavesBest, Dar_LibDat(p, k)->pFunc );
+        p->OutBest    = pPrep->pSubgr0[Class][Out];
         p->OutNumBest = Out;
-        p->LevelBest  = s_DarLib->pDatas[pObj->Num].Level;
+        p->LevelBest  = Dar_LibObjDat(p, pObj)->Level;
         p->GainBest   = nNodesGained;
         p->ClassBest  = Class;
         assert( p->LevelBest <= Required );
@@ -981,14 +1118,14 @@ p->timeEval += clk;
   SeeAlso     []
 
 ***********************************************************************/
-void Dar_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
+void Dar_LibBuildClear_rec( Dar_Man_t * p, Dar_LibObj_t * pObj, int * pCounter )
 {
     if ( pObj->fTerm )
         return;
-    pObj->Num = (*pCounter)++;
-    s_DarLib->pDatas[ pObj->Num ].pFunc = NULL;
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan0), pCounter );
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan1), pCounter );
+    Dar_LibObjSetNum( p, pObj, (*pCounter)++ );
+    Dar_LibObjDat(p, pObj)->pFunc = NULL;
+    Dar_LibBuildClear_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0), pCounter );
+    Dar_LibBuildClear_rec( p, Dar_LibObj(s_DarLib, pObj->Fan1), pCounter );
 }
 
 /**Function*************************************************************
@@ -1005,7 +1142,7 @@ void Dar_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
 Aig_Obj_t * Dar_LibBuildBest_rec( Dar_Man_t * p, Dar_LibObj_t * pObj )
 {
     Aig_Obj_t * pFanin0, * pFanin1;
-    Dar_LibDat_t * pData = s_DarLib->pDatas + pObj->Num;
+    Dar_LibDat_t * pData = Dar_LibObjDat(p, pObj);
     if ( pData->pFunc )
         return pData->pFunc;
     pFanin0 = Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0) );
@@ -1032,8 +1169,8 @@ Aig_Obj_t * Dar_LibBuildBest( Dar_Man_t * p )
 {
     int i, Counter = 4;
     for ( i = 0; i < Vec_PtrSize(p->vLeavesBest); i++ )
-        s_DarLib->pDatas[i].pFunc = (Aig_Obj_t *)Vec_PtrEntry( p->vLeavesBest, i );
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, p->OutBest), &Counter );
+        Dar_LibDat(p, i)->pFunc = (Aig_Obj_t *)Vec_PtrEntry( p->vLeavesBest, i );
+    Dar_LibBuildClear_rec( p, Dar_LibObj(s_DarLib, p->OutBest), &Counter );
     return Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, p->OutBest) );
 }
 
@@ -1085,25 +1222,25 @@ int Dar2_LibCutMatch( Gia_Man_t * p, Vec_Int_t * vCutLits, unsigned uTruth )
   SeeAlso     []
 
 ***********************************************************************/
-void Dar2_LibEvalAssignNums( Gia_Man_t * p, int Class )
+void Dar2_LibEvalAssignNums( Gia_Man_t * p, int Class, int fMffc )
 {
     Dar_LibObj_t * pObj;
     Dar_LibDat_t * pData, * pData0, * pData1;
     int iFanin0, iFanin1, i, iLit;
-    for ( i = 0; i < s_DarLib->nNodes0[Class]; i++ )
+    for ( i = 0; i < s_DarLib->pPrep->nNodes0[Class]; i++ )
     {
         // get one class node, assign its temporary number and set its data
-        pObj = Dar_LibObj(s_DarLib, s_DarLib->pNodes0[Class][i]);
+        pObj = Dar_LibObj(s_DarLib, s_DarLib->pPrep->pNodes0[Class][i]);
         pObj->Num = 4 + i;
-        assert( (int)pObj->Num < s_DarLib->nNodes0Max + 4 );
+        assert( (int)pObj->Num < s_DarLib->pPrep->nNodes0Max + 4 );
         pData = s_DarLib->pDatas + pObj->Num;
         pData->fMffc = 0;
         pData->iGunc = -1;
         pData->TravId = 0xFFFF;
 
         // explore the fanins
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan0)->Num < s_DarLib->nNodes0Max + 4 );
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan1)->Num < s_DarLib->nNodes0Max + 4 );
+        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan0)->Num < s_DarLib->pPrep->nNodes0Max + 4 );
+        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan1)->Num < s_DarLib->pPrep->nNodes0Max + 4 );
         pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
         pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
         pData->Level = 1 + Abc_MaxInt(pData0->Level, pData1->Level);
@@ -1130,7 +1267,10 @@ void Dar2_LibEvalAssignNums( Gia_Man_t * p, int Class )
             // update the level to be more accurate
             pData->Level = Gia_ObjLevel( p, Gia_Regular(Gia_ObjFromLit(p, pData->iGunc)) );
             // mark the node if it is part of MFFC
-//            pData->fMffc = Gia_ObjIsTravIdCurrentArray(p, Gia_Regular(pData->pGunc));
+            // (the nodes without references are not part of the AIG and are treated as new)
+            if ( fMffc )
+                pData->fMffc = Gia_ObjIsTravIdCurrentId(p, Abc_Lit2Var(pData->iGunc)) || 
+                    (p->pRefs && Abc_Lit2Var(pData->iGunc) > 0 && Gia_ObjRefNumId(p, Abc_Lit2Var(pData->iGunc)) == 0);
         }
     }
 }
@@ -1157,7 +1297,7 @@ int Dar2_LibEval_rec( Dar_LibObj_t * pObj, int Out )
     if ( pObj->fTerm )
         return 0;
     assert( pObj->Num > 3 );
-    if ( pData->iGunc >= 0 )//&& !pData->fMffc )
+    if ( pData->iGunc >= 0 && !pData->fMffc )
         return 0;
     // this is a new node - get a bound on the area of its branches
 //    nNodesSaved--;
@@ -1202,13 +1342,13 @@ int Dar2_LibEval( Gia_Man_t * p, Vec_Int_t * vCutLits, unsigned uTruth, int fKee
     nNodesSaved = 0;
     // evaluate the cut
     Class = s_DarLib->pMap[uTruth];
-    Dar2_LibEvalAssignNums( p, Class );
+    Dar2_LibEvalAssignNums( p, Class, 0 );
     // profile outputs by their savings
-//    p->nTotalSubgs += s_DarLib->nSubgr0[Class];
-//    p->ClassSubgs[Class] += s_DarLib->nSubgr0[Class];
-    for ( Out = 0; Out < s_DarLib->nSubgr0[Class]; Out++ )
+//    p->nTotalSubgs += s_DarLib->pPrep->nSubgr0[Class];
+//    p->ClassSubgs[Class] += s_DarLib->pPrep->nSubgr0[Class];
+    for ( Out = 0; Out < s_DarLib->pPrep->nSubgr0[Class]; Out++ )
     {
-        pObj = Dar_LibObj(s_DarLib, s_DarLib->pSubgr0[Class][Out]);
+        pObj = Dar_LibObj(s_DarLib, s_DarLib->pPrep->pSubgr0[Class][Out]);
 //        nNodesAdded = Dar2_LibEval_rec( pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required, p->pPars->fPower? &PowerAdded : NULL );
         nNodesAdded = Dar2_LibEval_rec( pObj, Out );
         nNodesGained = nNodesSaved - nNodesAdded;
@@ -1228,7 +1368,7 @@ int Dar2_LibEval( Gia_Man_t * p, Vec_Int_t * vCutLits, unsigned uTruth, int fKee
         Vec_IntClear( vLeavesBest2 );
         for ( k = 0; k < Vec_IntSize(vCutLits); k++ )
             Vec_IntPush( vLeavesBest2, s_DarLib->pDatas[k].iGunc );
-        p_OutBest    = s_DarLib->pSubgr0[Class][Out];
+        p_OutBest    = s_DarLib->pPrep->pSubgr0[Class][Out];
         p_OutNumBest = Out;
         p_LevelBest  = s_DarLib->pDatas[pObj->Num].Level;
         p_GainBest   = nNodesGained;
@@ -1242,6 +1382,54 @@ int Dar2_LibEval( Gia_Man_t * p, Vec_Int_t * vCutLits, unsigned uTruth, int fKee
     return p_OutBest;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Evaluates one cut while accounting for the MFFC.]
+
+  Description [The copies of the MFFC nodes of the root are expected to be 
+  marked with the current traversal ID of the manager. Skips the subgraphs 
+  whose level exceeds Required. Returns the best subgraph and its gain.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar2_LibEvalMffc( Gia_Man_t * p, Vec_Int_t * vCutLits, unsigned uTruth, int nNodesSaved, int Required, Vec_Int_t * vLeavesBest2, int * pGain )
+{
+    int p_OutBest    = -1;
+    int p_LevelBest  =  1000000;
+    int p_GainBest   = -1000000;
+    Dar_LibObj_t * pObj;
+    int Out, k, Class, nNodesAdded, nNodesGained;
+    assert( Vec_IntSize(vCutLits) == 4 );
+    assert( (uTruth >> 16) == 0 );
+    if ( !Dar2_LibCutMatch(p, vCutLits, uTruth) )
+        return -1;
+    Class = s_DarLib->pMap[uTruth];
+    Dar2_LibEvalAssignNums( p, Class, 1 );
+    for ( Out = 0; Out < s_DarLib->pPrep->nSubgr0[Class]; Out++ )
+    {
+        pObj = Dar_LibObj(s_DarLib, s_DarLib->pPrep->pSubgr0[Class][Out]);
+        if ( (int)s_DarLib->pDatas[pObj->Num].Level > Required )
+            continue;
+        nNodesAdded = Dar2_LibEval_rec( pObj, Out );
+        nNodesGained = nNodesSaved - nNodesAdded;
+        if ( nNodesGained <  p_GainBest || 
+            (nNodesGained == p_GainBest && s_DarLib->pDatas[pObj->Num].Level >= p_LevelBest) )
+            continue;
+        // remember this possibility
+        Vec_IntClear( vLeavesBest2 );
+        for ( k = 0; k < Vec_IntSize(vCutLits); k++ )
+            Vec_IntPush( vLeavesBest2, s_DarLib->pDatas[k].iGunc );
+        p_OutBest    = s_DarLib->pPrep->pSubgr0[Class][Out];
+        p_LevelBest  = s_DarLib->pDatas[pObj->Num].Level;
+        p_GainBest   = nNodesGained;
+    }
+    *pGain = p_GainBest;
+    return p_OutBest;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Clears the fields of the nodes used i this cut.]
@@ -0,0 +1,426 @@
+/**CFile****************************************************************
+
+  FileName    [darPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware AIG rewriting.]
+
+  Synopsis    [Partition-parallel rewriting scripts.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: darPar.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "darInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PAR_THR_MAX 100
+
+typedef struct Dar_ParThData_t_ Dar_ParThData_t;
+struct Dar_ParThData_t_
+{
+    Vec_Ptr_t *      vWins;          // windows to be synthesized
+    Vec_Ptr_t *      vRes;           // synthesized windows
+    int              iWin;           // the current window
+    int              fBalance;       // synthesis parameters
+    int              fUpdateLevel;
+    int              fFanout;
+    int              fWorking;       // the thread is busy
+    abctime          clkUsed;        // runtime of this thread
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Divides the AIG into windows.]
+
+  Description [Each window is a contiguous chunk of AND nodes listed in
+  the topological order. The CIs of the window are the fanins of its nodes
+  belonging to other windows. The COs of the window are its nodes used
+  outside. Because the windows do not overlap, they can be synthesized
+  independently and put back together without duplicating logic.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Dar_ManPartWindows( Aig_Man_t * p, int nPartSize, Vec_Ptr_t ** pvIns, Vec_Ptr_t ** pvOuts )
+{
+    Vec_Ptr_t * vNodes, * vWins, * vIns, * vOuts, * vWinIns, * vWinOuts;
+    Vec_Int_t * vPart;
+    Aig_Man_t * pWin;
+    Aig_Obj_t * pObj, * pFanin;
+    int i, k, f, nParts;
+    vNodes = Aig_ManDfs( p, 1 );
+    nParts = (Vec_PtrSize(vNodes) + nPartSize - 1) / nPartSize;
+    // assign nodes to partitions and mark the nodes used outside of their partitions
+    vPart = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        Vec_IntWriteEntry( vPart, Aig_ObjId(pObj), i / nPartSize );
+    Aig_ManCleanMarkA( p );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        for ( f = 0; f < 2; f++ )
+        {
+            pFanin = f ? Aig_ObjFanin1(pObj) : Aig_ObjFanin0(pObj);
+            if ( Aig_ObjIsNode(pFanin) && Vec_IntEntry(vPart, Aig_ObjId(pFanin)) != i / nPartSize )
+                pFanin->fMarkA = 1;
+        }
+    Aig_ManForEachCo( p, pObj, i )
+        Aig_ObjFanin0(pObj)->fMarkA = 1;
+    // create the windows
+    vWins = Vec_PtrAlloc( nParts );
+    vIns  = Vec_PtrAlloc( nParts );
+    vOuts = Vec_PtrAlloc( nParts );
+    for ( k = 0; k < nParts; k++ )
+    {
+        pWin = Aig_ManStart( nPartSize );
+        vWinIns  = Vec_PtrAlloc( 100 );
+        vWinOuts = Vec_PtrAlloc( 100 );
+        Aig_ManConst1(p)->pData = Aig_ManConst1(pWin);
+        Aig_ManIncrementTravId( p );
+        for ( i = k * nPartSize; i < Abc_MinInt((k + 1) * nPartSize, Vec_PtrSize(vNodes)); i++ )
+        {
+            pObj = (Aig_Obj_t *)Vec_PtrEntry( vNodes, i );
+            for ( f = 0; f < 2; f++ )
+            {
+                pFanin = f ? Aig_ObjFanin1(pObj) : Aig_ObjFanin0(pObj);
+                if ( Aig_ObjIsConst1(pFanin) || Vec_IntEntry(vPart, Aig_ObjId(pFanin)) == k )
+                    continue;
+                if ( Aig_ObjIsTravIdCurrent(p, pFanin) )
+                    continue;
+                Aig_ObjSetTravIdCurrent( p, pFanin );
+                pFanin->pData = Aig_ObjCreateCi( pWin );
+                Vec_PtrPush( vWinIns, pFanin );
+            }
+            pObj->pData = Aig_And( pWin, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+            if ( !pObj->fMarkA )
+                continue;
+            Aig_ObjCreateCo( pWin, (Aig_Obj_t *)pObj->pData );
+            Vec_PtrPush( vWinOuts, pObj );
+        }
+        Aig_ManCleanup( pWin );
+        Vec_PtrPush( vWins, pWin );
+        Vec_PtrPush( vIns, vWinIns );
+        Vec_PtrPush( vOuts, vWinOuts );
+    }
+    Aig_ManCleanMarkA( p );
+    Vec_IntFree( vPart );
+    Vec_PtrFree( vNodes );
+    *pvIns  = vIns;
+    *pvOuts = vOuts;
+    return vWins;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Puts the synthesized windows back together.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManPartStitch( Aig_Man_t * p, Vec_Ptr_t * vRes, Vec_Ptr_t * vIns, Vec_Ptr_t * vOuts )
+{
+    Vec_Ptr_t * vWinIns, * vWinOuts;
+    Aig_Man_t * pNew, * pWin, * pTemp;
+    Aig_Obj_t * pObj;
+    int i, k;
+    pNew = Aig_ManStart( Aig_ManNodeNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    Aig_ManConst1(p)->pData = Aig_ManConst1(pNew);
+    Aig_ManForEachCi( p, pObj, i )
+        pObj->pData = Aig_ObjCreateCi( pNew );
+    Vec_PtrForEachEntry( Aig_Man_t *, vRes, pWin, k )
+    {
+        vWinIns  = (Vec_Ptr_t *)Vec_PtrEntry( vIns, k );
+        vWinOuts = (Vec_Ptr_t *)Vec_PtrEntry( vOuts, k );
+        assert( Aig_ManCiNum(pWin) == Vec_PtrSize(vWinIns) );
+        assert( Aig_ManCoNum(pWin) == Vec_PtrSize(vWinOuts) );
+        Aig_ManConst1(pWin)->pData = Aig_ManConst1(pNew);
+        Aig_ManForEachCi( pWin, pObj, i )
+            pObj->pData = ((Aig_Obj_t *)Vec_PtrEntry(vWinIns, i))->pData;
+        Aig_ManForEachNode( pWin, pObj, i )
+            pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+        Aig_ManForEachCo( pWin, pObj, i )
+            ((Aig_Obj_t *)Vec_PtrEntry(vWinOuts, i))->pData = Aig_ObjChild0Copy(pObj);
+    }
+    Aig_ManForEachCo( p, pObj, i )
+        Aig_ObjCreateCo( pNew, Aig_ObjChild0Copy(pObj) );
+    Aig_ManSetRegNum( pNew, Aig_ManRegNum(p) );
+    Aig_ManCleanup( pNew );
+    // make sure the nodes are in the topological order
+    pNew = Aig_ManDupDfs( pTemp = pNew );
+    Aig_ManStop( pTemp );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Synthesizes one window.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_ManParSynthesizeWindow( Dar_ParThData_t * pThData )
+{
+    Aig_Man_t * pWin = (Aig_Man_t *)Vec_PtrEntry( pThData->vWins, pThData->iWin );
+    abctime clk = Abc_Clock();
+    Vec_PtrWriteEntry( pThData->vRes, pThData->iWin, Dar_ManCompress2(pWin, pThData->fBalance, pThData->fUpdateLevel, pThData->fFanout, 0, 0) );
+    pThData->clkUsed += Abc_Clock() - clk;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Dar_ManParSynthesize( Vec_Ptr_t * vWins, Vec_Ptr_t * vRes, int fBalance, int fUpdateLevel, int fFanout, int nProcs, int fVerbose )
+{
+    Dar_ParThData_t ThData;
+    memset( &ThData, 0, sizeof(Dar_ParThData_t) );
+    ThData.vWins        = vWins;
+    ThData.vRes         = vRes;
+    ThData.fBalance     = fBalance;
+    ThData.fUpdateLevel = fUpdateLevel;
+    ThData.fFanout      = fFanout;
+    for ( ThData.iWin = 0; ThData.iWin < Vec_PtrSize(vWins); ThData.iWin++ )
+        Dar_ManParSynthesizeWindow( &ThData );
+}
+
+#else // pthreads are used
+
+void * Dar_ManParWorkerThread( void * pArg )
+{
+    Dar_ParThData_t * pThData = (Dar_ParThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->iWin == -1 )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Dar_ManParSynthesizeWindow( pThData );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Synthesizes the windows using several threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_ManParSynthesize( Vec_Ptr_t * vWins, Vec_Ptr_t * vRes, int fBalance, int fUpdateLevel, int fFanout, int nProcs, int fVerbose )
+{
+    Dar_ParThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    int i, status, iWin = 0, fRunning = 1;
+    if ( nProcs > PAR_THR_MAX )
+    {
+        Abc_Print( 0, "The number of threads (%d) exceeds the precompiled limit (%d).\n", nProcs, PAR_THR_MAX );
+        nProcs = PAR_THR_MAX;
+    }
+    // start the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Dar_ParThData_t) );
+        ThData[i].vWins        = vWins;
+        ThData[i].vRes         = vRes;
+        ThData[i].iWin         = -1;
+        ThData[i].fBalance     = fBalance;
+        ThData[i].fUpdateLevel = fUpdateLevel;
+        ThData[i].fFanout      = fFanout;
+        status = pthread_create( WorkerThread + i, NULL, Dar_ManParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // distribute the windows
+    while ( fRunning )
+    {
+        fRunning = 0;
+        for ( i = 0; i < nProcs; i++ )
+        {
+            if ( ThData[i].fWorking )
+            {
+                fRunning = 1;
+                continue;
+            }
+            if ( iWin == Vec_PtrSize(vWins) )
+                continue;
+            ThData[i].iWin = iWin++;
+            ThData[i].fWorking = 1;
+            fRunning = 1;
+        }
+    }
+    // stop the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        assert( !ThData[i].fWorking );
+        ThData[i].iWin = -1;
+        ThData[i].fWorking = 1;
+        pthread_join( WorkerThread[i], NULL );
+    }
+    if ( fVerbose )
+        for ( i = 0; i < nProcs; i++ )
+        {
+            Abc_Print( 1, "Thread %d : ", i );
+            Abc_PrintTime( 1, "Time", ThData[i].clkUsed );
+        }
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Reproduces script "compress2" on windows in parallel.]
+
+  Description [Divides the AIG into non-overlapping windows of the given
+  number of nodes, synthesizes them concurrently, and stitches them back.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManCompress2Par( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nPartSize, int nProcs, int fVerbose )
+{
+    Vec_Ptr_t * vWins, * vRes, * vIns, * vOuts;
+    Aig_Man_t * pNew, * pWin;
+    abctime clk = Abc_Clock();
+    int i;
+    if ( nProcs < 2 || fPower || pAig->pManTime || Aig_ManNodeNum(pAig) <= nPartSize )
+        return Dar_ManCompress2( pAig, fBalance, fUpdateLevel, fFanout, fPower, fVerbose );
+    vWins = Dar_ManPartWindows( pAig, nPartSize, &vIns, &vOuts );
+    vRes  = Vec_PtrStart( Vec_PtrSize(vWins) );
+    if ( fVerbose )
+    {
+        printf( "Starting:  " ), Aig_ManPrintStats( pAig );
+        printf( "Divided into %d windows of %d nodes.  ", Vec_PtrSize(vWins), nPartSize );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Dar_ManParSynthesize( vWins, vRes, fBalance, fUpdateLevel, fFanout, nProcs, fVerbose );
+    pNew = Dar_ManPartStitch( pAig, vRes, vIns, vOuts );
+    if ( fVerbose )
+    {
+        printf( "Final:     " ), Aig_ManPrintStats( pNew );
+        Abc_PrintTime( 1, "Total time", Abc_Clock() - clk );
+    }
+    Vec_PtrForEachEntry( Aig_Man_t *, vWins, pWin, i )
+        Aig_ManStop( pWin );
+    Vec_PtrForEachEntry( Aig_Man_t *, vRes, pWin, i )
+        Aig_ManStop( pWin );
+    Vec_VecFree( (Vec_Vec_t *)vIns );
+    Vec_VecFree( (Vec_Vec_t *)vOuts );
+    Vec_PtrFree( vWins );
+    Vec_PtrFree( vRes );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives two snapshots for choice computation concurrently.]
+
+  Description [Consumes the AIG. The snapshots produced by "compress" and 
+  "compress2" are both derived from the original AIG, each on its own 
+  copy, while the sequential flow applies "compress2" to the result of 
+  "compress".]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Dar_ManChoiceSnapshotsPar( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fLightSynth, Aig_Man_t ** ppAig1, Aig_Man_t ** ppAig2 )
+{
+    *ppAig1 = Dar_NewCompress( pAig, fBalance, fUpdateLevel, 0, 0 );
+    *ppAig2 = Dar_NewCompress2( Aig_ManDupDfs(*ppAig1), fBalance, fUpdateLevel, 1, 0, fLightSynth, 0 );
+}
+
+#else // pthreads are used
+
+typedef struct Dar_ParSnapData_t_ Dar_ParSnapData_t;
+struct Dar_ParSnapData_t_
+{
+    Aig_Man_t *      pAig;           // the copy of the AIG (consumed)
+    int              fBalance;       // synthesis parameters
+    int              fUpdateLevel;
+    int              fLightSynth;
+};
+
+void * Dar_ManParSnapshotThread( void * pArg )
+{
+    Dar_ParSnapData_t * pData = (Dar_ParSnapData_t *)pArg;
+    pData->pAig = Dar_NewCompress2( pData->pAig, pData->fBalance, pData->fUpdateLevel, 1, 0, pData->fLightSynth, 0 );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+void Dar_ManChoiceSnapshotsPar( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fLightSynth, Aig_Man_t ** ppAig1, Aig_Man_t ** ppAig2 )
+{
+    Dar_ParSnapData_t Data;
+    pthread_t WorkerThread;
+    int status;
+    Data.pAig         = Aig_ManDupDfs( pAig );
+    Data.fBalance     = fBalance;
+    Data.fUpdateLevel = fUpdateLevel;
+    Data.fLightSynth  = fLightSynth;
+    status = pthread_create( &WorkerThread, NULL, Dar_ManParSnapshotThread, (void *)&Data );  assert( status == 0 );
+    *ppAig1 = Dar_NewCompress( pAig, fBalance, fUpdateLevel, 0, 0 );
+    pthread_join( WorkerThread, NULL );
+    *ppAig2 = Data.pAig;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
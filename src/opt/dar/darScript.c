@@ -629,7 +629,7 @@ int Dar_NewChoiceSynthesisGuard( Aig_Man_t * pAig )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Dar_NewChoiceSynthesis( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, int fLightSynth, int fVerbose )
+Gia_Man_t * Dar_NewChoiceSynthesis( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, int fLightSynth, int nProcs, int fVerbose )
 //alias resyn    "b; rw; rwz; b; rwz; b"
 //alias resyn2   "b; rw; rf; b; rw; rwz; b; rfz; rwz; b"
 {
@@ -648,12 +648,26 @@ Gia_Man_t * Dar_NewChoiceSynthesis( Aig_Man_t * pAig, int fBalance, int fUpdateL
     pGia = Gia_ManFromAig(pAig);
     Vec_PtrPush( vGias, pGia );
 
-    pAig = Dar_NewCompress( pAig, fBalance, fUpdateLevel, fPower, fVerbose );
-    pGia = Gia_ManFromAig(pAig);
-    Vec_PtrPush( vGias, pGia );
+    if ( nProcs > 1 && !fPower )
+    {
+        Aig_Man_t * pAig2;
+        Dar_ManChoiceSnapshotsPar( pAig, fBalance, fUpdateLevel, fLightSynth, &pAig, &pAig2 );
+        if ( fVerbose ) printf( "Snapshot:  " ), Aig_ManPrintStats( pAig );
+        if ( fVerbose ) printf( "Snapshot:  " ), Aig_ManPrintStats( pAig2 );
+        pGia = Gia_ManFromAig(pAig);
+        Vec_PtrPush( vGias, pGia );
+        Aig_ManStop( pAig );
+        pAig = pAig2;
+    }
+    else
+    {
+        pAig = Dar_NewCompress( pAig, fBalance, fUpdateLevel, fPower, fVerbose );
+        pGia = Gia_ManFromAig(pAig);
+        Vec_PtrPush( vGias, pGia );
 //Aig_ManPrintStats( pAig );
 
-    pAig = Dar_NewCompress2( pAig, fBalance, fUpdateLevel, 1, fPower, fLightSynth, fVerbose );
+        pAig = Dar_NewCompress2( pAig, fBalance, fUpdateLevel, 1, fPower, fLightSynth, fVerbose );
+    }
     pGia = Gia_ManFromAig(pAig);
     Vec_PtrPush( vGias, pGia );
 //Aig_ManPrintStats( pAig );
@@ -866,7 +880,7 @@ Aig_Man_t * Dar_ManChoiceNew( Aig_Man_t * pAig, Dch_Pars_t * pPars )
 
     // perform synthesis
 clk = Abc_Clock();
-    pGia = Dar_NewChoiceSynthesis( Aig_ManDupDfs(pAig), 1, 1, pPars->fPower, pPars->fLightSynth, pPars->fVerbose );
+    pGia = Dar_NewChoiceSynthesis( Aig_ManDupDfs(pAig), 1, 1, pPars->fPower, pPars->fLightSynth, pPars->nProcs, pPars->fVerbose );
 pPars->timeSynth = Abc_Clock() - clk;
 
     // perform choice computation
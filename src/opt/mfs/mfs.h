@@ -49,6 +49,7 @@ struct Mfs_Par_t_
     int           nWinMax;       // the maximum size of the window
     int           nGrowthLevel;  // the maximum allowed growth in level
     int           nBTLimit;      // the maximum number of conflicts in one SAT run
+    int           nProcs;        // the number of threads
     int           fRrOnly;       // perform redundance removal
     int           fResub;        // performs resubstitution
     int           fArea;         // performs optimization for area
@@ -53,6 +53,7 @@ void Abc_NtkMfsParsDefault( Mfs_Par_t * pPars )
     pPars->nWinMax      =  300;
     pPars->nGrowthLevel =    0;
     pPars->nBTLimit     = 5000;
+    pPars->nProcs       =    1;
     pPars->fRrOnly      =    0;
     pPars->fResub       =    1;
     pPars->fArea        =    0;
@@ -485,7 +486,9 @@ int Abc_NtkMfs( Abc_Ntk_t * pNtk, Mfs_Par_t * pPars )
 		if (pPars->fPower)
 		{
 			Abc_NtkMfsPowerResub( p, pPars);
-		} else
+		} else if ( pPars->nProcs > 1 && !pPars->fSwapEdge && Abc_NtkMfsPar( p ) )
+        {
+        } else
 		{
         pProgress = Extra_ProgressBarStart( stdout, Abc_NtkObjNumMax(pNtk) );
         Abc_NtkForEachNode( pNtk, pObj, i )
@@ -100,6 +100,10 @@ struct Mfs_Man_t_
     int                 nWords;    // the number of words
     int                 nCares;    // the number of care minterms
     unsigned            uCare[(MFS_FANIN_MAX<=5)?1:1<<(MFS_FANIN_MAX-5)];  // the computed care-set
+    // the recorded update (parallel mode)
+    int                 iResNode;  // the node to be updated
+    Vec_Int_t *         vResFanins;// the new fanins of the node
+    Vec_Int_t *         vResTruth; // the new function of the node
     // performance statistics
     int                 nTryRemoves; // number of fanin removals
     int                 nTryResubs;  // number of resubstitutions
@@ -115,6 +119,8 @@ struct Mfs_Man_t_
     int                 nTimeOutsLevel;
     int                 nDcMints;
     int                 nMaxDivs;
+    int                 nParWins;    // the number of windows solved in parallel
+    int                 nParConfs;   // the number of updates rejected at commit
     double              dTotalRatios;
     // node/edge stats
     int                 nTotalNodesBeg;
@@ -131,6 +137,7 @@ struct Mfs_Man_t_
     abctime             timeCnf;
     abctime             timeSat;
     abctime             timeInt;
+    abctime             timeUpd;     // updating the network after solving the windows in parallel
     abctime             timeTotal;
 };
 
@@ -152,13 +159,17 @@ static inline float Abc_MfsObjProb( Mfs_Man_t * p, Abc_Obj_t * pObj ) { return (
 extern Vec_Ptr_t *      Abc_MfsComputeDivisors( Mfs_Man_t * p, Abc_Obj_t * pNode, int nLevDivMax );
 /*=== mfsInter.c ==========================================================*/
 extern sat_solver *     Abc_MfsCreateSolverResub( Mfs_Man_t * p, int * pCands, int nCands, int fInvert );
+extern unsigned *       Abc_NtkMfsInterplateFunc( Mfs_Man_t * p, int * pCands, int nCands );
 extern Hop_Obj_t *      Abc_NtkMfsInterplate( Mfs_Man_t * p, int * pCands, int nCands );
 extern int              Abc_NtkMfsInterplateEval( Mfs_Man_t * p, int * pCands, int nCands );
 /*=== mfsMan.c ==========================================================*/
 extern Mfs_Man_t *      Mfs_ManAlloc( Mfs_Par_t * pPars );
 extern void             Mfs_ManStop( Mfs_Man_t * p );
 extern void             Mfs_ManClean( Mfs_Man_t * p );
+/*=== mfsPar.c ==========================================================*/
+extern int              Abc_NtkMfsPar( Mfs_Man_t * p );
 /*=== mfsResub.c ==========================================================*/
+extern void             Abc_NtkMfsUpdateNetwork( Mfs_Man_t * p, Abc_Obj_t * pObj, Vec_Ptr_t * vMfsFanins, Hop_Obj_t * pFunc );
 extern void             Abc_NtkMfsPrintResubStats( Mfs_Man_t * p );
 extern int              Abc_NtkMfsEdgeSwapEval( Mfs_Man_t * p, Abc_Obj_t * pNode );
 extern int              Abc_NtkMfsEdgePower( Mfs_Man_t * p, Abc_Obj_t * pNode );
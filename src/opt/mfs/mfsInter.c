@@ -319,23 +319,22 @@ int Abc_NtkMfsInterplateEval( Mfs_Man_t * p, int * pCands, int nCands )
 
   Synopsis    [Performs interpolation.]
 
-  Description [Derives the new function of the node.]
+  Description [Derives the truth table of the new function of the node.
+  The truth table belongs to the interpolation manager and is valid until
+  the next call. Returns NULL if the SAT solver has timed out.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Hop_Obj_t * Abc_NtkMfsInterplate( Mfs_Man_t * p, int * pCands, int nCands )
+unsigned * Abc_NtkMfsInterplateFunc( Mfs_Man_t * p, int * pCands, int nCands )
 {
-    extern Hop_Obj_t * Kit_GraphToHop( Hop_Man_t * pMan, Kit_Graph_t * pGraph );
     int fDumpFile = 0;
     char FileName[32];
     sat_solver * pSat;
     Sto_Man_t * pCnf = NULL;
     unsigned * puTruth;
-    Kit_Graph_t * pGraph;
-    Hop_Obj_t * pFunc;
     int nFanins, status;
     int c, i, * pGloVars;
 //    abctime clk = Abc_Clock();
@@ -381,9 +380,31 @@ Hop_Obj_t * Abc_NtkMfsInterplate( Mfs_Man_t * p, int * pCands, int nCands )
     nFanins = Int_ManInterpolate( p->pMan, pCnf, 0, &puTruth );
     Sto_ManFree( pCnf );
     assert( nFanins == nCands );
+    return puTruth;
+}
 
+/**Function*************************************************************
+
+  Synopsis    [Performs interpolation.]
+
+  Description [Derives the new function of the node.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Hop_Obj_t * Abc_NtkMfsInterplate( Mfs_Man_t * p, int * pCands, int nCands )
+{
+    extern Hop_Obj_t * Kit_GraphToHop( Hop_Man_t * pMan, Kit_Graph_t * pGraph );
+    unsigned * puTruth;
+    Kit_Graph_t * pGraph;
+    Hop_Obj_t * pFunc;
+    puTruth = Abc_NtkMfsInterplateFunc( p, pCands, nCands );
+    if ( puTruth == NULL )
+        return NULL;
     // transform interpolant into AIG
-    pGraph = Kit_TruthToGraph( puTruth, nFanins, p->vMem );
+    pGraph = Kit_TruthToGraph( puTruth, nCands, p->vMem );
     pFunc = Kit_GraphToHop( (Hop_Man_t *)p->pNtk->pManFunc, pGraph );
     Kit_GraphFree( pGraph );
     return pFunc;
@@ -114,6 +114,9 @@ void Mfs_ManPrint( Mfs_Man_t * p )
     {
         printf( "Nodes = %d. Try = %d. Resub = %d. Div = %d. SAT calls = %d. Timeouts = %d. MaxDivs = %d.\n",
             p->nTotalNodesBeg, p->nNodesTried, p->nNodesResub, p->nTotalDivs, p->nSatCalls, p->nTimeOuts, p->nMaxDivs );
+        if ( p->pPars->nProcs > 1 )
+            printf( "Threads = %d. Windows solved in parallel = %d. Updates rejected at commit = %d.\n",
+                p->pPars->nProcs, p->nParWins, p->nParConfs );
 
         printf( "Attempts :   " );
         printf( "Remove %6d out of %6d (%6.2f %%)   ", p->nRemoves, p->nTryRemoves, 100.0*p->nRemoves/Abc_MaxInt(1, p->nTryRemoves) );
@@ -152,6 +155,8 @@ void Mfs_ManPrint( Mfs_Man_t * p )
     ABC_PRTP( "Cnf", p->timeCnf            ,  p->timeTotal );
     ABC_PRTP( "Sat", p->timeSat-p->timeInt ,  p->timeTotal );
     ABC_PRTP( "Int", p->timeInt            ,  p->timeTotal );
+    if ( p->nParWins )
+        ABC_PRTP( "Upd", p->timeUpd        ,  p->timeTotal );
     ABC_PRTP( "ALL", p->timeTotal          ,  p->timeTotal );
 
 }
@@ -190,6 +195,8 @@ void Mfs_ManStop( Mfs_Man_t * p )
     Vec_IntFree( p->vProjVarsSat );
     Vec_IntFree( p->vDivLits );
     Vec_PtrFree( p->vDivCexes );
+    Vec_IntFreeP( &p->vResFanins );
+    Vec_IntFreeP( &p->vResTruth );
     ABC_FREE( p );
 }
 
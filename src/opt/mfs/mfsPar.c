@@ -0,0 +1,526 @@
+/**CFile****************************************************************
+
+  FileName    [mfsPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [The good old minimization with complete don't-cares.]
+
+  Synopsis    [Parallel resubstitution with non-overlapping windows.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: mfsPar.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "mfsInt.h"
+#include "bool/kit/kit.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PAR_THR_MAX 100
+#define MFS_PAR_WINS  4   // the number of windows per thread in one batch
+
+typedef struct Mfs_ParThData_t_ Mfs_ParThData_t;
+struct Mfs_ParThData_t_
+{
+    Vec_Ptr_t *      vWins;          // window managers
+    Vec_Ptr_t *      vNodes;         // the nodes of the windows
+    int              iWin;           // the current window
+    int              fWorking;       // the thread is busy
+    abctime          clkUsed;        // runtime of this thread
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the manager of one window.]
+
+  Description [The window manager shares the network and the care set
+  with the main manager but has its own window, SAT solver, interpolation
+  manager, and scratch memory. It records the update instead of changing
+  the network.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Mfs_Man_t * Abc_NtkMfsParWinStart( Mfs_Man_t * p, Mfs_Par_t * pParsWin )
+{
+    Mfs_Man_t * pWin = Mfs_ManAlloc( pParsWin );
+    pWin->pNtk       = p->pNtk;
+    pWin->pCare      = p->pCare;
+    pWin->vSuppsInv  = p->vSuppsInv;
+    pWin->nFaninMax  = p->nFaninMax;
+    pWin->iResNode   = -1;
+    pWin->vResFanins = Vec_IntAlloc( MFS_FANIN_MAX );
+    pWin->vResTruth  = Vec_IntAlloc( 1 << (MFS_FANIN_MAX-5) );
+    return pWin;
+}
+void Abc_NtkMfsParWinStop( Mfs_Man_t * p, Mfs_Man_t * pWin )
+{
+    p->nNodesTried += pWin->nNodesTried;
+    p->nNodesResub += pWin->nNodesResub;
+    p->nNodesBad   += pWin->nNodesBad;
+    p->nTotalDivs  += pWin->nTotalDivs;
+    p->nMaxDivs    += pWin->nMaxDivs;
+    p->nTimeOuts   += pWin->nTimeOuts;
+    p->nSatCalls   += pWin->nSatCalls;
+    p->nSatCexes   += pWin->nSatCexes;
+    p->nTryRemoves += pWin->nTryRemoves;
+    p->nTryResubs  += pWin->nTryResubs;
+    p->nRemoves    += pWin->nRemoves;
+    p->nResubs     += pWin->nResubs;
+    p->timeWin     += pWin->timeWin;
+    p->timeDiv     += pWin->timeDiv;
+    p->timeAig     += pWin->timeAig;
+    p->timeCnf     += pWin->timeCnf;
+    pWin->pCare     = NULL;
+    pWin->vSuppsInv = NULL;
+    Mfs_ManStop( pWin );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks if the objects are claimed by another window of the batch.]
+
+  Description [The CIs are never changed by an update and are not claimed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_NtkMfsParOverlaps( Vec_Ptr_t * vObjs, Vec_Int_t * vStamps, int Stamp )
+{
+    Abc_Obj_t * pObj;
+    int i;
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+        if ( Vec_IntEntry(vStamps, Abc_ObjId(pObj)) == Stamp )
+            return 1;
+    return 0;
+}
+static inline void Abc_NtkMfsParClaim( Vec_Ptr_t * vObjs, Vec_Int_t * vStamps, int Stamp )
+{
+    Abc_Obj_t * pObj;
+    int i;
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+        if ( !Abc_ObjIsCi(pObj) )
+            Vec_IntWriteEntry( vStamps, Abc_ObjId(pObj), Stamp );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the nodes whose functions may be changed by the update.]
+
+  Description [These are the node and its transitive fanout in the window. 
+  The update may also remove the MFFC of the node, which is detected when 
+  the updates of the other windows are committed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsParCollectTfo( Mfs_Man_t * p, Abc_Obj_t * pNode, Vec_Ptr_t * vTfo )
+{
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k;
+    Vec_PtrClear( vTfo );
+    Abc_NtkIncrementTravId( p->pNtk );
+    Abc_NodeSetTravIdCurrent( pNode );
+    Vec_PtrPush( vTfo, pNode );
+    // the window nodes are in the topological order
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vNodes, pObj, i )
+    {
+        if ( Abc_NodeIsTravIdCurrent(pObj) )
+            continue;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            if ( Abc_NodeIsTravIdCurrent(pFanin) )
+                break;
+        if ( k == Abc_ObjFaninNum(pObj) )
+            continue;
+        Abc_NodeSetTravIdCurrent( pObj );
+        Vec_PtrPush( vTfo, pObj );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the window of the node.]
+
+  Description [Follows Abc_NtkMfsResub() up to the construction of the
+  CNF. The window is accepted if it does not read the nodes that may be 
+  changed by the other windows of the current batch and if its update 
+  does not change the nodes read by them. Returns 1 if the window is 
+  ready, 0 if the node is skipped, and -1 if the window conflicts with 
+  another window of the current batch.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMfsParWinPrepare( Mfs_Man_t * p, Abc_Obj_t * pNode, Vec_Int_t * vRead, Vec_Int_t * vChanged, Vec_Ptr_t * vTfo, int Stamp )
+{
+    abctime clk;
+    // prepare data structure for this node
+    Mfs_ManClean( p );
+    p->iResNode = -1;
+    // compute window roots, window support, and window nodes
+clk = Abc_Clock();
+    p->vRoots = Abc_MfsComputeRoots( pNode, p->pPars->nWinTfoLevs, p->pPars->nFanoutsMax );
+    p->vSupp  = Abc_NtkNodeSupport( p->pNtk, (Abc_Obj_t **)Vec_PtrArray(p->vRoots), Vec_PtrSize(p->vRoots) );
+    p->vNodes = Abc_NtkDfsNodes( p->pNtk, (Abc_Obj_t **)Vec_PtrArray(p->vRoots), Vec_PtrSize(p->vRoots) );
+p->timeWin += Abc_Clock() - clk;
+    if ( p->pPars->nWinMax && Vec_PtrSize(p->vNodes) > p->pPars->nWinMax )
+    {
+        p->nNodesTried++;
+        p->nMaxDivs++;
+        return 0;
+    }
+    if ( Abc_NtkMfsParOverlaps(p->vNodes, vChanged, Stamp) )
+        return -1;
+    Abc_NtkMfsParCollectTfo( p, pNode, vTfo );
+    if ( Abc_NtkMfsParOverlaps(vTfo, vRead, Stamp) )
+        return -1;
+    // compute the divisors of the window
+clk = Abc_Clock();
+    p->vDivs  = Abc_MfsComputeDivisors( p, pNode, Abc_ObjRequiredLevel(pNode) - 1 );
+p->timeDiv += Abc_Clock() - clk;
+    if ( Abc_NtkMfsParOverlaps(p->vDivs, vChanged, Stamp) )
+        return -1;
+    // the window is accepted
+    Abc_NtkMfsParClaim( p->vNodes, vRead, Stamp );
+    Abc_NtkMfsParClaim( p->vDivs,  vRead, Stamp );
+    Abc_NtkMfsParClaim( vTfo,      vChanged, Stamp );
+    p->nNodesTried++;
+    p->nTotalDivs += Vec_PtrSize(p->vDivs) - Abc_ObjFaninNum(pNode);
+    // construct AIG for the window
+clk = Abc_Clock();
+    p->pAigWin = Abc_NtkConstructAig( p, pNode );
+p->timeAig += Abc_Clock() - clk;
+    // translate it into CNF
+clk = Abc_Clock();
+    p->pCnf = Cnf_DeriveSimple( p->pAigWin, 1 + Vec_PtrSize(p->vDivs) );
+p->timeCnf += Abc_Clock() - clk;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the window of the node.]
+
+  Description [Reads the network but does not change it. The update, if
+  any, is recorded in the window manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsParWinSolve( Mfs_ParThData_t * pThData )
+{
+    Mfs_Man_t * p = (Mfs_Man_t *)Vec_PtrEntry( pThData->vWins, pThData->iWin );
+    Abc_Obj_t * pNode = (Abc_Obj_t *)Vec_PtrEntry( pThData->vNodes, pThData->iWin );
+    abctime clk = Abc_Clock();
+    p->pSat = Abc_MfsCreateSolverResub( p, NULL, 0, 0 );
+    if ( p->pSat == NULL )
+        p->nNodesBad++;
+    else
+    {
+        Abc_NtkMfsResubNode( p, pNode );
+        if ( p->pPars->fMoreEffort && p->iResNode == -1 )
+            Abc_NtkMfsResubNode2( p, pNode );
+    }
+    pThData->clkUsed += Abc_Clock() - clk;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+int Abc_NtkMfsPar( Mfs_Man_t * p )
+{
+    Abc_Print( 0, "Multi-threaded resubstitution is not available without pthreads.\n" );
+    return 0;
+}
+
+#else // pthreads are used
+
+void * Abc_NtkMfsParWorkerThread( void * pArg )
+{
+    Mfs_ParThData_t * pThData = (Mfs_ParThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->iWin == -1 )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Abc_NtkMfsParWinSolve( pThData );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the windows of one batch using the running threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsParSolve( Mfs_ParThData_t * ThData, int nWins, int nProcs )
+{
+    int i, iWin = 0, fRunning = 1;
+    while ( fRunning )
+    {
+        fRunning = 0;
+        for ( i = 0; i < nProcs; i++ )
+        {
+            if ( ThData[i].fWorking )
+            {
+                fRunning = 1;
+                continue;
+            }
+            if ( iWin == nWins )
+                continue;
+            ThData[i].iWin = iWin++;
+            ThData[i].fWorking = 1;
+            fRunning = 1;
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Applies the update recorded in the window manager.]
+
+  Description [The windows of one batch do not overlap, so the update of
+  one window does not change the functions of the nodes of other windows.
+  The update is still rejected if some of its nodes have been removed by
+  an earlier update of the batch or if it would increase the level of
+  the node beyond its required level. Returns 1 if the network is updated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMfsParCommit( Mfs_Man_t * p, Mfs_Man_t * pWin )
+{
+    extern Hop_Obj_t * Kit_GraphToHop( Hop_Man_t * pMan, Kit_Graph_t * pGraph );
+    Abc_Obj_t * pNode, * pFanin;
+    Kit_Graph_t * pGraph;
+    Hop_Obj_t * pFunc;
+    int i, iFanin;
+    if ( pWin->iResNode == -1 )
+        return 0;
+    pNode = Abc_NtkObj( p->pNtk, pWin->iResNode );
+    if ( pNode == NULL )
+    {
+        p->nParConfs++;
+        return 0;
+    }
+    Vec_PtrClear( p->vMfsFanins );
+    Vec_IntForEachEntry( pWin->vResFanins, iFanin, i )
+    {
+        pFanin = Abc_NtkObj( p->pNtk, iFanin );
+        if ( pFanin == NULL || (Abc_NodeFindFanin(pNode, pFanin) == -1 && Abc_ObjLevel(pFanin) >= Abc_ObjRequiredLevel(pNode)) )
+        {
+            p->nParConfs++;
+            return 0;
+        }
+        Vec_PtrPush( p->vMfsFanins, pFanin );
+    }
+    // transform the truth table into AIG
+    pGraph = Kit_TruthToGraph( (unsigned *)Vec_IntArray(pWin->vResTruth), Vec_IntSize(pWin->vResFanins), p->vMem );
+    pFunc = Kit_GraphToHop( (Hop_Man_t *)p->pNtk->pManFunc, pGraph );
+    Kit_GraphFree( pGraph );
+    // update the network
+    Abc_NtkMfsUpdateNetwork( p, pNode, p->vMfsFanins, pFunc );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution using several threads.]
+
+  Description [Nodes are processed in batches. For each batch, the windows
+  of the nodes are computed in the main thread, and only the windows that
+  do not conflict with the previously accepted windows of the batch are
+  kept; the remaining nodes are tried in the next batch. To bound the work
+  spent on the windows computed again, a batch stops trying new nodes 
+  after as many conflicts as it has windows. The windows are
+  solved concurrently, each with its own SAT solver, and the updates are
+  applied to the network in the main thread in the order of the nodes.
+  Returns 1 if the resubstitution has been performed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMfsPar( Mfs_Man_t * p )
+{
+    Mfs_ParThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Mfs_Par_t ParsWin, * pParsWin = &ParsWin;
+    Abc_Ntk_t * pNtk = p->pNtk;
+    ProgressBar * pProgress;
+    Vec_Ptr_t * vWins, * vNodes, * vTfo;
+    Vec_Int_t * vRead, * vChanged, * vDelayed, * vDelayedNext, * vTemp;
+    Mfs_Man_t * pWin;
+    Abc_Obj_t * pObj;
+    int nProcs = p->pPars->nProcs;
+    int i, k, status, iObj, iNext = 0, nWins, nConfs, Stamp = 0, RetValue;
+    abctime clk;
+    if ( nProcs > PAR_THR_MAX )
+    {
+        Abc_Print( 0, "The number of threads (%d) exceeds the precompiled limit (%d).\n", nProcs, PAR_THR_MAX );
+        nProcs = PAR_THR_MAX;
+    }
+    // start the window managers
+    ParsWin = *p->pPars;
+    pParsWin->fVerbose     = 0;
+    pParsWin->fVeryVerbose = 0;
+    vWins  = Vec_PtrAlloc( MFS_PAR_WINS * nProcs );
+    vNodes = Vec_PtrStart( MFS_PAR_WINS * nProcs );
+    for ( i = 0; i < MFS_PAR_WINS * nProcs; i++ )
+        Vec_PtrPush( vWins, Abc_NtkMfsParWinStart(p, pParsWin) );
+    vTfo         = Vec_PtrAlloc( 100 );
+    vRead        = Vec_IntAlloc( 0 );
+    vChanged     = Vec_IntAlloc( 0 );
+    vDelayed     = Vec_IntAlloc( 100 );
+    vDelayedNext = Vec_IntAlloc( 100 );
+    // start the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Mfs_ParThData_t) );
+        ThData[i].vWins  = vWins;
+        ThData[i].vNodes = vNodes;
+        ThData[i].iWin   = -1;
+        status = pthread_create( WorkerThread + i, NULL, Abc_NtkMfsParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    pProgress = Extra_ProgressBarStart( stdout, Abc_NtkObjNumMax(pNtk) );
+    while ( 1 )
+    {
+        // collect the windows of this batch
+        Stamp++;
+        Vec_IntFillExtra( vRead,    Abc_NtkObjNumMax(pNtk), 0 );
+        Vec_IntFillExtra( vChanged, Abc_NtkObjNumMax(pNtk), 0 );
+        Vec_IntClear( vDelayedNext );
+        nWins = nConfs = 0;
+        for ( k = 0; ; k++ )
+        {
+            if ( k < Vec_IntSize(vDelayed) )
+                iObj = Vec_IntEntry( vDelayed, k );
+            else if ( nWins < Vec_PtrSize(vWins) && nConfs < Vec_PtrSize(vWins) && iNext < Abc_NtkObjNumMax(pNtk) )
+                iObj = iNext++;
+            else
+                break;
+            // when the batch is full or has too many conflicts, the rest of the delayed nodes go to the next batch
+            if ( nWins == Vec_PtrSize(vWins) || nConfs == Vec_PtrSize(vWins) )
+            {
+                Vec_IntPush( vDelayedNext, iObj );
+                continue;
+            }
+            pObj = Abc_NtkObj( pNtk, iObj );
+            if ( pObj == NULL || !Abc_ObjIsNode(pObj) )
+                continue;
+            if ( p->pPars->nDepthMax && (int)pObj->Level > p->pPars->nDepthMax )
+                continue;
+            if ( Abc_ObjFaninNum(pObj) < 2 || Abc_ObjFaninNum(pObj) > p->nFaninMax )
+                continue;
+            pWin = (Mfs_Man_t *)Vec_PtrEntry( vWins, nWins );
+            RetValue = Abc_NtkMfsParWinPrepare( pWin, pObj, vRead, vChanged, vTfo, Stamp );
+            if ( RetValue == -1 )
+                Vec_IntPush( vDelayedNext, iObj ), nConfs++;
+            else if ( RetValue == 1 )
+                Vec_PtrWriteEntry( vNodes, nWins++, pObj );
+        }
+        vTemp = vDelayed; vDelayed = vDelayedNext; vDelayedNext = vTemp;
+        if ( nWins == 0 )
+            break;
+        p->nParWins += nWins;
+        // solve the windows
+clk = Abc_Clock();
+        Abc_NtkMfsParSolve( ThData, nWins, nProcs );
+p->timeSat += Abc_Clock() - clk;
+        // apply the updates
+clk = Abc_Clock();
+        for ( i = 0; i < nWins; i++ )
+            Abc_NtkMfsParCommit( p, (Mfs_Man_t *)Vec_PtrEntry(vWins, i) );
+p->timeUpd += Abc_Clock() - clk;
+        if ( !p->pPars->fVeryVerbose )
+            Extra_ProgressBarUpdate( pProgress, iNext, NULL );
+    }
+    assert( Vec_IntSize(vDelayed) == 0 );
+    Extra_ProgressBarStop( pProgress );
+    // stop the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        assert( !ThData[i].fWorking );
+        ThData[i].iWin = -1;
+        ThData[i].fWorking = 1;
+        pthread_join( WorkerThread[i], NULL );
+    }
+    if ( p->pPars->fVerbose )
+        for ( i = 0; i < nProcs; i++ )
+        {
+            Abc_Print( 1, "Thread %d : ", i );
+            Abc_PrintTime( 1, "Time", ThData[i].clkUsed );
+        }
+    Vec_PtrForEachEntry( Mfs_Man_t *, vWins, pWin, i )
+        Abc_NtkMfsParWinStop( p, pWin );
+    Vec_PtrFree( vWins );
+    Vec_PtrFree( vNodes );
+    Vec_PtrFree( vTfo );
+    Vec_IntFree( vRead );
+    Vec_IntFree( vChanged );
+    Vec_IntFree( vDelayed );
+    Vec_IntFree( vDelayedNext );
+    return 1;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -58,6 +58,48 @@ void Abc_NtkMfsUpdateNetwork( Mfs_Man_t * p, Abc_Obj_t * pObj, Vec_Ptr_t * vMfsF
     Abc_NtkUpdate( pObj, pObjNew, p->vLevels );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the new function of the node and updates the network.]
+
+  Description [The new fanins are in p->vMfsFanins. When the manager 
+  records the updates (p->vResTruth is allocated), the network is not 
+  changed; instead, the node, the fanins, and the truth table are saved,
+  to be applied later by Abc_NtkMfsParCommit().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMfsUpdateNode( Mfs_Man_t * p, Abc_Obj_t * pNode, int * pCands, int nCands )
+{
+    Abc_Obj_t * pFanin;
+    Hop_Obj_t * pFunc;
+    unsigned * puTruth;
+    int i;
+    assert( Vec_PtrSize(p->vMfsFanins) == nCands );
+    if ( p->vResTruth == NULL )
+    {
+        pFunc = Abc_NtkMfsInterplate( p, pCands, nCands );
+        if ( pFunc == NULL )
+            return 0;
+        Abc_NtkMfsUpdateNetwork( p, pNode, p->vMfsFanins, pFunc );
+        return 1;
+    }
+    puTruth = Abc_NtkMfsInterplateFunc( p, pCands, nCands );
+    if ( puTruth == NULL )
+        return 0;
+    p->iResNode = Abc_ObjId( pNode );
+    Vec_IntClear( p->vResFanins );
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vMfsFanins, pFanin, i )
+        Vec_IntPush( p->vResFanins, Abc_ObjId(pFanin) );
+    Vec_IntClear( p->vResTruth );
+    for ( i = 0; i < Abc_TruthWordNum(nCands); i++ )
+        Vec_IntPush( p->vResTruth, (int)puTruth[i] );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Prints resub candidate stats.]
@@ -170,7 +212,6 @@ int Abc_NtkMfsSolveSatResub( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int f
     int RetValue, iVar, i, nCands, nWords, w;
     abctime clk;
     Abc_Obj_t * pFanin;
-    Hop_Obj_t * pFunc;
     assert( iFanin >= 0 );
     p->nTryRemoves++;
 
@@ -209,12 +250,9 @@ int Abc_NtkMfsSolveSatResub( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int f
         if ( fSkipUpdate )
             return 1;
 clk = Abc_Clock();
-        // derive the function
-        pFunc = Abc_NtkMfsInterplate( p, pCands, nCands );
-        if ( pFunc == NULL )
+        // derive the function and update the network
+        if ( !Abc_NtkMfsUpdateNode( p, pNode, pCands, nCands ) )
             return 0;
-        // update the network
-        Abc_NtkMfsUpdateNetwork( p, pNode, p->vMfsFanins, pFunc );
 p->timeInt += Abc_Clock() - clk;
         p->nRemoves++;
         return 1;
@@ -286,13 +324,10 @@ p->timeInt += Abc_Clock() - clk;
             if ( fSkipUpdate )
                 return 1;
 clk = Abc_Clock();
-            // derive the function
-            pFunc = Abc_NtkMfsInterplate( p, pCands, nCands+1 );
-            if ( pFunc == NULL )
-                return 0;
-            // update the network
+            // derive the function and update the network
             Vec_PtrPush( p->vMfsFanins, Vec_PtrEntry(p->vDivs, iVar) );
-            Abc_NtkMfsUpdateNetwork( p, pNode, p->vMfsFanins, pFunc );
+            if ( !Abc_NtkMfsUpdateNode( p, pNode, pCands, nCands+1 ) )
+                return 0;
 p->timeInt += Abc_Clock() - clk;
             p->nResubs++;
             return 1;
@@ -324,7 +359,6 @@ int Abc_NtkMfsSolveSatResub2( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int
     int RetValue, iVar, iVar2, i, w, nCands, nWords, fBreak;
     abctime clk;
     Abc_Obj_t * pFanin;
-    Hop_Obj_t * pFunc;
     assert( iFanin >= 0 );
     assert( iFanin2 >= 0 || iFanin2 == -1 );
 
@@ -361,12 +395,9 @@ int Abc_NtkMfsSolveSatResub2( Mfs_Man_t * p, Abc_Obj_t * pNode, int iFanin, int
         p->nNodesResub++;
         p->nNodesGainedLevel++;
 clk = Abc_Clock();
-        // derive the function
-        pFunc = Abc_NtkMfsInterplate( p, pCands, nCands );
-        if ( pFunc == NULL )
+        // derive the function and update the network
+        if ( !Abc_NtkMfsUpdateNode( p, pNode, pCands, nCands ) )
             return 0;
-        // update the network
-        Abc_NtkMfsUpdateNetwork( p, pNode, p->vMfsFanins, pFunc );
 p->timeInt += Abc_Clock() - clk;
         return 1;
     }
@@ -455,15 +486,12 @@ p->timeInt += Abc_Clock() - clk;
             p->nNodesResub++;
             p->nNodesGainedLevel++;
 clk = Abc_Clock();
-            // derive the function
-            pFunc = Abc_NtkMfsInterplate( p, pCands, nCands+2 );
-            if ( pFunc == NULL )
-                return 0;
-            // update the network
+            // derive the function and update the network
             Vec_PtrPush( p->vMfsFanins, Vec_PtrEntry(p->vDivs, iVar2) );
             Vec_PtrPush( p->vMfsFanins, Vec_PtrEntry(p->vDivs, iVar) );
             assert( Vec_PtrSize(p->vMfsFanins) == nCands + 2 );
-            Abc_NtkMfsUpdateNetwork( p, pNode, p->vMfsFanins, pFunc );
+            if ( !Abc_NtkMfsUpdateNode( p, pNode, pCands, nCands+2 ) )
+                return 0;
 p->timeInt += Abc_Clock() - clk;
             return 1;
         }
@@ -80,6 +80,7 @@ static int         Abc_NtkMaxFlowBwdPath2_rec( Abc_Obj_t * pObj );
 static int         Abc_NtkMaxFlowFwdPath2_rec( Abc_Obj_t * pObj );
 //static int         Abc_NtkMaxFlowBwdPath3_rec( Abc_Obj_t * pObj );
 static int         Abc_NtkMaxFlowFwdPath3_rec( Abc_Obj_t * pObj, Abc_Obj_t * pPrev, int fFanin );
+static int         Abc_NtkMaxFlowAugment( Abc_Ntk_t * pNtk, int fForward );
 static Vec_Ptr_t * Abc_NtkMaxFlowMinCut( Abc_Ntk_t * pNtk, int fForward );
 static void        Abc_NtkMaxFlowMinCutUpdate( Abc_Ntk_t * pNtk, Vec_Ptr_t * vMinCut, int fForward );
 static int         Abc_NtkMaxFlowVerifyCut( Abc_Ntk_t * pNtk, Vec_Ptr_t * vMinCut, int fForward );
@@ -113,7 +114,7 @@ void Abc_NtkMaxFlowTest( Abc_Ntk_t * pNtk )
     Abc_NtkForEachLatch( pNtk, pObj, i )
         pObj->fMarkA = Abc_ObjFanin0(pObj)->fMarkA = 1;
 //        Abc_ObjFanin0(pObj)->fMarkA = 1;
-    vMinCut = Abc_NtkMaxFlow( pNtk, 1, 1 );
+    vMinCut = Abc_NtkMaxFlow( pNtk, 1, 0, 1 );
     Vec_PtrFree( vMinCut );
     Abc_NtkCleanMarkA( pNtk );
 
@@ -123,7 +124,7 @@ void Abc_NtkMaxFlowTest( Abc_Ntk_t * pNtk )
     Abc_NtkForEachLatch( pNtk, pObj, i )
         pObj->fMarkA = Abc_ObjFanout0(pObj)->fMarkA = 1;
 //        Abc_ObjFanout0(pObj)->fMarkA = 1;
-    vMinCut = Abc_NtkMaxFlow( pNtk, 0, 1 );
+    vMinCut = Abc_NtkMaxFlow( pNtk, 0, 0, 1 );
     Vec_PtrFree( vMinCut );
     Abc_NtkCleanMarkA( pNtk );
 
@@ -131,21 +132,20 @@ void Abc_NtkMaxFlowTest( Abc_Ntk_t * pNtk )
 
 /**Function*************************************************************
 
-  Synopsis    [Implementation of max-flow/min-cut computation.]
+  Synopsis    [Computes max-flow using augmenting paths.]
 
-  Description []
+  Description [Marks the nodes reachable from the latches in the residual
+  network with the current traversal ID. Returns the value of the flow.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Ptr_t * Abc_NtkMaxFlow( Abc_Ntk_t * pNtk, int fForward, int fVerbose )
+int Abc_NtkMaxFlowAugment( Abc_Ntk_t * pNtk, int fForward )
 {
-    Vec_Ptr_t * vMinCut;
     Abc_Obj_t * pLatch;
     int Flow, FlowCur, RetValue, i;
-    abctime clk = Abc_Clock();
     int fUseDirectedFlow = 1;
 
     // find the max-flow
@@ -217,6 +217,32 @@ Vec_Ptr_t * Abc_NtkMaxFlow( Abc_Ntk_t * pNtk, int fForward, int fVerbose )
         }
         assert( RetValue == 0 );
     }
+    return Flow;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Implementation of max-flow/min-cut computation.]
+
+  Description [Uses augmenting paths or, if fPushRelabel is set, 
+  the push-relabel algorithm.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Abc_NtkMaxFlow( Abc_Ntk_t * pNtk, int fForward, int fPushRelabel, int fVerbose )
+{
+    Vec_Ptr_t * vMinCut;
+    int Flow;
+    abctime clk = Abc_Clock();
+
+    // find the max-flow and mark the nodes reachable from the latches
+    if ( fPushRelabel )
+        Flow = Abc_NtkMaxFlowPushRelabel( pNtk, fForward, 0 );
+    else
+        Flow = Abc_NtkMaxFlowAugment( pNtk, fForward );
 
     // find the min-cut with the smallest volume
     vMinCut = Abc_NtkMaxFlowMinCut( pNtk, fForward );
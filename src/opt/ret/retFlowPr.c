@@ -0,0 +1,585 @@
+/**CFile****************************************************************
+
+  FileName    [retFlowPr.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Retiming package.]
+
+  Synopsis    [Push-relabel maximum flow (min-area retiming).]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - Oct 31, 2006.]
+
+  Revision    [$Id: retFlowPr.c,v 1.00 2006/10/31 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "retInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The flow network is derived from the part of the logic network that
+// is reachable from the latches before reaching the terminal nodes (fMarkA).
+// The k-th collected object is split into the input vertex (2*k) and 
+// the output vertex (2*k+1) connected by an arc of unit capacity. The 
+// output vertex of a node is connected to the input vertices of its 
+// fanouts (forward flow) or its fanins (backward flow), while the output 
+// vertex of a terminal node is connected to the sink. The source is 
+// connected to the input vertices of the nodes next to the latches. 
+// The arcs are stored in the compressed (CSR) form with their reverse arcs.
+
+typedef struct Ret_Pr_t_ Ret_Pr_t;
+struct Ret_Pr_t_
+{
+    Vec_Ptr_t *  vObjs;       // the objects in the flow network
+    int *        pObj2Num;    // the number of each object in vObjs
+    int          nVerts;      // the number of vertices
+    int          nArcs;       // the number of arcs (including reverse arcs)
+    int          iSrc;        // the source vertex
+    int          iSnk;        // the sink vertex
+    int *        pStart;      // the first arc of each vertex
+    int *        pHead;       // the vertex the arc points to
+    int *        pRev;        // the reverse arc
+    int *        pCap;        // the residual capacity of the arc
+    char *       pFwd;        // marks the arcs of the original network
+    // push-relabel
+    int *        pHeight;     // the height of each vertex
+    int *        pExcess;     // the excess of each vertex
+    int *        pCur;        // the current arc of each vertex
+    int *        pNextAct;    // the next active vertex with the same height
+    int *        pNextAll;    // the next vertex with the same height
+    int *        pPrevAll;    // the previous vertex with the same height
+    int *        pBucketAct;  // the first active vertex with each height
+    int *        pBucketAll;  // the first vertex with each height
+    int *        pQueue;      // the BFS queue
+    int          hMaxAct;     // the largest height of an active vertex
+    int          hMaxAll;     // the largest height of a vertex
+    int          nWork;       // the work since the last global relabeling
+    // statistics
+    int          nPushes;
+    int          nRelabels;
+    int          nGaps;
+    int          nGlobals;
+};
+
+static inline int Ret_PrVertIn( Ret_Pr_t * p, Abc_Obj_t * pObj )  { return 2 * p->pObj2Num[pObj->Id];     }
+static inline int Ret_PrVertOut( Ret_Pr_t * p, Abc_Obj_t * pObj ) { return 2 * p->pObj2Num[pObj->Id] + 1; }
+static inline Abc_Obj_t * Ret_PrVertObj( Ret_Pr_t * p, int v )    { return (Abc_Obj_t *)Vec_PtrEntry( p->vObjs, v / 2 ); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one arc and its reverse arc.]
+
+  Description [When the fill pointers are not given, only counts the arcs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Ret_PrAddArc( Ret_Pr_t * p, int * pFill, int iFrom, int iTo )
+{
+    int a, r;
+    if ( pFill == NULL )
+    {
+        p->pStart[iFrom]++;
+        p->pStart[iTo]++;
+        return;
+    }
+    a = pFill[iFrom]++;
+    r = pFill[iTo]++;
+    p->pHead[a] = iTo;   p->pRev[a] = r;  p->pCap[a] = 1;  p->pFwd[a] = 1;
+    p->pHead[r] = iFrom; p->pRev[r] = a;  p->pCap[r] = 0;  p->pFwd[r] = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the objects reachable from the latches.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ret_PrCollectObjs( Ret_Pr_t * p, Abc_Ntk_t * pNtk, int fForward )
+{
+    Abc_Obj_t * pObj, * pNext;
+    int i, k;
+    p->vObjs = Vec_PtrAlloc( 1000 );
+    p->pObj2Num = ABC_FALLOC( int, Abc_NtkObjNumMax(pNtk) );
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+    {
+        pNext = fForward ? Abc_ObjFanout0(pObj) : Abc_ObjFanin0(pObj);
+        if ( p->pObj2Num[pNext->Id] >= 0 )
+            continue;
+        p->pObj2Num[pNext->Id] = Vec_PtrSize( p->vObjs );
+        Vec_PtrPush( p->vObjs, pNext );
+    }
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vObjs, pObj, i )
+    {
+        if ( pObj->fMarkA )
+            continue;
+        if ( fForward )
+        {
+            Abc_ObjForEachFanout( pObj, pNext, k )
+                if ( p->pObj2Num[pNext->Id] == -1 )
+                {
+                    p->pObj2Num[pNext->Id] = Vec_PtrSize( p->vObjs );
+                    Vec_PtrPush( p->vObjs, pNext );
+                }
+        }
+        else
+        {
+            Abc_ObjForEachFanin( pObj, pNext, k )
+                if ( p->pObj2Num[pNext->Id] == -1 )
+                {
+                    p->pObj2Num[pNext->Id] = Vec_PtrSize( p->vObjs );
+                    Vec_PtrPush( p->vObjs, pNext );
+                }
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Visits the arcs of the flow network.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ret_PrCollectArcs( Ret_Pr_t * p, Abc_Ntk_t * pNtk, int fForward, int * pFill )
+{
+    Abc_Obj_t * pObj, * pNext;
+    int i, k;
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vObjs, pObj, i )
+    {
+        Ret_PrAddArc( p, pFill, Ret_PrVertIn(p, pObj), Ret_PrVertOut(p, pObj) );
+        if ( pObj->fMarkA )
+            Ret_PrAddArc( p, pFill, Ret_PrVertOut(p, pObj), p->iSnk );
+        else if ( fForward )
+        {
+            Abc_ObjForEachFanout( pObj, pNext, k )
+                Ret_PrAddArc( p, pFill, Ret_PrVertOut(p, pObj), Ret_PrVertIn(p, pNext) );
+        }
+        else
+        {
+            Abc_ObjForEachFanin( pObj, pNext, k )
+                Ret_PrAddArc( p, pFill, Ret_PrVertOut(p, pObj), Ret_PrVertIn(p, pNext) );
+        }
+    }
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+    {
+        pNext = fForward ? Abc_ObjFanout0(pObj) : Abc_ObjFanin0(pObj);
+        Ret_PrAddArc( p, pFill, p->iSrc, Ret_PrVertIn(p, pNext) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the flow network.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Ret_Pr_t * Ret_PrStart( Abc_Ntk_t * pNtk, int fForward )
+{
+    Ret_Pr_t * p;
+    int * pFill, i, nArcs;
+    p = ABC_CALLOC( Ret_Pr_t, 1 );
+    Ret_PrCollectObjs( p, pNtk, fForward );
+    p->nVerts = 2 * Vec_PtrSize(p->vObjs) + 2;
+    p->iSrc   = p->nVerts - 2;
+    p->iSnk   = p->nVerts - 1;
+    // count the arcs
+    p->pStart = ABC_CALLOC( int, p->nVerts + 1 );
+    Ret_PrCollectArcs( p, pNtk, fForward, NULL );
+    for ( nArcs = i = 0; i <= p->nVerts; i++ )
+    {
+        int Temp = p->pStart[i];
+        p->pStart[i] = nArcs;
+        nArcs += Temp;
+    }
+    p->nArcs = nArcs;
+    // add the arcs
+    p->pHead = ABC_ALLOC( int, nArcs );
+    p->pRev  = ABC_ALLOC( int, nArcs );
+    p->pCap  = ABC_ALLOC( int, nArcs );
+    p->pFwd  = ABC_ALLOC( char, nArcs );
+    pFill    = ABC_ALLOC( int, p->nVerts );
+    memcpy( pFill, p->pStart, sizeof(int) * p->nVerts );
+    Ret_PrCollectArcs( p, pNtk, fForward, pFill );
+    for ( i = 0; i < p->nVerts; i++ )
+        assert( pFill[i] == p->pStart[i+1] );
+    ABC_FREE( pFill );
+    // start the push-relabel data
+    p->pHeight    = ABC_ALLOC( int, p->nVerts );
+    p->pExcess    = ABC_CALLOC( int, p->nVerts );
+    p->pCur       = ABC_ALLOC( int, p->nVerts );
+    p->pNextAct   = ABC_ALLOC( int, p->nVerts );
+    p->pNextAll   = ABC_ALLOC( int, p->nVerts );
+    p->pPrevAll   = ABC_ALLOC( int, p->nVerts );
+    p->pBucketAct = ABC_ALLOC( int, p->nVerts + 1 );
+    p->pBucketAll = ABC_ALLOC( int, p->nVerts + 1 );
+    p->pQueue     = ABC_ALLOC( int, p->nVerts );
+    memcpy( p->pCur, p->pStart, sizeof(int) * p->nVerts );
+    return p;
+}
+static void Ret_PrStop( Ret_Pr_t * p )
+{
+    Vec_PtrFree( p->vObjs );
+    ABC_FREE( p->pObj2Num );
+    ABC_FREE( p->pStart );
+    ABC_FREE( p->pHead );
+    ABC_FREE( p->pRev );
+    ABC_FREE( p->pCap );
+    ABC_FREE( p->pFwd );
+    ABC_FREE( p->pHeight );
+    ABC_FREE( p->pExcess );
+    ABC_FREE( p->pCur );
+    ABC_FREE( p->pNextAct );
+    ABC_FREE( p->pNextAll );
+    ABC_FREE( p->pPrevAll );
+    ABC_FREE( p->pBucketAct );
+    ABC_FREE( p->pBucketAll );
+    ABC_FREE( p->pQueue );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Manipulates the height buckets.]
+
+  Description [Vertices whose height is nVerts cannot reach the sink
+  and do not belong to any bucket.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Ret_PrBucketAdd( Ret_Pr_t * p, int v )
+{
+    int h = p->pHeight[v];
+    assert( h < p->nVerts );
+    p->pPrevAll[v] = -1;
+    p->pNextAll[v] = p->pBucketAll[h];
+    if ( p->pBucketAll[h] >= 0 )
+        p->pPrevAll[p->pBucketAll[h]] = v;
+    p->pBucketAll[h] = v;
+    p->hMaxAll = Abc_MaxInt( p->hMaxAll, h );
+}
+static inline void Ret_PrBucketRemove( Ret_Pr_t * p, int v )
+{
+    int h = p->pHeight[v];
+    if ( p->pPrevAll[v] >= 0 )
+        p->pNextAll[p->pPrevAll[v]] = p->pNextAll[v];
+    else
+        p->pBucketAll[h] = p->pNextAll[v];
+    if ( p->pNextAll[v] >= 0 )
+        p->pPrevAll[p->pNextAll[v]] = p->pPrevAll[v];
+}
+static inline void Ret_PrActiveAdd( Ret_Pr_t * p, int v )
+{
+    int h = p->pHeight[v];
+    assert( h < p->nVerts );
+    p->pNextAct[v] = p->pBucketAct[h];
+    p->pBucketAct[h] = v;
+    p->hMaxAct = Abc_MaxInt( p->hMaxAct, h );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets exact distances to the sink using backward BFS.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ret_PrGlobalRelabel( Ret_Pr_t * p )
+{
+    int v, x, a, iHead = 0, iTail = 0;
+    for ( v = 0; v < p->nVerts; v++ )
+        p->pHeight[v] = p->nVerts;
+    for ( v = 0; v <= p->nVerts; v++ )
+        p->pBucketAct[v] = p->pBucketAll[v] = -1;
+    p->hMaxAct = p->hMaxAll = 0;
+    p->pHeight[p->iSnk] = 0;
+    p->pQueue[iTail++] = p->iSnk;
+    while ( iHead < iTail )
+    {
+        v = p->pQueue[iHead++];
+        Ret_PrBucketAdd( p, v );
+        if ( p->pExcess[v] > 0 && v != p->iSnk )
+            Ret_PrActiveAdd( p, v );
+        p->pCur[v] = p->pStart[v];
+        for ( a = p->pStart[v]; a < p->pStart[v+1]; a++ )
+        {
+            x = p->pHead[a];
+            if ( p->pCap[p->pRev[a]] == 0 || p->pHeight[x] < p->nVerts || x == p->iSrc )
+                continue;
+            p->pHeight[x] = p->pHeight[v] + 1;
+            p->pQueue[iTail++] = x;
+        }
+    }
+    p->nWork = 0;
+    p->nGlobals++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Relabels the vertex.]
+
+  Description [Applies the gap heuristic when the old height of the vertex
+  is no longer used. Returns the new height.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ret_PrRelabel( Ret_Pr_t * p, int v )
+{
+    int a, x, h, hOld = p->pHeight[v], hNew = p->nVerts;
+    p->nRelabels++;
+    p->nWork += 12 + p->pStart[v+1] - p->pStart[v];
+    Ret_PrBucketRemove( p, v );
+    if ( p->pBucketAll[hOld] == -1 )
+    {
+        // gap: the vertices above this height cannot reach the sink
+        for ( h = hOld + 1; h <= p->hMaxAll; h++ )
+        {
+            for ( x = p->pBucketAll[h]; x >= 0; x = p->pNextAll[x] )
+                p->pHeight[x] = p->nVerts;
+            p->pBucketAll[h] = p->pBucketAct[h] = -1;
+        }
+        p->hMaxAll = p->hMaxAct = hOld - 1;
+        p->pHeight[v] = p->nVerts;
+        p->nGaps++;
+        return p->nVerts;
+    }
+    for ( a = p->pStart[v]; a < p->pStart[v+1]; a++ )
+        if ( p->pCap[a] > 0 && hNew > p->pHeight[p->pHead[a]] + 1 )
+        {
+            hNew = p->pHeight[p->pHead[a]] + 1;
+            p->pCur[v] = a;
+        }
+    p->pHeight[v] = Abc_MinInt( hNew, p->nVerts );
+    if ( p->pHeight[v] < p->nVerts )
+        Ret_PrBucketAdd( p, v );
+    return p->pHeight[v];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Pushes the excess of the vertex along admissible arcs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ret_PrDischarge( Ret_Pr_t * p, int v )
+{
+    int a, x, d, h = p->pHeight[v];
+    while ( p->pExcess[v] > 0 )
+    {
+        for ( a = p->pCur[v]; a < p->pStart[v+1]; a++ )
+        {
+            x = p->pHead[a];
+            if ( p->pCap[a] == 0 || p->pHeight[x] != h - 1 )
+                continue;
+            d = Abc_MinInt( p->pExcess[v], p->pCap[a] );
+            p->pCap[a] -= d;
+            p->pCap[p->pRev[a]] += d;
+            if ( p->pExcess[x] == 0 && x != p->iSnk )
+                Ret_PrActiveAdd( p, x );
+            p->pExcess[x] += d;
+            p->pExcess[v] -= d;
+            p->nPushes++;
+            if ( p->pExcess[v] == 0 )
+                break;
+        }
+        p->pCur[v] = Abc_MinInt( a, p->pStart[v+1] - 1 );
+        if ( p->pExcess[v] == 0 )
+            break;
+        h = Ret_PrRelabel( p, v );
+        if ( h == p->nVerts )
+            break;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the excess of the vertices back to the source.]
+
+  Description [After the first phase, some vertices that cannot reach
+  the sink may still have excess. Because the network is acyclic, the
+  excess can be moved back along the arcs carrying flow.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ret_PrReturnExcess( Ret_Pr_t * p )
+{
+    int v, x, a, d, nStack = 0;
+    for ( v = 0; v < p->nVerts; v++ )
+    {
+        p->pCur[v] = p->pStart[v];
+        if ( p->pExcess[v] > 0 && v != p->iSrc && v != p->iSnk )
+            p->pQueue[nStack++] = v;
+    }
+    while ( nStack > 0 )
+    {
+        v = p->pQueue[--nStack];
+        for ( a = p->pCur[v]; p->pExcess[v] > 0; a++ )
+        {
+            assert( a < p->pStart[v+1] );
+            if ( p->pFwd[a] || p->pCap[a] == 0 )
+                continue;
+            x = p->pHead[a];
+            d = Abc_MinInt( p->pExcess[v], p->pCap[a] );
+            p->pCap[a] -= d;
+            p->pCap[p->pRev[a]] += d;
+            if ( p->pExcess[x] == 0 && x != p->iSrc )
+                p->pQueue[nStack++] = x;
+            p->pExcess[x] += d;
+            p->pExcess[v] -= d;
+        }
+        p->pCur[v] = a;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the maximum flow using push-relabel.]
+
+  Description [Uses the highest-label selection rule with the gap and
+  global relabeling heuristics. On return, the paths are recorded in
+  the pCopy fields of the objects in the same way as by the augmenting-
+  path procedures in retFlow.c, and the objects whose input vertices are
+  reachable from the latches in the residual network are marked with the
+  current traversal ID. Returns the value of the flow.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMaxFlowPushRelabel( Abc_Ntk_t * pNtk, int fForward, int fVerbose )
+{
+    Ret_Pr_t * p;
+    Abc_Obj_t * pObj, * pNext;
+    int i, v, a, x, Flow, iHead = 0, iTail = 0;
+    abctime clk = Abc_Clock();
+    p = Ret_PrStart( pNtk, fForward );
+    // saturate the arcs leaving the source
+    for ( a = p->pStart[p->iSrc]; a < p->pStart[p->iSrc+1]; a++ )
+    {
+        p->pCap[a] = 0;
+        p->pCap[p->pRev[a]] = 1;
+        p->pExcess[p->pHead[a]]++;
+    }
+    // find the maximum preflow
+    Ret_PrGlobalRelabel( p );
+    while ( p->hMaxAct >= 0 )
+    {
+        v = p->pBucketAct[p->hMaxAct];
+        if ( v == -1 )
+        {
+            p->hMaxAct--;
+            continue;
+        }
+        p->pBucketAct[p->hMaxAct] = p->pNextAct[v];
+        Ret_PrDischarge( p, v );
+        if ( p->nWork > 6 * p->nVerts + p->nArcs )
+            Ret_PrGlobalRelabel( p );
+    }
+    Flow = p->pExcess[p->iSnk];
+    // convert the preflow into a flow
+    Ret_PrReturnExcess( p );
+    // record the paths
+    Abc_NtkCleanCopy( pNtk );
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vObjs, pObj, i )
+    {
+        v = Ret_PrVertOut( p, pObj );
+        for ( a = p->pStart[v]; a < p->pStart[v+1]; a++ )
+            if ( p->pFwd[a] && p->pCap[a] == 0 )
+                break;
+        if ( a == p->pStart[v+1] )
+            continue;
+        x = p->pHead[a];
+        pObj->pCopy = (x == p->iSnk) ? (Abc_Obj_t *)1 : Ret_PrVertObj( p, x );
+    }
+    // mark the objects reachable from the latches in the residual network
+    Abc_NtkIncrementTravId( pNtk );
+    for ( v = 0; v < p->nVerts; v++ )
+        p->pHeight[v] = 0;
+    Abc_NtkForEachLatch( pNtk, pObj, i )
+    {
+        pNext = fForward ? Abc_ObjFanout0(pObj) : Abc_ObjFanin0(pObj);
+        if ( p->pHeight[Ret_PrVertIn(p, pNext)] )
+            continue;
+        p->pHeight[Ret_PrVertIn(p, pNext)] = 1;
+        p->pQueue[iTail++] = Ret_PrVertIn(p, pNext);
+    }
+    while ( iHead < iTail )
+    {
+        v = p->pQueue[iHead++];
+        if ( (v & 1) == 0 )
+            Abc_NodeSetTravIdCurrent( Ret_PrVertObj(p, v) );
+        for ( a = p->pStart[v]; a < p->pStart[v+1]; a++ )
+        {
+            x = p->pHead[a];
+            if ( p->pCap[a] == 0 || p->pHeight[x] || x == p->iSrc || x == p->iSnk )
+                continue;
+            p->pHeight[x] = 1;
+            p->pQueue[iTail++] = x;
+        }
+    }
+    if ( fVerbose )
+    {
+        printf( "Push-relabel: V = %d. A = %d. Push = %d. Relabel = %d. Gap = %d. Global = %d.  ",
+            p->nVerts, p->nArcs/2, p->nPushes, p->nRelabels, p->nGaps, p->nGlobals );
+        ABC_PRT( "Time", Abc_Clock() - clk );
+    }
+    Ret_PrStop( p );
+    return Flow;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -21,6 +21,14 @@
 #include "rwt.h"
 #include "bool/deco/deco.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -33,6 +41,15 @@ static char *           s_pPhases = NULL;
 static char *           s_pPerms = NULL; 
 static unsigned char *  s_pMap = NULL;
 
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_RwtMutex = PTHREAD_MUTEX_INITIALIZER;
+static inline void Rwt_ManGlobalLock()   { pthread_mutex_lock( &s_RwtMutex );   }
+static inline void Rwt_ManGlobalUnlock() { pthread_mutex_unlock( &s_RwtMutex ); }
+#else
+static inline void Rwt_ManGlobalLock()   {}
+static inline void Rwt_ManGlobalUnlock() {}
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -50,8 +67,10 @@ static unsigned char *  s_pMap = NULL;
 ***********************************************************************/
 void Rwt_ManGlobalStart()
 { 
+    Rwt_ManGlobalLock();
     if ( s_puCanons == NULL )
         Extra_Truth4VarNPN( &s_puCanons, &s_pPhases, &s_pPerms, &s_pMap );
+    Rwt_ManGlobalUnlock();
 }
 
 /**Function*************************************************************
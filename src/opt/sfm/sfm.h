@@ -53,6 +53,7 @@ struct Sfm_Par_t_
     int             fRrOnly;       // perform redundance removal
     int             fArea;         // performs optimization for area
     int             fMoreEffort;   // performs high-affort minimization
+    int             fReuseSat;     // reuses the SAT solver across the windows
     int             fVerbose;      // enable basic stats
     int             fVeryVerbose;  // enable detailed stats
 };
@@ -54,6 +54,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
+    pPars->fReuseSat    =    0;  // reuses the SAT solver across the windows
     pPars->fVerbose     =    0;  // enable basic stats
     pPars->fVeryVerbose =    0;  // enable detailed stats
 }
@@ -80,6 +81,10 @@ void Sfm_NtkPrintStats( Sfm_Ntk_t * p )
     printf( "Resub  %6d out of %6d (%6.2f %%)   ", p->nResubs,  p->nTryResubs,  100.0*p->nResubs /Abc_MaxInt(1, p->nTryResubs)  );
     printf( "\n" );
 
+    if ( p->pPars->fReuseSat )
+        printf( "Reused SAT solver: variables = %d. clauses = %d. learned = %d. restarts = %d.\n",
+            sat_solver_nvars(p->pSat), sat_solver_nclauses(p->pSat), (int)p->pSat->stats.learnts, p->nSatRestarts );
+
     printf( "Reduction:   " );
     printf( "Nodes  %6d out of %6d (%6.2f %%)   ", p->nTotalNodesBeg-p->nTotalNodesEnd, p->nTotalNodesBeg, 100.0*(p->nTotalNodesBeg-p->nTotalNodesEnd)/Abc_MaxInt(1, p->nTotalNodesBeg) );
     printf( "Edges  %6d out of %6d (%6.2f %%)   ", p->nTotalEdgesBeg-p->nTotalEdgesEnd, p->nTotalEdgesBeg, 100.0*(p->nTotalEdgesBeg-p->nTotalEdgesEnd)/Abc_MaxInt(1, p->nTotalEdgesBeg) );
@@ -44,6 +44,7 @@ ABC_NAMESPACE_HEADER_START
 #define SFM_FANIN_MAX 6
 #define SFM_SAT_UNDEC 0x1234567812345678
 #define SFM_SAT_SAT   0x8765432187654321
+#define SFM_SAT_REUSE 4                 // restart the reused solver when it is this many times larger than the window
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -87,6 +88,9 @@ struct Sfm_Ntk_t_
     // SAT solving
     sat_solver *      pSat;        // SAT solver
     int               nSatVars;    // the number of variables
+    Vec_Int_t         vObj2Var;    // ObjId -> SatVar kept across the windows
+    int               iActWin;     // activation variable of the window
+    int               nSatRestarts;// the number of solver restarts
     int               nTryRemoves; // number of fanin removals
     int               nTryResubs;  // number of resubstitutions
     int               nRemoves;    // number of fanin removals
@@ -186,6 +190,7 @@ extern void         Sfm_TranslateCnf( Vec_Wec_t * vRes, Vec_Str_t * vCnf, Vec_In
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth );
+extern void         Sfm_NtkCleanVarsTfo_rec( Sfm_Ntk_t * p, int iNode );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
 extern word         Sfm_ComputeInterpolant( Sfm_Ntk_t * p );
@@ -209,6 +209,8 @@ void Sfm_NtkPrepare( Sfm_Ntk_t * p )
     p->vFaninMap = Vec_IntAlloc( 10 );
     p->pSat      = sat_solver_new();
     sat_solver_setnvars( p->pSat, p->pPars->nWinSizeMax );
+    if ( p->pPars->fReuseSat )
+        Vec_IntFill( &p->vObj2Var, p->nObjs, 0 );
 }
 void Sfm_NtkFree( Sfm_Ntk_t * p )
 {
@@ -226,6 +228,7 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     ABC_FREE( p->vTravIds2.pArray );
     ABC_FREE( p->vId2Var.pArray );
     ABC_FREE( p->vVar2Id.pArray );
+    ABC_FREE( p->vObj2Var.pArray );
     Vec_WecFree( p->vCnfs );
     Vec_IntFree( p->vCover );
     // other data
@@ -311,6 +314,15 @@ void Sfm_NtkUpdateLevelR_rec( Sfm_Ntk_t * p, int iNode )
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
         Sfm_NtkUpdateLevelR_rec( p, iFanin );
 }
+void Sfm_NtkCleanVarsTfo_rec( Sfm_Ntk_t * p, int iNode )
+{
+    int i, iFanout;
+    if ( Vec_IntEntry(&p->vObj2Var, iNode) == 0 )
+        return;
+    Vec_IntWriteEntry( &p->vObj2Var, iNode, 0 );
+    Sfm_ObjForEachFanout( p, iNode, iFanout, i )
+        Sfm_NtkCleanVarsTfo_rec( p, iFanout );
+}
 void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth )
 {
     int iFanin = Sfm_ObjFanin( p, iNode, f );
@@ -342,6 +354,9 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth
     // update truth table
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
     Sfm_TruthToCnf( uTruth, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
+    // the clauses of the node and its TFO loaded into the SAT solver are no longer valid
+    if ( Vec_IntSize(&p->vObj2Var) > 0 )
+        Sfm_NtkCleanVarsTfo_rec( p, iNode );
 }
 
 /**Function*************************************************************
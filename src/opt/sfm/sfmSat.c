@@ -40,6 +40,141 @@ static word s_Truths6[6] = {
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Converts a window into the SAT solver reused across windows.]
+
+  Description [Each object keeps its SAT variable in p->vObj2Var, and the
+  CNF of a node is loaded only once, so the consecutive windows sharing
+  the TFI also share the clauses and the learned clauses. When a node is
+  updated, the variables of the node and its TFO are reset, and their CNF
+  is loaded again using new variables. The TFO copy of each window gets
+  new variables; the clause requiring a difference at the roots depends
+  on the activation variable of the window, which is disabled before the
+  next window is loaded.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NtkNewSatVar( Sfm_Ntk_t * p )
+{
+    int iVar = sat_solver_nvars( p->pSat );
+    sat_solver_setnvars( p->pSat, iVar + 1 );
+    return iVar;
+}
+static inline int Sfm_NtkAddClauses( Sfm_Ntk_t * p )
+{
+    Vec_Int_t * vClause;
+    int k;
+    Vec_WecForEachLevel( p->vClauses, vClause, k )
+    {
+        if ( Vec_IntSize(vClause) == 0 )
+            break;
+        if ( !sat_solver_addclause( p->pSat, Vec_IntArray(vClause), Vec_IntArray(vClause) + Vec_IntSize(vClause) ) )
+            return 0;
+    }
+    return 1;
+}
+int Sfm_NtkWindowToSolverIncr( Sfm_Ntk_t * p )
+{
+    int RetValue, iNode = -1, iFanin, iVar, i, k;
+    abctime clk = Abc_Clock();
+    // disable the constraints of the previous window
+    if ( p->iActWin > 0 )
+    {
+        int Lit = Abc_Var2Lit( p->iActWin, 1 );
+        p->iActWin = 0;
+        RetValue = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+        assert( RetValue );
+    }
+    // restart the solver if it is inconsistent or has too many variables of the old windows
+    if ( p->iActWin < 0 || sat_solver_nvars(p->pSat) > SFM_SAT_REUSE * (Vec_IntSize(p->vOrder) + Vec_IntSize(p->vTfo)) + 100 )
+    {
+        sat_solver_restart( p->pSat );
+        Vec_IntFill( &p->vObj2Var, p->nObjs, 0 );
+        p->iActWin = 0;
+        p->nSatRestarts++;
+    }
+    if ( sat_solver_nvars(p->pSat) == 0 )
+        sat_solver_setnvars( p->pSat, 1 );
+    // load the nodes that are not loaded yet
+    Vec_IntForEachEntry( p->vOrder, iNode, i )
+    {
+        if ( Vec_IntEntry(&p->vObj2Var, iNode) == 0 )
+        {
+            Vec_IntWriteEntry( &p->vObj2Var, iNode, Sfm_NtkNewSatVar(p) );
+            if ( !Sfm_ObjIsPi(p, iNode) )
+            {
+                // collect fanin variables
+                Vec_IntClear( p->vFaninMap );
+                Sfm_ObjForEachFanin( p, iNode, iFanin, k )
+                {
+                    assert( Vec_IntEntry(&p->vObj2Var, iFanin) > 0 );
+                    Vec_IntPush( p->vFaninMap, Vec_IntEntry(&p->vObj2Var, iFanin) );
+                }
+                Vec_IntPush( p->vFaninMap, Vec_IntEntry(&p->vObj2Var, iNode) );
+                // generate CNF 
+                Sfm_TranslateCnf( p->vClauses, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode), p->vFaninMap, -1 );
+                if ( !Sfm_NtkAddClauses( p ) )
+                    return (p->iActWin = -1, 0);
+            }
+        }
+        Vec_IntWriteEntry( &p->vId2Var, iNode, Vec_IntEntry(&p->vObj2Var, iNode) );
+    }
+    // collect divisor variables
+    Vec_IntClear( p->vDivVars );
+    Vec_IntForEachEntry( p->vDivs, iNode, i )
+        Vec_IntPush( p->vDivVars, Sfm_ObjSatVar(p, iNode) );
+    if ( Vec_IntSize(p->vTfo) > 0 )
+    {
+        assert( p->pPars->nTfoLevMax > 0 );
+        assert( Vec_IntSize(p->vRoots) > 0 );
+        assert( Vec_IntEntry(p->vTfo, 0) != p->iPivotNode );
+        // collect variables of root nodes
+        Vec_IntClear( p->vLits );
+        Vec_IntForEachEntry( p->vRoots, iNode, i )
+            Vec_IntPush( p->vLits, Sfm_ObjSatVar(p, iNode) );
+        // assign new variables to the TFO nodes
+        Vec_IntForEachEntry( p->vTfo, iNode, i )
+            Vec_IntWriteEntry( &p->vId2Var, iNode, Sfm_NtkNewSatVar(p) );
+        // add CNF clauses for the TFO
+        Vec_IntForEachEntry( p->vTfo, iNode, i )
+        {
+            assert( Sfm_ObjIsNode(p, iNode) );
+            // collect fanin variables
+            Vec_IntClear( p->vFaninMap );
+            Sfm_ObjForEachFanin( p, iNode, iFanin, k )
+                Vec_IntPush( p->vFaninMap, Sfm_ObjSatVar(p, iFanin) );
+            Vec_IntPush( p->vFaninMap, Sfm_ObjSatVar(p, iNode) );
+            // generate CNF 
+            Sfm_TranslateCnf( p->vClauses, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode), p->vFaninMap, Sfm_ObjSatVar(p, p->iPivotNode) );
+            if ( !Sfm_NtkAddClauses( p ) )
+                return (p->iActWin = -1, 0);
+        }
+        // create XOR clauses for the roots
+        Vec_IntForEachEntry( p->vRoots, iNode, i )
+        {
+            iVar = Sfm_NtkNewSatVar( p );
+            sat_solver_add_xor( p->pSat, Vec_IntEntry(p->vLits, i), Sfm_ObjSatVar(p, iNode), iVar, 0 );
+            Vec_IntWriteEntry( p->vLits, i, Abc_Var2Lit(iVar, 0) );
+        }
+        // make OR clause for the roots, which is enabled by the activation variable
+        p->iActWin = Sfm_NtkNewSatVar( p );
+        Vec_IntPush( p->vLits, Abc_Var2Lit(p->iActWin, 1) );
+        RetValue = sat_solver_addclause( p->pSat, Vec_IntArray(p->vLits), Vec_IntArray(p->vLits) + Vec_IntSize(p->vLits) );
+        if ( RetValue == 0 )
+            return (p->iActWin = -1, 0);
+    }
+    // finalize
+    RetValue = sat_solver_simplify( p->pSat );
+    if ( RetValue == 0 )
+        p->iActWin = -1;
+    p->timeCnf += Abc_Clock() - clk;
+    return RetValue;
+} 
+
 /**Function*************************************************************
 
   Synopsis    [Converts a window into a SAT solver.]
@@ -60,6 +195,8 @@ int Sfm_NtkWindowToSolver( Sfm_Ntk_t * p )
     Vec_Int_t * vClause;
     int RetValue, iNode = -1, iFanin, i, k;
     abctime clk = Abc_Clock();
+    if ( p->pPars->fReuseSat )
+        return Sfm_NtkWindowToSolverIncr( p );
 //    if ( p->pSat )
 //        printf( "%d  ", p->pSat->stats.learnts );
     sat_solver_restart( p->pSat );
@@ -163,19 +300,21 @@ word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
 {
     word * pSign, uCube, uTruth = 0;
     int status, i, Div, iVar, nFinal, * pFinal, nIter = 0;
-    int pLits[2], nVars = sat_solver_nvars( p->pSat );
+    int pLits[3], nLits = 2, nVars = sat_solver_nvars( p->pSat );
     sat_solver_setnvars( p->pSat, nVars + 1 );
     pLits[0] = Abc_Var2Lit( Sfm_ObjSatVar(p, p->iPivotNode), 0 ); // F = 1
     pLits[1] = Abc_Var2Lit( nVars, 0 ); // iNewLit
+    if ( p->iActWin > 0 )
+        pLits[nLits++] = Abc_Var2Lit( p->iActWin, 0 ); // window constraints
     while ( 1 ) 
     {
         // find onset minterm
         p->nSatCalls++;
-        status = sat_solver_solve( p->pSat, pLits, pLits + 2, p->pPars->nBTLimit, 0, 0, 0 );
+        status = sat_solver_solve( p->pSat, pLits, pLits + nLits, p->pPars->nBTLimit, 0, 0, 0 );
         if ( status == l_Undef )
-            return SFM_SAT_UNDEC;
+            break;
         if ( status == l_False )
-            return uTruth;
+            break;
         assert( status == l_True );
         // remember variable values
         Vec_IntClear( p->vValues );
@@ -184,13 +323,15 @@ word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
         // collect divisor literals
         Vec_IntClear( p->vLits );
         Vec_IntPush( p->vLits, Abc_LitNot(pLits[0]) ); // F = 0
+        if ( p->iActWin > 0 )
+            Vec_IntPush( p->vLits, pLits[2] );
         Vec_IntForEachEntry( p->vDivIds, Div, i )
             Vec_IntPush( p->vLits, sat_solver_var_literal(p->pSat, Div) );
         // check against offset
         p->nSatCalls++;
         status = sat_solver_solve( p->pSat, Vec_IntArray(p->vLits), Vec_IntArray(p->vLits) + Vec_IntSize(p->vLits), p->pPars->nBTLimit, 0, 0, 0 );
         if ( status == l_Undef )
-            return SFM_SAT_UNDEC;
+            break;
         if ( status == l_True )
             break;
         assert( status == l_False );
@@ -201,7 +342,7 @@ word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
         Vec_IntPush( p->vLits, Abc_LitNot(pLits[1]) ); // NOT(iNewLit)
         for ( i = 0; i < nFinal; i++ )
         {
-            if ( pFinal[i] == pLits[0] )
+            if ( pFinal[i] == pLits[0] || Abc_Lit2Var(pFinal[i]) == p->iActWin )
                 continue;
             Vec_IntPush( p->vLits, pFinal[i] );
             iVar = Vec_IntFind( p->vDivIds, Abc_Lit2Var(pFinal[i]) );   assert( iVar >= 0 );
@@ -212,17 +353,31 @@ word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
         assert( status );
         nIter++;
     }
-    assert( status == l_True );
-    // store the counter-example
-    Vec_IntForEachEntry( p->vDivVars, iVar, i )
-        if ( Vec_IntEntry(p->vValues, i) ^ sat_solver_var_value(p->pSat, iVar) ) // insert 1
-        {
-            pSign = Vec_WrdEntryP( p->vDivCexes, i );
-            assert( !Abc_InfoHasBit( (unsigned *)pSign, p->nCexes) );
-            Abc_InfoXorBit( (unsigned *)pSign, p->nCexes );
-        }
-    p->nCexes++;
-    return SFM_SAT_SAT;
+    if ( status == l_True )
+    {
+        // store the counter-example
+        Vec_IntForEachEntry( p->vDivVars, iVar, i )
+            if ( Vec_IntEntry(p->vValues, i) ^ sat_solver_var_value(p->pSat, iVar) ) // insert 1
+            {
+                pSign = Vec_WrdEntryP( p->vDivCexes, i );
+                assert( !Abc_InfoHasBit( (unsigned *)pSign, p->nCexes) );
+                Abc_InfoXorBit( (unsigned *)pSign, p->nCexes );
+            }
+        p->nCexes++;
+    }
+    // disable the clauses of this interpolant in the reused solver
+    if ( p->pPars->fReuseSat )
+    {
+        int Lit = Abc_LitNot( pLits[1] );
+        int RetValue = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+        assert( RetValue );
+    }
+    if ( status == l_Undef )
+        return SFM_SAT_UNDEC;
+    if ( status == l_True )
+        return SFM_SAT_SAT;
+    assert( status == l_False );
+    return uTruth;
 }
 
 /**Function*************************************************************
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "cecInt.h"
+#include "misc/vec/vecHsh.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,6 +28,36 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the solver of incremental induction is rebuilt when its retired clauses
+// have this many times more literals than the clauses of the unrolled model
+#define CEC_CORR_DEAD_RATIO  16
+
+// incremental induction engine keeping one unrolled model and one solver
+typedef struct Cec_ManCorrInc_t_ Cec_ManCorrInc_t;
+struct Cec_ManCorrInc_t_
+{
+    Gia_Man_t *      pAig;          // the original AIG
+    Gia_Man_t *      pFrames;       // the unrolled model (SAT variable = object ID)
+    sat_solver *     pSat;          // the SAT solver kept across the iterations
+    Vec_Int_t *      vCopies;       // literals of the objects in each timeframe
+    Vec_Int_t *      vObjRepr;      // the representative of the hypothesis of each object
+    Vec_Int_t *      vObjAct;       // activation variable of the hypothesis of each object
+    Vec_Int_t *      vObjMiter;     // literal of the miter in the last timeframe
+    Vec_Int_t *      vAssump;       // temporary assumptions
+    Vec_Int_t *      vCex;          // temporary counter-example
+    int              nFrames;       // the number of timeframes with hypotheses
+    int              fScorr;        // signal correspondence
+    int              nSatVars;      // the number of SAT variables used
+    int              nLitsDead;     // the number of literals in the retired clauses
+    // statistics
+    int              nHypos;        // the number of hypotheses added
+    int              nHyposOff;     // the number of hypotheses disabled
+    int              nSatCalls;     // the number of SAT calls
+    int              nSatSat;       // the number of satisfiable calls
+    int              nSatUndec;     // the number of undecided calls
+    int              nRebuilds;     // the number of times the solver was rebuilt
+};
+
 static void Gia_ManCorrSpecReduce_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, int f, int nPrefix );
 
 ////////////////////////////////////////////////////////////////////////
@@ -444,29 +475,64 @@ int Cec_ManLoadCounterExamplesTry( Vec_Ptr_t * vInfo, Vec_Ptr_t * vPres, int iBi
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the first bit where the counter-example can be packed.]
+
+  Description [Checks 32 bits at a time by accumulating the mask of 
+  bits where one of the literals conflicts with an already assigned value.
+  Bit 0 is never used. Returns -1 if there is no such bit.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManLoadCounterExamplesFind( Vec_Ptr_t * vInfo, Vec_Ptr_t * vPres, int nWords, int * pLits, int nLits )
+{
+    unsigned * pInfo, * pPres, uMask;
+    int i, w;
+    for ( w = 0; w < nWords; w++ )
+    {
+        uMask = w ? ~0 : ~1;
+        for ( i = 0; i < nLits && uMask; i++ )
+        {
+            pInfo = (unsigned *)Vec_PtrEntry(vInfo, Abc_Lit2Var(pLits[i]));
+            pPres = (unsigned *)Vec_PtrEntry(vPres, Abc_Lit2Var(pLits[i]));
+            uMask &= ~(pPres[w] & (Abc_LitIsCompl(pLits[i]) ? pInfo[w] : ~pInfo[w]));
+        }
+        if ( uMask )
+            return 32 * w + Gia_WordFindFirstBit( uMask );
+    }
+    return -1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs bitpacking of counter-examples.]
 
-  Description []
+  Description [Patterns already seen in vHash are skipped because they 
+  cannot refine the classes again. Packing stops before the first pattern
+  that does not fit, so that it is loaded in the next round. The number 
+  of bits used (including the unused bit 0) is returned in pnBits.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Cec_ManLoadCounterExamples( Vec_Ptr_t * vInfo, Vec_Int_t * vCexStore, int iStart )
+int Cec_ManLoadCounterExamples( Vec_Ptr_t * vInfo, Vec_Int_t * vCexStore, int iStart, Hsh_VecMan_t * vHash, int * pnBits )
 { 
     Vec_Int_t * vPat;
     Vec_Ptr_t * vPres;
     int nWords = Vec_PtrReadWordsSimInfo(vInfo);
-    int nBits = 32 * nWords; 
-    int k, nSize, kMax = 0;//, iBit = 1;
+    int k, iPrev, nSize, nHashed, kMax = 0;
     vPat  = Vec_IntAlloc( 100 );
     vPres = Vec_PtrAllocSimInfo( Vec_PtrSize(vInfo), nWords );
     Vec_PtrCleanSimInfo( vPres, 0, nWords );
     while ( iStart < Vec_IntSize(vCexStore) )
     {
+        iPrev = iStart;
         // skip the output number
         iStart++;
         // get the number of items
@@ -477,16 +543,28 @@ int Cec_ManLoadCounterExamples( Vec_Ptr_t * vInfo, Vec_Int_t * vCexStore, int iS
         Vec_IntClear( vPat );
         for ( k = 0; k < nSize; k++ )
             Vec_IntPush( vPat, Vec_IntEntry( vCexStore, iStart++ ) );
+        // find the place for the pattern
+        k = Cec_ManLoadCounterExamplesFind( vInfo, vPres, nWords, Vec_IntArray(vPat), Vec_IntSize(vPat) );
+        if ( k == -1 )
+        {
+            // retry this pattern in the next round
+            assert( kMax > 0 );
+            iStart = iPrev;
+            break;
+        }
+        // skip duplicated patterns
+        Vec_IntSort( vPat, 0 );
+        nHashed = Hsh_VecSize( vHash );
+        if ( Hsh_VecManAdd( vHash, vPat ) < nHashed )
+            continue;
         // add pattern to storage
-        for ( k = 1; k < nBits; k++ )
-            if ( Cec_ManLoadCounterExamplesTry( vInfo, vPres, k, (int *)Vec_IntArray(vPat), Vec_IntSize(vPat) ) )
-                break;
+        Cec_ManLoadCounterExamplesTry( vInfo, vPres, k, Vec_IntArray(vPat), Vec_IntSize(vPat) );
         kMax = Abc_MaxInt( kMax, k );
-        if ( k == nBits-1 )
-            break;
     }
     Vec_PtrFree( vPres );
     Vec_IntFree( vPat );
+    if ( pnBits )
+        *pnBits = kMax + 1;
     return iStart;
 }
 
@@ -535,7 +613,8 @@ int Cec_ManLoadCounterExamples2( Vec_Ptr_t * vInfo, Vec_Int_t * vCexStore, int i
 
   Synopsis    [Resimulates counter-examples derived by the SAT solver.]
 
-  Description []
+  Description [Simulates only the words containing the packed patterns, 
+  keeping at least 128 bit-patterns to refine classes with random values.]
                
   SideEffects []
 
@@ -544,26 +623,33 @@ int Cec_ManLoadCounterExamples2( Vec_Ptr_t * vInfo, Vec_Int_t * vCexStore, int i
 ***********************************************************************/
 int Cec_ManResimulateCounterExamples( Cec_ManSim_t * pSim, Vec_Int_t * vCexStore, int nFrames )
 { 
+    Hsh_VecMan_t * vHash;
     Vec_Int_t * vPairs;
     Vec_Ptr_t * vSimInfo; 
-    int RetValue = 0, iStart = 0;
+    int RetValue = 0, iStart = 0, nBits, nWordsAll = pSim->nWords;
     vPairs = Gia_ManCorrCreateRemapping( pSim->pAig );
     Gia_ManCreateValueRefs( pSim->pAig );
 //    pSim->pPars->nWords  = 63;
     pSim->pPars->nFrames = nFrames;
     vSimInfo = Vec_PtrAllocSimInfo( Gia_ManRegNum(pSim->pAig) + Gia_ManPiNum(pSim->pAig) * nFrames, pSim->pPars->nWords );
+    vHash = Hsh_VecManStart( 1000 );
     while ( iStart < Vec_IntSize(vCexStore) )
     {
         Cec_ManStartSimInfo( vSimInfo, Gia_ManRegNum(pSim->pAig) );
-        iStart = Cec_ManLoadCounterExamples( vSimInfo, vCexStore, iStart );
+        iStart = Cec_ManLoadCounterExamples( vSimInfo, vCexStore, iStart, vHash, &nBits );
 //        iStart = Cec_ManLoadCounterExamples2( vSimInfo, vCexStore, iStart );
+        if ( nBits == 1 ) // only duplicated patterns
+            continue;
 //        Gia_ManCorrRemapSimInfo( pSim->pAig, vSimInfo );
         Gia_ManCorrPerformRemapping( vPairs, vSimInfo );
+        pSim->nWords = Abc_MinInt( nWordsAll, Abc_MaxInt(4, Abc_BitWordNum(nBits)) );
         RetValue |= Cec_ManSeqResimulate( pSim, vSimInfo );
+        pSim->nWords = nWordsAll;
 //        Cec_ManSeqResimulateInfo( pSim->pAig, vSimInfo, NULL );
     }
 //Gia_ManEquivPrintOne( pSim->pAig, 85, 0 );
     assert( iStart == Vec_IntSize(vCexStore) );
+    Hsh_VecManStop( vHash );
     Vec_PtrFree( vSimInfo );
     Vec_IntFree( vPairs );
     return RetValue;
@@ -582,18 +668,25 @@ int Cec_ManResimulateCounterExamples( Cec_ManSim_t * pSim, Vec_Int_t * vCexStore
 ***********************************************************************/
 int Cec_ManResimulateCounterExamplesComb( Cec_ManSim_t * pSim, Vec_Int_t * vCexStore )
 { 
+    Hsh_VecMan_t * vHash;
     Vec_Ptr_t * vSimInfo; 
-    int RetValue = 0, iStart = 0;
+    int RetValue = 0, iStart = 0, nBits, nWordsAll = pSim->nWords;
     Gia_ManCreateValueRefs( pSim->pAig );
     pSim->pPars->nFrames = 1;
     vSimInfo = Vec_PtrAllocSimInfo( Gia_ManCiNum(pSim->pAig), pSim->pPars->nWords );
+    vHash = Hsh_VecManStart( 1000 );
     while ( iStart < Vec_IntSize(vCexStore) )
     {
         Cec_ManStartSimInfo( vSimInfo, 0 );
-        iStart = Cec_ManLoadCounterExamples( vSimInfo, vCexStore, iStart );
+        iStart = Cec_ManLoadCounterExamples( vSimInfo, vCexStore, iStart, vHash, &nBits );
+        if ( nBits == 1 ) // only duplicated patterns
+            continue;
+        pSim->nWords = Abc_MinInt( nWordsAll, Abc_MaxInt(4, Abc_BitWordNum(nBits)) );
         RetValue |= Cec_ManSeqResimulate( pSim, vSimInfo );
+        pSim->nWords = nWordsAll;
     }
     assert( iStart == Vec_IntSize(vCexStore) );
+    Hsh_VecManStop( vHash );
     Vec_PtrFree( vSimInfo );
     return RetValue;
 }
@@ -895,6 +988,457 @@ int Cec_ManLSCorrAnalyzeDependence( Gia_Man_t * p, Vec_Int_t * vEquivs, Vec_Str_
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the literal of the object in the given timeframe.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_ManCorrIncLit( Cec_ManCorrInc_t * p, int f, int iObj )
+{
+    int iLit = Vec_IntEntry( p->vCopies, f * Gia_ManObjNum(p->pAig) + iObj );
+    assert( iLit >= 0 );
+    return iLit;
+}
+static inline void Cec_ManCorrIncSetLit( Cec_ManCorrInc_t * p, int f, Gia_Obj_t * pObj, int iLit )
+{
+    Vec_IntWriteEntry( p->vCopies, f * Gia_ManObjNum(p->pAig) + Gia_ObjId(p->pAig, pObj), iLit );
+}
+static inline int Cec_ManCorrIncFanin0Lit( Cec_ManCorrInc_t * p, int f, Gia_Obj_t * pObj )
+{
+    return Abc_LitNotCond( Cec_ManCorrIncLit(p, f, Gia_ObjFaninId0p(p->pAig, pObj)), Gia_ObjFaninC0(pObj) );
+}
+static inline int Cec_ManCorrIncFanin1Lit( Cec_ManCorrInc_t * p, int f, Gia_Obj_t * pObj )
+{
+    return Abc_LitNotCond( Cec_ManCorrIncLit(p, f, Gia_ObjFaninId1p(p->pAig, pObj)), Gia_ObjFaninC1(pObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the unrolled model into a new SAT solver.]
+
+  Description [The hypotheses are added later, when the solver is used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManCorrIncStartSat( Cec_ManCorrInc_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i;
+    p->nSatVars = Gia_ManObjNum(p->pFrames);
+    p->pSat = sat_solver_new();
+    sat_solver_setnvars( p->pSat, 1000 + p->nSatVars );
+    sat_solver_add_const( p->pSat, 0, 1 );
+    Gia_ManForEachAnd( p->pFrames, pObj, i )
+        sat_solver_add_and( p->pSat, i, Gia_ObjFaninId0(pObj, i), Gia_ObjFaninId1(pObj, i), Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rebuilds the SAT solver without the retired clauses.]
+
+  Description [The clauses of disabled hypotheses, of previous iterations
+  and of the disjunctions used by the joint check are disabled by unit
+  clauses but stay in the solver. When they have CEC_CORR_DEAD_RATIO times
+  more literals than the clauses of the unrolled model, the solver is 
+  rebuilt, and all current hypotheses are
+  added again by the next iteration. The learned clauses are lost.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManCorrIncRebuildSat( Cec_ManCorrInc_t * p )
+{
+    sat_solver_delete( p->pSat );
+    Cec_ManCorrIncStartSat( p );
+    Vec_IntFill( p->vObjRepr,  Gia_ManObjNum(p->pAig), -1 );
+    Vec_IntFill( p->vObjAct,   Gia_ManObjNum(p->pAig), -1 );
+    Vec_IntFill( p->vObjMiter, Gia_ManObjNum(p->pAig), -1 );
+    p->nLitsDead = 0;
+    p->nRebuilds++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the incremental induction engine.]
+
+  Description [Unrolls the AIG once for nFrames timeframes with hypotheses
+  followed by the timeframe where the candidate equivalences are checked.
+  The CIs of the unrolled model are ordered in the same way as those of
+  the speculatively reduced model (flops first, followed by the PIs of
+  each timeframe), so that the counter-examples can be resimulated by the
+  same procedure. The SAT variable of each node is its object ID.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cec_ManCorrInc_t * Cec_ManCorrIncStart( Gia_Man_t * pAig, int nFrames, int fScorr )
+{
+    Cec_ManCorrInc_t * p;
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj, * pObjRo;
+    int f, i;
+    assert( nFrames > 0 );
+    assert( Gia_ManRegNum(pAig) > 0 );
+    p = ABC_CALLOC( Cec_ManCorrInc_t, 1 );
+    p->pAig      = pAig;
+    p->nFrames   = nFrames;
+    p->fScorr    = fScorr;
+    p->vCopies   = Vec_IntStartFull( (nFrames+1) * Gia_ManObjNum(pAig) );
+    p->vObjRepr  = Vec_IntStartFull( Gia_ManObjNum(pAig) );
+    p->vObjAct   = Vec_IntStartFull( Gia_ManObjNum(pAig) );
+    p->vObjMiter = Vec_IntStartFull( Gia_ManObjNum(pAig) );
+    p->vAssump   = Vec_IntAlloc( 1000 );
+    p->vCex      = Vec_IntAlloc( 1000 );
+    Gia_ManSetPhase( pAig );
+    // unroll the AIG
+    pNew = Gia_ManStart( (nFrames+1) * Gia_ManObjNum(pAig) );
+    pNew->pName = Abc_UtilStrsav( pAig->pName );
+    Gia_ManHashAlloc( pNew );
+    for ( f = 0; f <= nFrames; f++ )
+        Cec_ManCorrIncSetLit( p, f, Gia_ManConst0(pAig), 0 );
+    Gia_ManForEachRo( pAig, pObj, i )
+        Cec_ManCorrIncSetLit( p, 0, pObj, Gia_ManAppendCi(pNew) );
+    for ( f = 0; f < nFrames+fScorr; f++ )
+        Gia_ManForEachPi( pAig, pObj, i )
+            Cec_ManCorrIncSetLit( p, f, pObj, Gia_ManAppendCi(pNew) );
+    for ( f = 0; f <= nFrames; f++ )
+    {
+        if ( f > 0 )
+            Gia_ManForEachRiRo( pAig, pObj, pObjRo, i )
+                Cec_ManCorrIncSetLit( p, f, pObjRo, Cec_ManCorrIncFanin0Lit(p, f-1, pObj) );
+        if ( f == nFrames && !fScorr )
+            break;
+        Gia_ManForEachAnd( pAig, pObj, i )
+            Cec_ManCorrIncSetLit( p, f, pObj, Gia_ManHashAnd(pNew, Cec_ManCorrIncFanin0Lit(p, f, pObj), Cec_ManCorrIncFanin1Lit(p, f, pObj)) );
+    }
+    Gia_ManHashStop( pNew );
+    p->pFrames = pNew;
+    Cec_ManCorrIncStartSat( p );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the incremental induction engine.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManCorrIncStop( Cec_ManCorrInc_t * p, int fVerbose )
+{
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "Incremental induction: Vars = %d. Clauses = %d. Conflicts = %d. Hypotheses = %d (disabled = %d).\n",
+            sat_solver_nvars(p->pSat), sat_solver_nclauses(p->pSat), sat_solver_nconflicts(p->pSat), p->nHypos, p->nHyposOff );
+        Abc_Print( 1, "SAT calls = %d. Sat = %d. Unsat = %d. Undecided = %d. Solver rebuilds = %d.\n",
+            p->nSatCalls, p->nSatSat, p->nSatCalls - p->nSatSat - p->nSatUndec, p->nSatUndec, p->nRebuilds );
+    }
+    sat_solver_delete( p->pSat );
+    Gia_ManStop( p->pFrames );
+    Vec_IntFree( p->vCopies );
+    Vec_IntFree( p->vObjRepr );
+    Vec_IntFree( p->vObjAct );
+    Vec_IntFree( p->vObjMiter );
+    Vec_IntFree( p->vAssump );
+    Vec_IntFree( p->vCex );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates a new SAT variable.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cec_ManCorrIncNewVar( Cec_ManCorrInc_t * p )
+{
+    if ( p->nSatVars == sat_solver_nvars(p->pSat) )
+        sat_solver_setnvars( p->pSat, 2 * p->nSatVars );
+    return p->nSatVars++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the hypothesis that the object is equal to its representative.]
+
+  Description [The hypothesis holds in the first nFrames timeframes and is
+  enabled by a fresh activation variable. The miter of the pair in the last
+  timeframe is recorded as a literal.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManCorrIncAddHypo( Cec_ManCorrInc_t * p, int iObj, int iRepr )
+{
+    int fCompl = Gia_ObjPhase(Gia_ManObj(p->pAig, iObj)) ^ Gia_ObjPhase(Gia_ManObj(p->pAig, iRepr));
+    int f, iLitRepr, iLitObj, iVarAct, iMiter, Lits[3];
+    iVarAct = Cec_ManCorrIncNewVar( p );
+    for ( f = 0; f < p->nFrames; f++ )
+    {
+        iLitRepr = Cec_ManCorrIncLit( p, f, iRepr );
+        iLitObj  = Abc_LitNotCond( Cec_ManCorrIncLit(p, f, iObj), fCompl );
+        if ( iLitRepr == iLitObj )
+            continue;
+        Lits[0] = Abc_Var2Lit( iVarAct, 1 );
+        Lits[1] = Abc_LitNot( iLitRepr );
+        Lits[2] = iLitObj;
+        sat_solver_addclause( p->pSat, Lits, Lits + 3 );
+        Lits[1] = iLitRepr;
+        Lits[2] = Abc_LitNot( iLitObj );
+        sat_solver_addclause( p->pSat, Lits, Lits + 3 );
+    }
+    // create the miter in the last timeframe
+    iLitRepr = Cec_ManCorrIncLit( p, p->nFrames, iRepr );
+    iLitObj  = Abc_LitNotCond( Cec_ManCorrIncLit(p, p->nFrames, iObj), fCompl );
+    if ( Abc_Lit2Var(iLitRepr) == Abc_Lit2Var(iLitObj) )
+        iMiter = Abc_LitIsCompl(iLitRepr) ^ Abc_LitIsCompl(iLitObj);
+    else if ( Abc_Lit2Var(iLitRepr) == 0 )
+        iMiter = Abc_LitNotCond( iLitObj, Abc_LitIsCompl(iLitRepr) );
+    else
+    {
+        iMiter = Abc_Var2Lit( Cec_ManCorrIncNewVar(p), 0 );
+        sat_solver_add_xor( p->pSat, Abc_Lit2Var(iMiter), Abc_Lit2Var(iLitRepr), Abc_Lit2Var(iLitObj), Abc_LitIsCompl(iLitRepr) ^ Abc_LitIsCompl(iLitObj) );
+    }
+    Vec_IntWriteEntry( p->vObjRepr,  iObj, iRepr );
+    Vec_IntWriteEntry( p->vObjAct,   iObj, iVarAct );
+    Vec_IntWriteEntry( p->vObjMiter, iObj, iMiter );
+    p->nHypos++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the CI values of the counter-example.]
+
+  Description [Flops with representatives are not loaded by resimulation
+  because their values are copied from the representatives. For this
+  reason, their values are transferred to the representatives here.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManCorrIncDeriveCex_rec( Cec_ManCorrInc_t * p, Gia_Obj_t * pObj )
+{
+    Gia_Obj_t * pRo, * pRepr;
+    int Value, iCi;
+    if ( Gia_ObjIsTravIdCurrent(p->pFrames, pObj) || Gia_ObjIsConst0(pObj) )
+        return;
+    Gia_ObjSetTravIdCurrent(p->pFrames, pObj);
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        iCi   = Gia_ObjCioId(pObj);
+        Value = sat_solver_var_value( p->pSat, Gia_ObjId(p->pFrames, pObj) );
+        if ( iCi < Gia_ManRegNum(p->pAig) )
+        {
+            pRo = Gia_ManCi( p->pAig, Gia_ManPiNum(p->pAig) + iCi );
+            pRepr = Gia_ObjReprObj( p->pAig, Gia_ObjId(p->pAig, pRo) );
+            if ( pRepr != NULL && !Gia_ObjFailed(p->pAig, Gia_ObjId(p->pAig, pRo)) )
+            {
+                if ( Gia_ObjIsConst0(pRepr) )
+                    return;
+                assert( Gia_ObjIsRo(p->pAig, pRepr) );
+                iCi = Gia_ObjCioId(pRepr) - Gia_ManPiNum(p->pAig);
+            }
+        }
+        Vec_IntPush( p->vCex, Abc_Var2Lit(iCi, !Value) );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    Cec_ManCorrIncDeriveCex_rec( p, Gia_ObjFanin0(pObj) );
+    Cec_ManCorrIncDeriveCex_rec( p, Gia_ObjFanin1(pObj) );
+}
+void Cec_ManCorrIncDeriveCex( Cec_ManCorrInc_t * p, Vec_Int_t * vOutputs, Vec_Int_t * vOuts )
+{
+    int i, iOut;
+    Vec_IntClear( p->vCex );
+    Gia_ManIncrementTravId( p->pFrames );
+    Vec_IntForEachEntry( vOuts, iOut, i )
+    {
+        Cec_ManCorrIncDeriveCex_rec( p, Gia_ManObj(p->pFrames, Abc_Lit2Var(Cec_ManCorrIncLit(p, p->nFrames, Vec_IntEntry(vOutputs, 2*iOut)))) );
+        Cec_ManCorrIncDeriveCex_rec( p, Gia_ManObj(p->pFrames, Abc_Lit2Var(Cec_ManCorrIncLit(p, p->nFrames, Vec_IntEntry(vOutputs, 2*iOut+1)))) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one iteration of incremental induction.]
+
+  Description [Brings the hypotheses in sync with the current equivalence
+  classes: the hypotheses of refined objects are permanently disabled
+  and new ones are added for the objects whose representative changed.
+  Then, all candidate equivalences are checked at once in the last
+  timeframe by asserting the disjunction of their miters. Each satisfying
+  assignment disproves all candidates whose miters it sets to 1, and the
+  check is repeated for the remaining ones until it is unsatisfiable.
+  If the joint check is undecided, the remaining candidates are checked
+  one at a time, assuming the equivalences proved for the objects with
+  smaller IDs. Returns the counter-examples in the same format as
+  Cec_ManSatSolveMiter(), together with the pairs of objects checked
+  and their status.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cec_ManCorrIncSolve( Cec_ManCorrInc_t * p, int nConfLimit, Vec_Int_t ** pvOutputs, Vec_Str_t ** pvStatus )
+{
+    Vec_Int_t * vCexStore, * vOutputs, * vPending, * vOuts;
+    Vec_Str_t * vStatus;
+    Gia_Obj_t * pObj, * pRepr;
+    int i, k, iRepr, iOut, iMiter, iVarIter, iVarOr, status, Lits[2];
+    // drop the retired clauses if there are too many of them
+    if ( p->nLitsDead > CEC_CORR_DEAD_RATIO * 7 * Gia_ManAndNum(p->pFrames) )
+        Cec_ManCorrIncRebuildSat( p );
+    // update the hypotheses
+    Gia_ManForEachObj1( p->pAig, pObj, i )
+    {
+        pRepr = Gia_ObjReprObj( p->pAig, i );
+        iRepr = pRepr ? Gia_ObjId(p->pAig, pRepr) : -1;
+        if ( Vec_IntEntry(p->vObjRepr, i) == iRepr )
+            continue;
+        if ( Vec_IntEntry(p->vObjRepr, i) >= 0 )
+        {
+            sat_solver_add_const( p->pSat, Vec_IntEntry(p->vObjAct, i), 1 );
+            Vec_IntWriteEntry( p->vObjRepr, i, -1 );
+            p->nLitsDead += 6 * p->nFrames + 12;
+            p->nHyposOff++;
+        }
+        if ( iRepr >= 0 )
+            Cec_ManCorrIncAddHypo( p, i, iRepr );
+    }
+    // the variable of this iteration enables the current hypotheses
+    // (a single assumption instead of one per hypothesis) and the
+    // equivalences proved in this iteration
+    iVarIter = Cec_ManCorrIncNewVar( p );
+    Lits[0] = Abc_Var2Lit( iVarIter, 1 );
+    Vec_IntForEachEntry( p->vObjRepr, iRepr, i )
+    {
+        if ( iRepr < 0 )
+            continue;
+        Lits[1] = Abc_Var2Lit( Vec_IntEntry(p->vObjAct, i), 0 );
+        sat_solver_addclause( p->pSat, Lits, Lits + 2 );
+        p->nLitsDead += 2;
+    }
+    // collect the candidates that are not structurally equivalent
+    vCexStore = Vec_IntAlloc( 10000 );
+    vOutputs  = Vec_IntAlloc( 1000 );
+    vPending  = Vec_IntAlloc( 1000 );
+    vOuts     = Vec_IntAlloc( 1000 );
+    Vec_IntForEachEntry( p->vObjRepr, iRepr, i )
+    {
+        if ( iRepr < 0 || Vec_IntEntry(p->vObjMiter, i) == 0 )
+            continue;
+        Vec_IntPush( vPending, Vec_IntSize(vOutputs)/2 );
+        Vec_IntPush( vOutputs, iRepr );
+        Vec_IntPush( vOutputs, i );
+    }
+    vStatus = Vec_StrAlloc( Vec_IntSize(vPending) );
+    Vec_StrFill( vStatus, Vec_IntSize(vPending), 1 );
+    // check the pending candidates at once (each disjunction is enabled
+    // by its own variable, which is fixed to 0 after the call)
+    while ( Vec_IntSize(vPending) > 0 )
+    {
+        iVarOr = Cec_ManCorrIncNewVar( p );
+        Vec_IntClear( p->vAssump );
+        Vec_IntPush( p->vAssump, Abc_Var2Lit(iVarOr, 1) );
+        Vec_IntForEachEntry( vPending, iOut, k )
+            Vec_IntPush( p->vAssump, Vec_IntEntry(p->vObjMiter, Vec_IntEntry(vOutputs, 2*iOut+1)) );
+        sat_solver_addclause( p->pSat, Vec_IntArray(p->vAssump), Vec_IntLimit(p->vAssump) );
+        p->nLitsDead += Vec_IntSize(p->vAssump);
+        Vec_IntFillTwo( p->vAssump, 2, Abc_Var2Lit(iVarIter, 0), Abc_Var2Lit(iVarOr, 0) );
+        p->nSatCalls++;
+        status = sat_solver_solve( p->pSat, Vec_IntArray(p->vAssump), Vec_IntLimit(p->vAssump), (ABC_INT64_T)nConfLimit * Vec_IntSize(vPending), 0, 0, 0 );
+        if ( status == l_False )
+            Vec_IntClear( vPending );
+        if ( status != l_True )
+        {
+            sat_solver_add_const( p->pSat, iVarOr, 1 );
+            break;
+        }
+        p->nSatSat++;
+        // disprove the candidates whose miters are set to 1
+        Vec_IntClear( vOuts );
+        k = 0;
+        Vec_IntForEachEntry( vPending, iOut, i )
+        {
+            iMiter = Vec_IntEntry( p->vObjMiter, Vec_IntEntry(vOutputs, 2*iOut+1) );
+            if ( sat_solver_var_value(p->pSat, Abc_Lit2Var(iMiter)) ^ Abc_LitIsCompl(iMiter) )
+                Vec_IntPush( vOuts, iOut );
+            else
+                Vec_IntWriteEntry( vPending, k++, iOut );
+        }
+        Vec_IntShrink( vPending, k );
+        assert( Vec_IntSize(vOuts) > 0 );
+        Cec_ManCorrIncDeriveCex( p, vOutputs, vOuts );
+        Cec_ManSatAddToStore( vCexStore, p->vCex, Vec_IntEntry(vOuts, 0) );
+        Vec_IntForEachEntry( vOuts, iOut, i )
+            Vec_StrWriteEntry( vStatus, iOut, 0 );
+        sat_solver_add_const( p->pSat, iVarOr, 1 );
+    }
+    // check the remaining candidates one at a time
+    Vec_IntForEachEntry( vPending, iOut, k )
+    {
+        iMiter = Vec_IntEntry( p->vObjMiter, Vec_IntEntry(vOutputs, 2*iOut+1) );
+        Vec_IntFillTwo( p->vAssump, 2, Abc_Var2Lit(iVarIter, 0), iMiter );
+        p->nSatCalls++;
+        status = sat_solver_solve( p->pSat, Vec_IntArray(p->vAssump), Vec_IntLimit(p->vAssump), (ABC_INT64_T)nConfLimit, 0, 0, 0 );
+        if ( status == l_False )
+        {
+            Lits[0] = Abc_Var2Lit( iVarIter, 1 );
+            Lits[1] = Abc_LitNot( iMiter );
+            sat_solver_addclause( p->pSat, Lits, Lits + 2 );
+            p->nLitsDead += 2;
+        }
+        else if ( status == l_True )
+        {
+            Vec_StrWriteEntry( vStatus, iOut, 0 );
+            Vec_IntFill( vOuts, 1, iOut );
+            Cec_ManCorrIncDeriveCex( p, vOutputs, vOuts );
+            Cec_ManSatAddToStore( vCexStore, p->vCex, iOut );
+            p->nSatSat++;
+        }
+        else
+        {
+            Vec_StrWriteEntry( vStatus, iOut, -1 );
+            Cec_ManSatAddToStore( vCexStore, NULL, iOut );
+            p->nSatUndec++;
+        }
+    }
+    // retire the hypotheses and equivalences of this iteration
+    sat_solver_add_const( p->pSat, iVarIter, 1 );
+    Vec_IntFree( vPending );
+    Vec_IntFree( vOuts );
+    *pvOutputs = vOutputs;
+    *pvStatus  = vStatus;
+    return vCexStore;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Internal procedure for register correspondence.]
@@ -917,6 +1461,7 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
     Cec_ParSim_t ParsSim, * pParsSim = &ParsSim;
     Cec_ParSat_t ParsSat, * pParsSat = &ParsSat;
     Cec_ManSim_t * pSim;
+    Cec_ManCorrInc_t * pInc = NULL;
     Gia_Man_t * pSrm;
     int r, RetValue;
     abctime clkTotal = Abc_Clock();
@@ -971,36 +1516,62 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
         Cec_ManSimStop( pSim );
         return 1;
     }
+    // unroll the AIG once if the induction is incremental
+    if ( pPars->fIncremental )
+    {
+        clk2 = Abc_Clock();
+        pInc = Cec_ManCorrIncStart( pAig, pPars->nFrames, !pPars->fLatchCorr );
+        clkSrm += Abc_Clock() - clk2;
+    }
     // perform refinement of equivalence classes
     for ( r = 0; r < nIterMax; r++ )
     { 
         if ( pPars->nStepsMax == r )
         {
+            if ( pInc )
+                Cec_ManCorrIncStop( pInc, pPars->fVerbose );
             Cec_ManSimStop( pSim );
             Abc_Print( 1, "Stopped signal correspondence after %d refiment iterations.\n", r );
             return 1;
         }
         clk = Abc_Clock();
-        // perform speculative reduction
-        clk2 = Abc_Clock();
-        pSrm = Gia_ManCorrSpecReduce( pAig, pPars->nFrames, !pPars->fLatchCorr, &vOutputs, pPars->fUseRings );
-        assert( Gia_ManRegNum(pSrm) == 0 && Gia_ManPiNum(pSrm) == Gia_ManRegNum(pAig)+(pPars->nFrames+!pPars->fLatchCorr)*Gia_ManPiNum(pAig) );
-        clkSrm += Abc_Clock() - clk2;
-        if ( Gia_ManCoNum(pSrm) == 0 )
+        if ( pInc )
         {
-            Vec_IntFree( vOutputs );
-            Gia_ManStop( pSrm );            
-            break;
+            // check the candidates using the hypotheses enabled in the same solver
+            clk2 = Abc_Clock();
+            vCexStore = Cec_ManCorrIncSolve( pInc, pPars->nBTLimit, &vOutputs, &vStatus );
+            clkSat += Abc_Clock() - clk2;
+            if ( Vec_IntSize(vOutputs) == 0 )
+            {
+                Vec_IntFree( vCexStore );
+                Vec_StrFree( vStatus );
+                Vec_IntFree( vOutputs );
+                break;
+            }
         }
-//Gia_DumpAiger( pSrm, "corrsrm", r, 2 );
-        // found counter-examples to speculation
-        clk2 = Abc_Clock();
-        if ( pPars->fUseCSat )
-            vCexStore = Cbs_ManSolveMiterNc( pSrm, pPars->nBTLimit, &vStatus, 0 );
         else
-            vCexStore = Cec_ManSatSolveMiter( pSrm, pParsSat, &vStatus );
-        Gia_ManStop( pSrm );
-        clkSat += Abc_Clock() - clk2;
+        {
+            // perform speculative reduction
+            clk2 = Abc_Clock();
+            pSrm = Gia_ManCorrSpecReduce( pAig, pPars->nFrames, !pPars->fLatchCorr, &vOutputs, pPars->fUseRings );
+            assert( Gia_ManRegNum(pSrm) == 0 && Gia_ManPiNum(pSrm) == Gia_ManRegNum(pAig)+(pPars->nFrames+!pPars->fLatchCorr)*Gia_ManPiNum(pAig) );
+            clkSrm += Abc_Clock() - clk2;
+            if ( Gia_ManCoNum(pSrm) == 0 )
+            {
+                Vec_IntFree( vOutputs );
+                Gia_ManStop( pSrm );            
+                break;
+            }
+//Gia_DumpAiger( pSrm, "corrsrm", r, 2 );
+            // found counter-examples to speculation
+            clk2 = Abc_Clock();
+            if ( pPars->fUseCSat )
+                vCexStore = Cbs_ManSolveMiterNc( pSrm, pPars->nBTLimit, &vStatus, 0 );
+            else
+                vCexStore = Cec_ManSatSolveMiter( pSrm, pParsSat, &vStatus );
+            Gia_ManStop( pSrm );
+            clkSat += Abc_Clock() - clk2;
+        }
         if ( Vec_IntSize(vCexStore) == 0 )
         {
             Vec_IntFree( vCexStore );
@@ -1028,6 +1599,8 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
         {
             printf( "Iterative refinement is stopped after iteration %d\n", r );
             printf( "because the property output is no longer a candidate constant.\n" );
+            if ( pInc )
+                Cec_ManCorrIncStop( pInc, pPars->fVerbose );
             Cec_ManSimStop( pSim );
             return 0;
         }
@@ -1037,6 +1610,8 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
     // check the overflow
     if ( r == nIterMax )
         Abc_Print( 1, "The refinement was not finished. The result may be incorrect.\n" );
+    if ( pInc )
+        Cec_ManCorrIncStop( pInc, pPars->fVerbose );
     Cec_ManSimStop( pSim );
     // check the base case
     if ( !fRunBmcFirst && (!pPars->fLatchCorr || pPars->nFrames > 1) )
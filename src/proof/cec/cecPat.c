@@ -356,11 +356,10 @@ void Cec_ManPatCleanMark0( Gia_Man_t * p, Gia_Obj_t * pObj )
   SeeAlso     []
 
 ***********************************************************************/
-void Cec_ManPatSavePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t * pObj )
+Vec_Int_t * Cec_ManPatDerivePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t * pObj )
 {
     Vec_Int_t * vPat;
     int nPatLits;
-    abctime clkTotal = Abc_Clock();
 //    abctime clk;
     assert( Gia_ObjIsCo(pObj) );
     pMan->nPats++;
@@ -395,6 +394,25 @@ void Cec_ManPatSavePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t *
 //clk = Abc_Clock();
     Vec_IntSort( vPat, 0 );
 //pMan->timeSort += Abc_Clock() - clk;
+    return vPat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManPatSavePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t * pObj )
+{
+    Vec_Int_t * vPat;
+    abctime clkTotal = Abc_Clock();
+    vPat = Cec_ManPatDerivePattern( pMan, p, pObj );
     // save pattern
     Cec_ManPatStore( pMan, vPat );
     pMan->timeTotal += Abc_Clock() - clkTotal;
@@ -0,0 +1,463 @@
+/**CFile****************************************************************
+
+  FileName    [cecSolvePar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Multi-threaded SAT solving of speculatively reduced miters.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: cecSolvePar.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cecInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+void Cec_ManSatSolvePar( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPars, int nProcs ) { Cec_ManSatSolve( pPat, pAig, pPars ); }
+
+#else // pthreads are used
+
+#define PAR_THR_MAX 100
+#define PAR_SIM_PATS 64
+
+typedef struct Cec_ParThData_t_ Cec_ParThData_t;
+struct Cec_ParThData_t_
+{
+    Gia_Man_t *      p;              // local window with a batch of outputs
+    Cec_ParSat_t *   pPars;          // SAT solving parameters
+    Cec_ManPat_t *   pPat;           // local pattern minimization
+    Vec_Int_t *      vOuts;          // outputs of the original miter in this batch
+    Vec_Int_t *      vCiMap;         // mapping of window CIs into CIs of the miter
+    Vec_Str_t *      vStatus;        // status of each output of the window
+    Vec_Int_t *      vCexes;         // patterns as (output, size, literals)
+    int              iThread;        // thread number
+    int              fWorking;       // the thread is busy
+    // statistics
+    int              nSatUnsat;
+    int              nSatSat;
+    int              nSatUndec;
+    int              nConfUnsat;
+    int              nConfSat;
+    int              nConfUndec;
+    abctime          timeSatUnsat;
+    abctime          timeSatSat;
+    abctime          timeSatUndec;
+    abctime          clkUsed;
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the window containing the cones of the batch.]
+
+  Description [CIs of the window are created in the DFS order. The array
+  vCiMap maps them into the CI numbers of the original miter.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManParDeriveWindow_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vCiMap )
+{
+    if ( Gia_ObjIsTravIdCurrent(p, pObj) )
+        return;
+    Gia_ObjSetTravIdCurrent(p, pObj);
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        pObj->Value = Gia_ManAppendCi( pNew );
+        Vec_IntPush( vCiMap, Gia_ObjCioId(pObj) );
+        return;
+    }
+    assert( Gia_ObjIsAnd(pObj) );
+    Cec_ManParDeriveWindow_rec( pNew, p, Gia_ObjFanin0(pObj), vCiMap );
+    Cec_ManParDeriveWindow_rec( pNew, p, Gia_ObjFanin1(pObj), vCiMap );
+    pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+}
+Gia_Man_t * Cec_ManParDeriveWindow( Gia_Man_t * p, Vec_Int_t * vOuts, Vec_Int_t * vCiMap )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i, iOut;
+    Vec_IntClear( vCiMap );
+    pNew = Gia_ManStart( 1000 );
+    Gia_ManIncrementTravId( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ObjSetTravIdCurrent( p, Gia_ManConst0(p) );
+    Vec_IntForEachEntry( vOuts, iOut, i )
+        Cec_ManParDeriveWindow_rec( pNew, p, Gia_ObjFanin0(Gia_ManCo(p, iOut)), vCiMap );
+    Vec_IntForEachEntry( vOuts, iOut, i )
+    {
+        pObj = Gia_ManCo( p, iOut );
+        Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    }
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of one window.]
+
+  Description [This procedure is called by the worker threads. It only
+  touches the window and the thread data.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManParSolveWindow( Cec_ParThData_t * pThData )
+{
+    Gia_Man_t * p = pThData->p;
+    Cec_ManSat_t * pSat;
+    Gia_Obj_t * pObj;
+    Vec_Int_t * vPat;
+    int i, k, Lit, status;
+    abctime clk = Abc_Clock();
+    Vec_StrClear( pThData->vStatus );
+    Vec_IntClear( pThData->vCexes );
+    Gia_ManSetPhase( p );
+    Gia_ManLevelNum( p );
+    Gia_ManIncrementTravId( p );
+    pSat = Cec_ManSatCreate( p, pThData->pPars );
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        if ( Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
+            status = 1;
+        else
+            status = Cec_ManSatCheckNode( pSat, Gia_ObjChild0(pObj) );
+        Vec_StrPush( pThData->vStatus, (char)status );
+        if ( status != 0 )
+            continue;
+        // save the pattern in terms of the CIs of the miter
+        vPat = Cec_ManPatDerivePattern( pThData->pPat, pSat, pObj );
+        Vec_IntPush( pThData->vCexes, i );
+        Vec_IntPush( pThData->vCexes, Vec_IntSize(vPat) );
+        Vec_IntForEachEntry( vPat, Lit, k )
+            Vec_IntPush( pThData->vCexes, Abc_Lit2LitV(Vec_IntArray(pThData->vCiMap), Lit) );
+        // quit if one of them is solved
+        if ( pThData->pPars->fCheckMiter )
+            break;
+    }
+    pThData->nSatUnsat    += pSat->nSatUnsat;
+    pThData->nSatSat      += pSat->nSatSat;
+    pThData->nSatUndec    += pSat->nSatUndec;
+    pThData->nConfUnsat   += pSat->nConfUnsat;
+    pThData->nConfSat     += pSat->nConfSat;
+    pThData->nConfUndec   += pSat->nConfUndec;
+    pThData->timeSatUnsat += pSat->timeSatUnsat;
+    pThData->timeSatSat   += pSat->timeSatSat;
+    pThData->timeSatUndec += pSat->timeSatUndec;
+    Cec_ManSatStop( pSat );
+    pThData->clkUsed += Abc_Clock() - clk;
+}
+void * Cec_ManParWorkerThread( void * pArg )
+{
+    Cec_ParThData_t * pThData = (Cec_ParThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        assert( pThData->fWorking );
+        if ( pThData->p == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Cec_ManParSolveWindow( pThData );
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Filters the queue using ternary simulation of new patterns.]
+
+  Description [Patterns are partial assignments of the CIs. The pending
+  outputs, which evaluate to 1 under a pattern irrespective of the values
+  of the unassigned CIs, are marked as disproved without calling the SAT
+  solver. The same patterns are later used to refine the classes, so these
+  outputs are guaranteed to be refined. Returns the number of outputs
+  marked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManParFilterQueue( Gia_Man_t * p, Vec_Int_t * vPats, Vec_Int_t * vQueue, int iQueue, Vec_Wrd_t * vSims )
+{
+    Gia_Obj_t * pObj;
+    word * pSim, * pSim0, * pSim1, Zero0, One0, Zero1, One1;
+    int i, k, Lit, nLits, iOut, iPat = 0, nMarked = 0;
+    if ( iQueue == Vec_IntSize(vQueue) )
+        return 0;
+    // each object has two words: the mask of patterns where it is 0 and where it is 1
+    Vec_WrdFill( vSims, 2 * Gia_ManObjNum(p), 0 );
+    pSim = Vec_WrdEntryP( vSims, 0 );
+    pSim[0] = ~(word)0;
+    for ( i = 0; i < Vec_IntSize(vPats); i += nLits + 1, iPat++ )
+    {
+        nLits = Vec_IntEntry( vPats, i );
+        for ( k = 0; k < nLits; k++ )
+        {
+            Lit = Vec_IntEntry( vPats, i + 1 + k );
+            pSim = Vec_WrdEntryP( vSims, 2 * Gia_ObjId(p, Gia_ManCi(p, Abc_Lit2Var(Lit))) );
+            pSim[!Abc_LitIsCompl(Lit)] |= ((word)1 << iPat);
+        }
+    }
+    assert( iPat <= PAR_SIM_PATS );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        pSim  = Vec_WrdEntryP( vSims, 2 * i );
+        pSim0 = Vec_WrdEntryP( vSims, 2 * Gia_ObjFaninId0(pObj, i) );
+        pSim1 = Vec_WrdEntryP( vSims, 2 * Gia_ObjFaninId1(pObj, i) );
+        Zero0 = pSim0[Gia_ObjFaninC0(pObj)];  One0 = pSim0[!Gia_ObjFaninC0(pObj)];
+        Zero1 = pSim1[Gia_ObjFaninC1(pObj)];  One1 = pSim1[!Gia_ObjFaninC1(pObj)];
+        pSim[0] = Zero0 | Zero1;
+        pSim[1] = One0 & One1;
+    }
+    Vec_IntForEachEntryStart( vQueue, iOut, i, iQueue )
+    {
+        pObj = Gia_ManCo( p, iOut );
+        pSim0 = Vec_WrdEntryP( vSims, 2 * Gia_ObjFaninId0p(p, pObj) );
+        if ( pSim0[!Gia_ObjFaninC0(pObj)] == 0 || pObj->fMark0 )
+            continue;
+        pObj->fMark0 = 1;
+        nMarked++;
+    }
+    return nMarked;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs concurrent SAT solving of the outputs.]
+
+  Description [The outputs of the speculatively reduced miter are ordered
+  topologically and scheduled in small batches to the worker threads. Each
+  worker proves the batch with its own solver over the window containing
+  the cones of the batch outputs. The counter-examples are collected by
+  the main thread, which saves them for class refinement and uses them to
+  disprove pending outputs by simulation. The result is the same as that
+  of Cec_ManSatSolve(): the CO marks are set and the patterns are saved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSatSolvePar( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPars, int nProcs )
+{
+    Cec_ParThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Cec_ManSat_t Stats;
+    Vec_Int_t * vQueue, * vPats, * vPat;
+    Vec_Wrd_t * vSims;
+    Gia_Obj_t * pObj;
+    int * pCosts, * pPerm;
+    int i, k, n, status, nLits, nBatch, iQueue = 0, nPats = 0;
+    int nSimDisproved = 0, fRunning = 1, fStop = 0;
+    abctime clk = Abc_Clock();
+    if ( nProcs <= 1 )
+    {
+        Cec_ManSatSolve( pPat, pAig, pPars );
+        return;
+    }
+    if ( nProcs > PAR_THR_MAX )
+    {
+        Abc_Print( 0, "The number of threads (%d) exceeds the precompiled limit (%d).\n", nProcs, PAR_THR_MAX );
+        nProcs = PAR_THR_MAX;
+    }
+    // reset the manager
+    if ( pPat )
+    {
+        pPat->iStart = Vec_StrSize(pPat->vStorage);
+        pPat->nPats = 0;
+        pPat->nPatLits = 0;
+        pPat->nPatLitsMin = 0;
+    }
+    // order the outputs topologically
+    vQueue = Vec_IntAlloc( Gia_ManCoNum(pAig) );
+    pCosts = ABC_ALLOC( int, Gia_ManCoNum(pAig) );
+    Gia_ManForEachCo( pAig, pObj, i )
+    {
+        pCosts[i] = Gia_ObjFaninId0p( pAig, pObj );
+        pObj->fMark0 = 0;
+        pObj->fMark1 = Gia_ObjIsConst0(Gia_ObjFanin0(pObj));
+    }
+    pPerm = Abc_MergeSortCost( pCosts, Gia_ManCoNum(pAig) );
+    for ( i = 0; i < Gia_ManCoNum(pAig); i++ )
+        if ( !Gia_ManCo(pAig, pPerm[i])->fMark1 )
+            Vec_IntPush( vQueue, pPerm[i] );
+    ABC_FREE( pPerm );
+    ABC_FREE( pCosts );
+    // small batches keep the threads busy and the windows local
+    nBatch = Abc_MinInt( 32, Abc_MaxInt( 1, Vec_IntSize(vQueue) / (8 * nProcs) ) );
+    vPats  = Vec_IntAlloc( 1000 );
+    vPat   = Vec_IntAlloc( 100 );
+    vSims  = Vec_WrdAlloc( 0 );
+    // start the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Cec_ParThData_t) );
+        ThData[i].pPars    = pPars;
+        ThData[i].pPat     = Cec_ManPatStart();
+        ThData[i].vOuts    = Vec_IntAlloc( nBatch );
+        ThData[i].vCiMap   = Vec_IntAlloc( 100 );
+        ThData[i].vStatus  = Vec_StrAlloc( nBatch );
+        ThData[i].vCexes   = Vec_IntAlloc( 100 );
+        ThData[i].iThread  = i;
+        status = pthread_create( WorkerThread + i, NULL, Cec_ManParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // run the threads
+    while ( fRunning )
+    {
+        for ( i = 0; i < nProcs; i++ )
+        {
+            if ( ThData[i].fWorking )
+                continue;
+            // collect the results of the finished batch
+            if ( ThData[i].p != NULL )
+            {
+                for ( k = 0; k < Vec_StrSize(ThData[i].vStatus); k++ )
+                {
+                    status = (int)Vec_StrEntry( ThData[i].vStatus, k );
+                    pObj = Gia_ManCo( pAig, Vec_IntEntry(ThData[i].vOuts, k) );
+                    pObj->fMark0 = (status == 0);
+                    pObj->fMark1 = (status == 1);
+                }
+                for ( k = 0; k < Vec_IntSize(ThData[i].vCexes); k += nLits + 2 )
+                {
+                    nLits = Vec_IntEntry( ThData[i].vCexes, k+1 );
+                    Vec_IntClear( vPat );
+                    for ( n = 0; n < nLits; n++ )
+                        Vec_IntPush( vPat, Vec_IntEntry(ThData[i].vCexes, k+2+n) );
+                    if ( pPat )
+                    {
+                        abctime clk3 = Abc_Clock();
+                        Cec_ManPatSavePatternCSat( pPat, vPat );
+                        pPat->nPats++;
+                        pPat->nPatsAll++;
+                        pPat->nPatLitsMin += nLits;
+                        pPat->nPatLitsMinAll += nLits;
+                        pPat->timeTotalSave += Abc_Clock() - clk3;
+                    }
+                    // accumulate the pattern for simulation
+                    Vec_IntPush( vPats, nLits );
+                    Vec_IntAppend( vPats, vPat );
+                    if ( ++nPats == PAR_SIM_PATS )
+                    {
+                        nSimDisproved += Cec_ManParFilterQueue( pAig, vPats, vQueue, iQueue, vSims );
+                        Vec_IntClear( vPats );
+                        nPats = 0;
+                    }
+                    if ( pPars->fCheckMiter )
+                        fStop = 1;
+                }
+                Gia_ManStopP( &ThData[i].p );
+            }
+            if ( fStop )
+                continue;
+            // collect the next batch skipping the outputs disproved by simulation
+            Vec_IntClear( ThData[i].vOuts );
+            for ( ; iQueue < Vec_IntSize(vQueue) && Vec_IntSize(ThData[i].vOuts) < nBatch; iQueue++ )
+                if ( !Gia_ManCo(pAig, Vec_IntEntry(vQueue, iQueue))->fMark0 )
+                    Vec_IntPush( ThData[i].vOuts, Vec_IntEntry(vQueue, iQueue) );
+            if ( Vec_IntSize(ThData[i].vOuts) == 0 )
+                continue;
+            // start a new batch
+            ThData[i].p = Cec_ManParDeriveWindow( pAig, ThData[i].vOuts, ThData[i].vCiMap );
+            ThData[i].fWorking = 1;
+        }
+        fRunning = 0;
+        for ( i = 0; i < nProcs; i++ )
+            if ( ThData[i].fWorking || ThData[i].p != NULL )
+                fRunning = 1;
+        if ( !fStop && iQueue < Vec_IntSize(vQueue) )
+            fRunning = 1;
+    }
+    // stop the threads
+    memset( &Stats, 0, sizeof(Cec_ManSat_t) );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        assert( !ThData[i].fWorking && ThData[i].p == NULL );
+        Stats.nSatUnsat    += ThData[i].nSatUnsat;
+        Stats.nSatSat      += ThData[i].nSatSat;
+        Stats.nSatUndec    += ThData[i].nSatUndec;
+        Stats.nConfUnsat   += ThData[i].nConfUnsat;
+        Stats.nConfSat     += ThData[i].nConfSat;
+        Stats.nConfUndec   += ThData[i].nConfUndec;
+        Stats.timeSatUnsat += ThData[i].timeSatUnsat;
+        Stats.timeSatSat   += ThData[i].timeSatSat;
+        Stats.timeSatUndec += ThData[i].timeSatUndec;
+        Stats.timeTotal    += ThData[i].clkUsed;
+        Cec_ManPatStop( ThData[i].pPat );
+        Vec_IntFree( ThData[i].vOuts );
+        Vec_IntFree( ThData[i].vCiMap );
+        Vec_StrFree( ThData[i].vStatus );
+        Vec_IntFree( ThData[i].vCexes );
+        ThData[i].fWorking = 1;
+        pthread_join( WorkerThread[i], NULL );
+    }
+    Stats.nSatTotal = Stats.nSatUnsat + Stats.nSatSat + Stats.nSatUndec;
+    if ( pPars->fVerbose )
+    {
+        Stats.pAig  = pAig;
+        Stats.pPars = pPars;
+        Cec_ManSatPrintStats( &Stats );
+        Abc_Print( 1, "Threads = %d.  Batch = %d.  Outputs disproved by simulation = %d.  ", nProcs, nBatch, nSimDisproved );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        for ( i = 0; i < nProcs; i++ )
+        {
+            Abc_Print( 1, "Thread %d : ", i );
+            Abc_PrintTime( 1, "Time", ThData[i].clkUsed );
+        }
+    }
+    Vec_IntFree( vQueue );
+    Vec_IntFree( vPats );
+    Vec_IntFree( vPat );
+    Vec_WrdFree( vSims );
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
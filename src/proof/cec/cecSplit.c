@@ -37,6 +37,16 @@
 
 #endif
 
+#ifndef _WIN32
+#include <time.h>
+#include <errno.h>
+#include <signal.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -47,6 +57,7 @@ ABC_NAMESPACE_IMPL_START
 #ifndef ABC_USE_PTHREADS
 
 int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
+int Cec_GiaSplitTestProc( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int nMemLimit, char * pFileCheck, int fVerbose, int fVeryVerbose, int fSilent ) { return -1; }
 
 #else // pthreads are used
 
@@ -768,6 +779,696 @@ int Cec_GiaSplitTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Multi-process case-splitting.]
+
+  Description [The broker keeps the open cubes (partial assignments of
+  the PIs) and sends each cube to a worker process as the cofactored AIG
+  in the binary AIGER format. The worker replies with the status line
+  "<status> <vars> <confs>" where the status is 0 (SAT), 1 (UNSAT) or -1
+  (UNDECIDED), followed by the line with the PI values of the model if
+  the cube is SAT. Since the workers only exchange AIGER and text, they
+  live in separate address spaces: a worker that crashes or exceeds the
+  memory limit loses its current cube, which is split further, and is
+  restarted. The open cubes are periodically saved into the checkpoint
+  file, which is used to resume an interrupted run.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef _WIN32
+
+int Cec_GiaSplitTestProc( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int nMemLimit, char * pFileCheck, int fVerbose, int fVeryVerbose, int fSilent )
+{
+    printf( "Multi-process case-splitting is not supported on Windows.\n" );
+    return -1;
+}
+
+#else
+
+typedef struct Cec_SplitProc_t_ Cec_SplitProc_t;
+struct Cec_SplitProc_t_
+{
+    pid_t        Pid;          // worker process (-1 if not running)
+    FILE *       pFileIn;      // requests to the worker (NULL if not running)
+    FILE *       pFileOut;     // replies of the worker
+    Vec_Int_t *  vCube;        // the cube being solved (NULL if idle)
+};
+
+typedef struct Cec_SplitBro_t_ Cec_SplitBro_t;
+struct Cec_SplitBro_t_
+{
+    Gia_Man_t *  p;            // the current single-output problem
+    Cec_SplitProc_t Procs[PAR_THR_MAX]; // worker processes
+    Vec_Ptr_t *  vStack;       // open cubes
+    char *       pFileCheck;   // checkpoint file
+    double       Progress;     // the part of the space proved UNSAT
+    int          nProcs;       // the number of worker processes
+    int          nTimeOut;     // runtime limit per cube
+    int          nMemLimit;    // memory limit per worker in MB
+    int          nIterMax;     // the max number of case-splits
+    int          LookAhead;    // look-ahead during cofactoring
+    int          nPis;         // the number of PIs
+    int          iOut;         // the current output
+    int          fOneUndef;    // one of the outputs is undecided
+    int          nIter;        // the number of case-splits
+    int          nCrashes;     // the number of crashed workers
+    int          nDropped;     // cubes that cannot be split further
+    int          fVerbose;     // verbose stats
+    int          fVeryVerbose; // verbose stats
+    int          timeCheck;    // the last time checkpoint was written
+    abctime      clkTotal;     // starting time
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the cofactor of the AIG w.r.t. the cube.]
+
+  Description [The PIs are preserved, so that the model of the cofactor
+  is the model of the original AIG.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cec_GiaSplitDeriveCube( Gia_Man_t * p, Vec_Int_t * vCube )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Gia_Obj_t * pObj;
+    int i, iLit;
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Vec_IntForEachEntry( vCube, iLit, i )
+        Gia_ManPi( p, Abc_Lit2Var(iLit) )->Value = !Abc_LitIsCompl(iLit);
+    Gia_ManHashAlloc( pNew );
+    Gia_ManForEachAnd( p, pObj, i )
+        pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker process.]
+
+  Description [Each request is the size of the AIGER data followed by
+  the data. The request of size 0 stops the worker.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_GiaSplitWorker( FILE * pIn, FILE * pOut, int nTimeOut, int nMemLimit )
+{
+    Vec_Str_t * vBuffer = Vec_StrAlloc( 1000 );
+    Gia_Man_t * pPart;
+    Cnf_Dat_t * pCnf;
+    int i, nSize, status, nVars, nConfs;
+    if ( nMemLimit > 0 )
+    {
+        struct rlimit Limit;
+        Limit.rlim_cur = Limit.rlim_max = (rlim_t)nMemLimit << 20;
+        setrlimit( RLIMIT_AS, &Limit );
+    }
+    while ( fread( &nSize, sizeof(int), 1, pIn ) == 1 && nSize > 0 )
+    {
+        Vec_StrFill( vBuffer, nSize, 0 );
+        if ( fread( Vec_StrArray(vBuffer), 1, nSize, pIn ) != (size_t)nSize )
+            break;
+        pPart  = Gia_AigerReadFromMemory( Vec_StrArray(vBuffer), nSize, 0, 0 );
+        pCnf   = Cec_GiaDeriveGiaRemapped( pPart );
+        status = Cnf_GiaSolveOne( pPart, pCnf, nTimeOut, &nVars, &nConfs );
+        Cnf_DataFree( pCnf );
+        fprintf( pOut, "%d %d %d\n", status, nVars, nConfs );
+        if ( status == 0 )
+        {
+            for ( i = 0; i < Gia_ManPiNum(pPart); i++ )
+                fputc( '0' + Abc_InfoHasBit(pPart->pCexComb->pData, i), pOut );
+            fputc( '\n', pOut );
+        }
+        fflush( pOut );
+        Gia_ManStop( pPart );
+    }
+    Vec_StrFree( vBuffer );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops worker processes.]
+
+  Description [A worker, which could not be (re)started, has Pid equal
+  to -1 and no pipes; stopping it again does nothing.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitProcStart( Cec_SplitBro_t * p, Cec_SplitProc_t * pProc )
+{
+    int pToWorker[2], pToBroker[2];
+    pProc->vCube    = NULL;
+    pProc->pFileIn  = NULL;
+    pProc->pFileOut = NULL;
+    pProc->Pid      = -1;
+    if ( pipe(pToWorker) == -1 )
+        return 0;
+    if ( pipe(pToBroker) == -1 )
+    {
+        close( pToWorker[0] );
+        close( pToWorker[1] );
+        return 0;
+    }
+    fflush( stdout );
+    pProc->Pid = fork();
+    if ( pProc->Pid == -1 )
+    {
+        close( pToWorker[0] );  close( pToWorker[1] );
+        close( pToBroker[0] );  close( pToBroker[1] );
+        return 0;
+    }
+    if ( pProc->Pid == 0 )
+    {
+        FILE * pIn, * pOut;
+        close( pToWorker[1] );
+        close( pToBroker[0] );
+        pIn  = fdopen( pToWorker[0], "rb" );
+        pOut = fdopen( pToBroker[1], "wb" );
+        Cec_GiaSplitWorker( pIn, pOut, p->nTimeOut, p->nMemLimit );
+        _exit( 0 );
+    }
+    close( pToWorker[0] );
+    close( pToBroker[1] );
+    pProc->pFileIn  = fdopen( pToWorker[1], "wb" );
+    pProc->pFileOut = fdopen( pToBroker[0], "rb" );
+    return 1;
+}
+void Cec_GiaSplitProcStop( Cec_SplitProc_t * pProc, int fKill )
+{
+    int nSize = 0;
+    if ( pProc->vCube )
+        Vec_IntFree( pProc->vCube );
+    pProc->vCube = NULL;
+    if ( pProc->pFileIn == NULL )
+        return;
+    if ( fKill )
+        kill( pProc->Pid, SIGKILL );
+    else
+    {
+        fwrite( &nSize, sizeof(int), 1, pProc->pFileIn );
+        fflush( pProc->pFileIn );
+    }
+    fclose( pProc->pFileIn );
+    fclose( pProc->pFileOut );
+    waitpid( pProc->Pid, NULL, 0 );
+    pProc->pFileIn  = NULL;
+    pProc->pFileOut = NULL;
+    pProc->Pid      = -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Communicates with a worker process.]
+
+  Description [Returns the status of the cube or -2 if the worker has
+  crashed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitProcSend( Cec_SplitProc_t * pProc, Gia_Man_t * pPart )
+{
+    Vec_Str_t * vStr = Gia_AigerWriteIntoMemoryStr( pPart );
+    int nSize = Vec_StrSize(vStr), RetValue = 1;
+    if ( fwrite( &nSize, sizeof(int), 1, pProc->pFileIn ) != 1 )
+        RetValue = 0;
+    else if ( fwrite( Vec_StrArray(vStr), 1, nSize, pProc->pFileIn ) != (size_t)nSize )
+        RetValue = 0;
+    else if ( fflush( pProc->pFileIn ) != 0 )
+        RetValue = 0;
+    Vec_StrFree( vStr );
+    return RetValue;
+}
+int Cec_GiaSplitProcReceive( Cec_SplitProc_t * pProc, Vec_Str_t * vModel, int * pnVars, int * pnConfs )
+{
+    char Buffer[100];
+    int status;
+    if ( fgets( Buffer, 100, pProc->pFileOut ) == NULL )
+        return -2;
+    if ( sscanf( Buffer, "%d %d %d", &status, pnVars, pnConfs ) != 3 )
+        return -2;
+    if ( status != 0 )
+        return status;
+    if ( fgets( Vec_StrArray(vModel), Vec_StrSize(vModel), pProc->pFileOut ) == NULL )
+        return -2;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes and reads the checkpoint.]
+
+  Description [The checkpoint lists the open cubes including those being
+  solved by the workers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_GiaSplitCubeWrite( FILE * pFile, Vec_Int_t * vCube )
+{
+    int i, iLit;
+    fprintf( pFile, "cube" );
+    Vec_IntForEachEntry( vCube, iLit, i )
+        fprintf( pFile, " %d", iLit );
+    fprintf( pFile, "\n" );
+}
+void Cec_GiaSplitCheckpointWrite( Cec_SplitBro_t * p )
+{
+    char FileNameTemp[1000];
+    Vec_Int_t * vCube;
+    FILE * pFile;
+    int i;
+    sprintf( FileNameTemp, "%s.tmp", p->pFileCheck );
+    pFile = fopen( FileNameTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open checkpoint file \"%s\" for writing.\n", FileNameTemp );
+        return;
+    }
+    fprintf( pFile, "# Checkpoint of &splitprove\n" );
+    fprintf( pFile, "pis %d\n", p->nPis );
+    fprintf( pFile, "output %d %d\n", p->iOut, p->fOneUndef );
+    fprintf( pFile, "progress %.17g\n", p->Progress );
+    fprintf( pFile, "iter %d\n", p->nIter );
+    for ( i = 0; i < p->nProcs; i++ )
+        if ( p->Procs[i].vCube )
+            Cec_GiaSplitCubeWrite( pFile, p->Procs[i].vCube );
+    Vec_PtrForEachEntry( Vec_Int_t *, p->vStack, vCube, i )
+        Cec_GiaSplitCubeWrite( pFile, vCube );
+    fclose( pFile );
+    rename( FileNameTemp, p->pFileCheck );
+    p->timeCheck = (int)time(NULL);
+}
+int Cec_GiaSplitCheckpointRead( Cec_SplitBro_t * p )
+{
+    char Buffer[1000];
+    Vec_Int_t * vCube;
+    FILE * pFile;
+    int c, iLit, nPis = -1, iOut = 0, fOneUndef = 0, fError = 0;
+    pFile = fopen( p->pFileCheck, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    while ( !fError && fscanf( pFile, "%999s", Buffer ) == 1 )
+    {
+        if ( Buffer[0] == '#' )
+        {
+            while ( fgets( Buffer, 1000, pFile ) && Buffer[strlen(Buffer)-1] != '\n' );
+            continue;
+        }
+        if ( !strcmp(Buffer, "pis") )
+            fError = fscanf( pFile, "%d", &nPis ) != 1;
+        else if ( !strcmp(Buffer, "output") )
+            fError = fscanf( pFile, "%d %d", &iOut, &fOneUndef ) != 2 || iOut < 0;
+        else if ( !strcmp(Buffer, "progress") )
+            fError = fscanf( pFile, "%lf", &p->Progress ) != 1;
+        else if ( !strcmp(Buffer, "iter") )
+            fError = fscanf( pFile, "%d", &p->nIter ) != 1;
+        else if ( !strcmp(Buffer, "cube") )
+        {
+            vCube = Vec_IntAlloc( 16 );
+            while ( 1 )
+            {
+                c = fgetc( pFile );
+                while ( c == ' ' || c == '\t' || c == '\r' )
+                    c = fgetc( pFile );
+                if ( c == '\n' || c == EOF )
+                    break;
+                ungetc( c, pFile );
+                if ( fscanf( pFile, "%d", &iLit ) != 1 || iLit < 0 || iLit >= 2 * p->nPis )
+                {
+                    fError = 1;
+                    break;
+                }
+                Vec_IntPush( vCube, iLit );
+            }
+            Vec_PtrPush( p->vStack, vCube );
+        }
+    }
+    fclose( pFile );
+    if ( fError || nPis != p->nPis || iOut >= Gia_ManPoNum(p->p) )
+    {
+        if ( fError )
+            printf( "Checkpoint file \"%s\" is malformed and is ignored.\n", p->pFileCheck );
+        else
+            printf( "Checkpoint file \"%s\" does not match the current AIG and is ignored.\n", p->pFileCheck );
+        Vec_PtrForEachEntry( Vec_Int_t *, p->vStack, vCube, iOut )
+            Vec_IntFree( vCube );
+        Vec_PtrClear( p->vStack );
+        p->Progress = 0;
+        p->nIter = 0;
+        return 0;
+    }
+    p->iOut = iOut;
+    p->fOneUndef = fOneUndef;
+    printf( "Resuming from checkpoint \"%s\" (output %d, %d open cubes, %.4f %% solved).\n",
+        p->pFileCheck, iOut, Vec_PtrSize(p->vStack), 100*p->Progress );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Handles the result of one cube.]
+
+  Description [Returns 1 if the problem is SAT.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitProcResult( Cec_SplitBro_t * p, Gia_Man_t * pOne, Vec_Int_t * vCube, int status, Vec_Str_t * vModel, int nVars, int nConfs, int iProc )
+{
+    Gia_Man_t * pPart;
+    Vec_Int_t * vCube0, * vCube1;
+    int i, iLit, * pModel, nFanouts, Cost, iVar;
+    int Depth = Vec_IntSize(vCube);
+    if ( status == 1 )
+        p->Progress += 1.0 / pow(2, Depth);
+    if ( p->fVerbose )
+        Cec_GiaSplitPrint( iProc+1, Depth, nVars, nConfs, status, p->Progress, Abc_Clock() - p->clkTotal );
+    if ( status == 1 )
+        return 0;
+    if ( status == 0 )
+    {
+        pModel = ABC_CALLOC( int, p->nPis );
+        for ( i = 0; i < p->nPis; i++ )
+            pModel[i] = (Vec_StrEntry(vModel, i) == '1');
+        Vec_IntForEachEntry( vCube, iLit, i )
+            pModel[Abc_Lit2Var(iLit)] = !Abc_LitIsCompl(iLit);
+        pOne->pCexComb = Abc_CexCreate( 0, p->nPis, pModel, 0, 0, 0 );
+        ABC_FREE( pModel );
+        return 1;
+    }
+    // the cube is undecided or the worker has crashed
+    pPart = Cec_GiaSplitDeriveCube( pOne, vCube );
+    if ( Gia_ManAndNum(pPart) == 0 )
+    {
+        p->nDropped++;
+        Gia_ManStop( pPart );
+        return 0;
+    }
+    iVar = Gia_SplitCofVar( pPart, p->LookAhead, &nFanouts, &Cost );
+    if ( p->fVeryVerbose )
+        printf( "Var = %5d. Fanouts = %5d. Cost = %8d.  AndBefore = %6d.\n", iVar, nFanouts, Cost, Gia_ManAndNum(pPart) );
+    Gia_ManStop( pPart );
+    if ( nFanouts == 0 )
+    {
+        p->nDropped++;
+        return 0;
+    }
+    vCube0 = Vec_IntDup( vCube );
+    vCube1 = Vec_IntDup( vCube );
+    Vec_IntPush( vCube0, Abc_Var2Lit(iVar, 1) );
+    Vec_IntPush( vCube1, Abc_Var2Lit(iVar, 0) );
+    Vec_PtrPush( p->vStack, vCube0 );
+    Vec_PtrPush( p->vStack, vCube1 );
+    p->nIter++;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one output using the worker processes.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitTestProcInt( Cec_SplitBro_t * p, Gia_Man_t * pOne )
+{
+    struct pollfd pFds[PAR_THR_MAX];
+    int pMap[PAR_THR_MAX];
+    Vec_Str_t * vModel = Vec_StrStart( p->nPis + 10 );
+    Gia_Man_t * pPart;
+    Cec_SplitProc_t * pProc;
+    int i, nFds, status, nVars, nConfs, RetValue = -1;
+    p->nDropped = 0;
+    if ( Vec_PtrSize(p->vStack) == 0 )
+        Vec_PtrPush( p->vStack, Vec_IntAlloc(0) );
+    while ( 1 )
+    {
+        // send the open cubes to the idle workers
+        for ( i = 0; i < p->nProcs && Vec_PtrSize(p->vStack) > 0; i++ )
+        {
+            pProc = p->Procs + i;
+            if ( pProc->vCube || pProc->pFileIn == NULL )
+                continue;
+            pProc->vCube = (Vec_Int_t *)Vec_PtrPop( p->vStack );
+            pPart = Cec_GiaSplitDeriveCube( pOne, pProc->vCube );
+            status = Cec_GiaSplitProcSend( pProc, pPart );
+            Gia_ManStop( pPart );
+            if ( status )
+                continue;
+            // the worker is not responsive
+            Vec_PtrPush( p->vStack, pProc->vCube );
+            pProc->vCube = NULL;
+            Cec_GiaSplitProcStop( pProc, 1 );
+            p->nCrashes++;
+            if ( !Cec_GiaSplitProcStart( p, pProc ) )
+            {
+                printf( "Cannot restart worker process %d.\n", i );
+                goto finish;
+            }
+        }
+        // wait for the busy workers
+        for ( nFds = i = 0; i < p->nProcs; i++ )
+            if ( p->Procs[i].vCube )
+            {
+                pFds[nFds].fd = fileno( p->Procs[i].pFileOut );
+                pFds[nFds].events = POLLIN;
+                pFds[nFds].revents = 0;
+                pMap[nFds++] = i;
+            }
+        if ( nFds == 0 && Vec_PtrSize(p->vStack) > 0 )
+        {
+            // a worker restarted after a failed request gets the cube next time
+            for ( i = 0; i < p->nProcs; i++ )
+                if ( p->Procs[i].pFileIn )
+                    break;
+            if ( i < p->nProcs )
+                continue;
+            printf( "No worker process is running.\n" );
+            goto finish;
+        }
+        if ( nFds == 0 )
+        {
+            RetValue = p->nDropped ? -1 : 1;
+            break;
+        }
+        if ( poll( pFds, nFds, 1000 ) == -1 && errno != EINTR )
+            goto finish;
+        for ( i = 0; i < nFds; i++ )
+        {
+            if ( pFds[i].revents == 0 )
+                continue;
+            pProc  = p->Procs + pMap[i];
+            status = Cec_GiaSplitProcReceive( pProc, vModel, &nVars, &nConfs );
+            if ( status == -2 )
+            {
+                // the worker has crashed
+                Vec_Int_t * vCube = pProc->vCube;
+                if ( p->fVerbose )
+                    printf( "Worker process %d has crashed while solving cube of size %d.\n", pMap[i], Vec_IntSize(vCube) );
+                pProc->vCube = NULL;
+                Cec_GiaSplitProcStop( pProc, 1 );
+                p->nCrashes++;
+                if ( !Cec_GiaSplitProcStart( p, pProc ) )
+                {
+                    Vec_IntFree( vCube );
+                    printf( "Cannot restart worker process %d.\n", pMap[i] );
+                    goto finish;
+                }
+                pProc->vCube = vCube;
+                nVars = nConfs = 0;
+                status = -1;
+            }
+            if ( Cec_GiaSplitProcResult( p, pOne, pProc->vCube, status, vModel, nVars, nConfs, pMap[i] ) )
+                RetValue = 0;
+            Vec_IntFree( pProc->vCube );
+            pProc->vCube = NULL;
+            if ( RetValue == 0 )
+                goto finish;
+        }
+        if ( p->pFileCheck && (int)time(NULL) > p->timeCheck )
+            Cec_GiaSplitCheckpointWrite( p );
+        if ( p->nIterMax && p->nIter >= p->nIterMax )
+            break;
+    }
+finish:
+    // restart the workers, which are still busy
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        if ( p->Procs[i].vCube == NULL )
+            continue;
+        if ( RetValue == -1 )
+        {
+            Vec_PtrPush( p->vStack, p->Procs[i].vCube );
+            p->Procs[i].vCube = NULL;
+        }
+        Cec_GiaSplitProcStop( p->Procs + i, 1 );
+        if ( !Cec_GiaSplitProcStart( p, p->Procs + i ) )
+            printf( "Cannot restart worker process %d.\n", i );
+    }
+    Vec_StrFree( vModel );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-process case-splitting.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_GiaSplitTestProc( Gia_Man_t * p, int nProcs, int nTimeOut, int nIterMax, int LookAhead, int nMemLimit, char * pFileCheck, int fVerbose, int fVeryVerbose, int fSilent )
+{
+    abctime clkTotal = Abc_Clock();
+    Cec_SplitBro_t Bro, * pBro = &Bro;
+    void (*pSigPipe)(int);
+    Abc_Cex_t * pCex = NULL;
+    Vec_Int_t * vCube;
+    Gia_Man_t * pOne;
+    int i, k, RetValue1, RetValue = -1;
+    Abc_CexFreeP( &p->pCexComb );
+    if ( nProcs > PAR_THR_MAX )
+    {
+        printf( "The number of processes (%d) exceeds the precompiled limit (%d).\n", nProcs, PAR_THR_MAX );
+        return -1;
+    }
+    memset( pBro, 0, sizeof(Cec_SplitBro_t) );
+    pBro->p          = p;
+    pBro->clkTotal   = clkTotal;
+    pBro->vStack     = Vec_PtrAlloc( 1000 );
+    pBro->pFileCheck = pFileCheck;
+    pBro->nProcs     = nProcs;
+    pBro->nTimeOut   = nTimeOut;
+    pBro->nMemLimit  = nMemLimit;
+    pBro->nIterMax   = nIterMax;
+    pBro->LookAhead  = LookAhead;
+    pBro->nPis       = Gia_ManPiNum(p);
+    pBro->fVerbose   = fVerbose;
+    pBro->fVeryVerbose = fVeryVerbose;
+    if ( fVerbose )
+        printf( "Solving CEC problem by cofactoring with %d worker processes (TimeOut = %d sec  MemLimit = %d MB  MaxIter = %d  LookAhead = %d).\n",
+            nProcs, nTimeOut, nMemLimit, nIterMax, LookAhead );
+    if ( pFileCheck )
+        Cec_GiaSplitCheckpointRead( pBro );
+    // the broker should survive the workers
+    pSigPipe = signal( SIGPIPE, SIG_IGN );
+    for ( i = 0; i < nProcs; i++ )
+        if ( !Cec_GiaSplitProcStart( pBro, pBro->Procs + i ) )
+        {
+            printf( "Cannot start worker process %d.\n", i );
+            pBro->nProcs = i;
+            break;
+        }
+    if ( pBro->nProcs == 0 )
+        goto finish;
+    for ( i = pBro->iOut; i < Gia_ManPoNum(p); i++ )
+    {
+        if ( fVerbose )
+            printf( "\nSolving output %d:\n", i );
+        if ( i > pBro->iOut )
+        {
+            pBro->Progress = 0;
+            pBro->iOut = i;
+        }
+        pOne = Gia_ManDupCones( p, &i, 1, 0 );
+        RetValue1 = Cec_GiaSplitTestProcInt( pBro, pOne );
+        if ( RetValue1 == 0 )
+        {
+            pCex = pOne->pCexComb; pOne->pCexComb = NULL;
+            pCex->iPo = i;
+            RetValue = 0;
+        }
+        Gia_ManStop( pOne );
+        if ( RetValue == 0 )
+            break;
+        if ( RetValue1 == -1 )
+            pBro->fOneUndef = 1;
+        if ( Vec_PtrSize(pBro->vStack) == 0 )
+            continue;
+        // keep the open cubes in the checkpoint or give up on this output
+        if ( pFileCheck )
+            break;
+        Vec_PtrForEachEntry( Vec_Int_t *, pBro->vStack, vCube, k )
+            Vec_IntFree( vCube );
+        Vec_PtrClear( pBro->vStack );
+    }
+    if ( RetValue == -1 && Vec_PtrSize(pBro->vStack) == 0 )
+        RetValue = pBro->fOneUndef ? -1 : 1;
+    else if ( RetValue == 0 )
+        p->pCexComb = pCex;
+finish:
+    for ( i = 0; i < pBro->nProcs; i++ )
+        Cec_GiaSplitProcStop( pBro->Procs + i, 0 );
+    signal( SIGPIPE, pSigPipe );
+    // keep the checkpoint only if there is work left
+    if ( pFileCheck && Vec_PtrSize(pBro->vStack) > 0 )
+    {
+        Cec_GiaSplitCheckpointWrite( pBro );
+        if ( !fSilent )
+            printf( "The open cubes are saved in checkpoint file \"%s\".\n", pFileCheck );
+    }
+    else if ( pFileCheck )
+        unlink( pFileCheck );
+    Vec_PtrForEachEntry( Vec_Int_t *, pBro->vStack, vCube, i )
+        Vec_IntFree( vCube );
+    Vec_PtrFree( pBro->vStack );
+    if ( !fSilent )
+    {
+        if ( RetValue == 0 )
+            printf( "Problem is SAT " );
+        else if ( RetValue == 1 )
+            printf( "Problem is UNSAT " );
+        else if ( RetValue == -1 )
+            printf( "Problem is UNDECIDED " );
+        else assert( 0 );
+        printf( "after %d case-splits", pBro->nIter );
+        if ( pBro->nCrashes )
+            printf( " and %d worker restarts", pBro->nCrashes );
+        printf( ".  " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+        fflush( stdout );
+    }
+    return RetValue;
+}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Print stats about cofactoring variables.]
@@ -20,6 +20,17 @@
 
 #include "dchInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,6 +38,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define DCH_SIM_ROUNDS 8 // the number of rounds of random simulation
+
 static inline unsigned * Dch_ObjSim( Vec_Ptr_t * vSims, Aig_Obj_t * pObj )
 { 
     return (unsigned *)Vec_PtrEntry( vSims, pObj->Id ); 
@@ -189,7 +202,7 @@ int Dch_NodesAreEqual( void * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
 
 /**Function*************************************************************
 
-  Synopsis    [Perform random simulation.]
+  Synopsis    [Assigns random simulation info to the CIs.]
 
   Description []
                
@@ -198,9 +211,9 @@ int Dch_NodesAreEqual( void * p, Aig_Obj_t * pObj0, Aig_Obj_t * pObj1 )
   SeeAlso     []
 
 ***********************************************************************/
-void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
+void Dch_AssignRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
 {
-    unsigned * pSim, * pSim0, * pSim1;
+    unsigned * pSim;
     Aig_Obj_t * pObj;
     int i, k, nWords;
     nWords = (unsigned *)Vec_PtrEntry(vSims, 1) - (unsigned *)Vec_PtrEntry(vSims, 0);
@@ -218,6 +231,26 @@ void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
             pSim[k] = Dch_ObjRandomSim();
         pSim[0] <<= 1;
     }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the internal nodes.]
+
+  Description [Does not change the global state, so that several copies
+  of simulation info can be processed by different threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_SimulateNodes( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
+{
+    unsigned * pSim, * pSim0, * pSim1;
+    Aig_Obj_t * pObj;
+    int i, k, nWords;
+    nWords = (unsigned *)Vec_PtrEntry(vSims, 1) - (unsigned *)Vec_PtrEntry(vSims, 0);
 
     // simulate AIG in the topological order
     Aig_ManForEachNode( pAig, pObj, i )
@@ -247,9 +280,86 @@ void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
                 pSim[k] = pSim0[k] & pSim1[k];
         }
     }
-    // get simulation information for primary outputs
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Perform random simulation.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
+{
+    Dch_AssignRandomSimulation( pAig, vSims );
+    Dch_SimulateNodes( pAig, vSims );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates several rounds of random patterns concurrently.]
+
+  Description [The random patterns are generated by the calling thread in 
+  the same order as in the sequential flow, so the resulting classes do 
+  not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Dch_PerformRandomSimulationPar( Aig_Man_t * pAig, Vec_Ptr_t ** pvSims, int nRounds )
+{
+    int i;
+    for ( i = 0; i < nRounds; i++ )
+        Dch_PerformRandomSimulation( pAig, pvSims[i] );
+}
+
+#else // pthreads are used
+
+typedef struct Dch_ParSimData_t_ Dch_ParSimData_t;
+struct Dch_ParSimData_t_
+{
+    Aig_Man_t *      pAig;           // the AIG to simulate
+    Vec_Ptr_t *      vSims;          // simulation info of this round
+};
+
+void * Dch_SimulateNodesThread( void * pArg )
+{
+    Dch_ParSimData_t * pData = (Dch_ParSimData_t *)pArg;
+    Dch_SimulateNodes( pData->pAig, pData->vSims );
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+void Dch_PerformRandomSimulationPar( Aig_Man_t * pAig, Vec_Ptr_t ** pvSims, int nRounds )
+{
+    Dch_ParSimData_t Data[DCH_SIM_ROUNDS];
+    pthread_t WorkerThread[DCH_SIM_ROUNDS];
+    int i, status;
+    assert( nRounds <= DCH_SIM_ROUNDS );
+    for ( i = 0; i < nRounds; i++ )
+        Dch_AssignRandomSimulation( pAig, pvSims[i] );
+    for ( i = 1; i < nRounds; i++ )
+    {
+        Data[i].pAig  = pAig;
+        Data[i].vSims = pvSims[i];
+        status = pthread_create( WorkerThread + i, NULL, Dch_SimulateNodesThread, (void *)(Data + i) );  assert( status == 0 );
+    }
+    Dch_SimulateNodes( pAig, pvSims[0] );
+    for ( i = 1; i < nRounds; i++ )
+        pthread_join( WorkerThread[i], NULL );
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Derives candidate equivalence classes of AIG nodes.]
@@ -261,28 +371,39 @@ void Dch_PerformRandomSimulation( Aig_Man_t * pAig, Vec_Ptr_t * vSims )
   SeeAlso     []
 
 ***********************************************************************/
-Dch_Cla_t * Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int fVerbose )
+Dch_Cla_t * Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int nProcs, int fVerbose )
 {
     Dch_Cla_t * pClasses;
-    Vec_Ptr_t * vSims;
-    int i;
-    // allocate simulation information
-    vSims = Vec_PtrAllocSimInfo( Aig_ManObjNumMax(pAig), nWords );
-    // run random simulation from the primary inputs
-    Dch_PerformRandomSimulation( pAig, vSims );
+    Vec_Ptr_t * vSims[DCH_SIM_ROUNDS];
+    int i, k, nRounds;
+    // allocate simulation information for the rounds simulated together
+    nRounds = Abc_MinInt( Abc_MaxInt(nProcs, 1), DCH_SIM_ROUNDS );
+    for ( k = 0; k < nRounds; k++ )
+        vSims[k] = Vec_PtrAllocSimInfo( Aig_ManObjNumMax(pAig), nWords );
     // start storage for equivalence classes
     pClasses = Dch_ClassesStart( pAig );
-    Dch_ClassesSetData( pClasses, vSims, Dch_NodeHash, Dch_NodeIsConst, Dch_NodesAreEqual );
-    // hash nodes by sim info
-    Dch_ClassesPrepare( pClasses, 0, 0 );
     // iterate random simulation
-    for ( i = 0; i < 7; i++ )
+    for ( i = 0; i < DCH_SIM_ROUNDS; i += nRounds )
     {
-        Dch_PerformRandomSimulation( pAig, vSims );
-        Dch_ClassesRefine( pClasses );
+        nRounds = Abc_MinInt( nRounds, DCH_SIM_ROUNDS - i );
+        // run random simulation from the primary inputs
+        if ( nRounds == 1 )
+            Dch_PerformRandomSimulation( pAig, vSims[0] );
+        else
+            Dch_PerformRandomSimulationPar( pAig, vSims, nRounds );
+        for ( k = 0; k < nRounds; k++ )
+        {
+            Dch_ClassesSetData( pClasses, vSims[k], Dch_NodeHash, Dch_NodeIsConst, Dch_NodesAreEqual );
+            // hash nodes by sim info
+            if ( i + k == 0 )
+                Dch_ClassesPrepare( pClasses, 0, 0 );
+            else
+                Dch_ClassesRefine( pClasses );
+        }
     }
     // clean up and return
-    Vec_PtrFree( vSims );
+    for ( k = 0; k < Abc_MinInt( Abc_MaxInt(nProcs, 1), DCH_SIM_ROUNDS ); k++ )
+        Vec_PtrFree( vSims[k] );
     // prepare class refinement procedures
     Dch_ClassesSetData( pClasses, NULL, NULL, Dch_NodeIsConstCex, Dch_NodesAreEqualCex );
     return pClasses;
@@ -499,6 +499,34 @@ int run_command(char* cmd)
     return rc;
 }
 
+Abc_Frame_t* _session_start()
+{
+    return Abc_SessionStart();
+}
+
+void _session_stop(Abc_Frame_t* pAbc)
+{
+    Abc_SessionStop(pAbc);
+}
+
+int _session_run(Abc_Frame_t* pAbc, char* cmd)
+{
+    int rc;
+    
+    Py_BEGIN_ALLOW_THREADS
+    
+    rc = Abc_SessionExecute(pAbc, cmd);
+    
+    Py_END_ALLOW_THREADS
+    
+    return rc;
+}
+
+Abc_Frame_t* _session_switch(Abc_Frame_t* pAbc)
+{
+    return Abc_FrameSetThreadFrame(pAbc);
+}
+
 void pyabc_internal_register_command( char * sGroup, char * sName, int fChanges )
 {
     Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
@@ -737,6 +765,11 @@ double n_area();
 
 int run_command(char* cmd);
 
+Abc_Frame_t* _session_start();
+void _session_stop(Abc_Frame_t* pAbc);
+int _session_run(Abc_Frame_t* pAbc, char* cmd);
+Abc_Frame_t* _session_switch(Abc_Frame_t* pAbc);
+
 int has_comb_model();
 int has_seq_model();
 
@@ -846,6 +879,51 @@ def cex_put(cex):
     return _cex_put(cex.pCex)
     
     
+class Session(object):
+    """An independent ABC session with its own networks, libraries and flags.
+    
+    Sessions can be used from different threads at the same time (the GIL
+    is released while a command runs), but one session should be used by
+    one thread at a time. The AIG recorder (rec_start3), fraig_store, the
+    NPN table (npnload, npnsave) and the GIA rewriter (&rwr, &shrink) keep
+    process-wide data and should not be used by two sessions at once. The functions of this module, such as n_ands(),
+    refer to the session when called through Session.call() or through 
+    the methods of the same name."""
+    
+    def __init__(self):
+        self._frame = _session_start()
+        
+    def run(self, cmd):
+        assert self._frame is not None, "The session has been stopped."
+        return _session_run(self._frame, cmd)
+        
+    def call(self, func, *args):
+        assert self._frame is not None, "The session has been stopped."
+        prev = _session_switch(self._frame)
+        try:
+            return func(*args)
+        finally:
+            _session_switch(prev)
+            
+    def stop(self):
+        if self._frame is not None:
+            _session_stop(self._frame)
+            self._frame = None
+            
+    def __enter__(self):
+        return self
+        
+    def __exit__(self, *args):
+        self.stop()
+
+def _session_method(func):
+    return lambda self, *args: self.call(func, *args)
+
+for _func in (n_ands, n_nodes, n_pis, n_pos, n_latches, n_levels, n_area, 
+        has_comb_model, has_seq_model, n_bmc_frames, prob_status, is_valid_cex, is_true_cex,
+        n_cex_pis, n_cex_regs, cex_po, cex_frame, n_phases, is_const_po, cex_get, cex_put, eq_classes):
+    setattr(Session, _func.__name__, _session_method(_func))
+
 def create_abc_array(List):
     _pyabc_array_clear()
     for ObjId in List:
@@ -26,6 +26,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include "satSolver.h"
 #include "satStore.h"
+#include "misc/util/utilProf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -1142,6 +1143,7 @@ void sat_solver_setnvars(sat_solver* s,int n)
 
 void sat_solver_delete(sat_solver* s)
 {
+    Abc_ProfCount( ABC_PROF_SAT_CONFLICTS, s->stats.conflicts );
 //    Vec_SetFree_( &s->Mem );
     Sat_MemFree_( &s->Mem );
 
@@ -1756,6 +1758,7 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
 
     // set the external limits
     s->nCalls++;
+    Abc_ProfCount( ABC_PROF_SAT_CALLS, 1 );
     s->nRestarts  = 0;
     s->nConfLimit = 0;
     s->nInsLimit  = 0;
@@ -20,6 +20,14 @@
 
 #include "cnf.h"
 
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,16 +35,33 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static Cnf_Man_t * s_pManCnf = NULL;
+// each thread uses its own manager because the manager keeps the cuts
+static ABC_THREAD_LOCAL Cnf_Man_t * s_pManCnf = NULL;
+
+#ifdef ABC_USE_PTHREADS
+// the managers of the threads that did not free them are stopped when the threads exit
+static pthread_key_t  s_ManCnfKey;
+static pthread_once_t s_ManCnfKeyOnce = PTHREAD_ONCE_INIT;
+static void Cnf_ManStopKey( void * p ) { Cnf_ManStop( (Cnf_Man_t *)p );                 }
+static void Cnf_ManStartKey()          { pthread_key_create( &s_ManCnfKey, Cnf_ManStopKey ); }
+static inline void Cnf_ManSetKey( Cnf_Man_t * p )
+{
+    pthread_once( &s_ManCnfKeyOnce, Cnf_ManStartKey );
+    pthread_setspecific( s_ManCnfKey, p );
+}
+#else
+static inline void Cnf_ManSetKey( Cnf_Man_t * p ) {}
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Starts, reads and frees the manager of the calling thread.]
 
-  Description []
+  Description [The manager of a thread that exits without calling 
+  Cnf_ManFree() is stopped when the thread exits.]
                
   SideEffects []
 
@@ -49,6 +74,7 @@ void Cnf_ManPrepare()
     {
 //        printf( "\n\nCreating CNF manager!!!!!\n\n" );
         s_pManCnf = Cnf_ManStart();
+        Cnf_ManSetKey( s_pManCnf );
     }
 }
 Cnf_Man_t * Cnf_ManRead()
@@ -59,6 +85,7 @@ void Cnf_ManFree()
 {
     if ( s_pManCnf == NULL )
         return;
+    Cnf_ManSetKey( NULL );
     Cnf_ManStop( s_pManCnf );
     s_pManCnf = NULL;
 }